@@ -49,6 +49,9 @@ const char my_key[] =
   "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\n" \
   "-----END RSA PRIVATE KEY-----\n";
 
+// To skip the PEM decoding and the heap copy at boot, convert the certificate and key with
+// python pycert_bearssl.py mtls --output client_blob.h certificate.pem.crt private.pem.key
+// then #include "client_blob.h" and use SSLClientParameters::fromBlob(CLIENT_BLOB) instead
 SSLClientParameters mTLS = SSLClientParameters::fromPEM(my_cert, sizeof my_cert, my_key, sizeof my_key);
 
 const char* mqttServer = "xxxxxxxxxxxx-ats.iot.us-east-1.amazonaws.com";
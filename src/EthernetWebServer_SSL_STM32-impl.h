@@ -90,7 +90,19 @@ EthernetWebServer::EthernetWebServer(int port)
   , _currentHeaders(0)
   , _contentLength(0)
   , _chunked(false)
+  , _currentStreamer(nullptr)
+  , _deferredSlot(-1)
+  , _deferGeneration(0)
+  , _currentOutput(nullptr)
+  , _nonBlockingWrites(false)
 {
+  for (int i = 0; i < HTTP_MAX_PENDING_RESPONSES; i++)
+  {
+    _pending[i].streamer    = nullptr;
+    _pending[i].output      = nullptr;
+    _pending[i].deferred    = false;
+    _pending[i].generation  = 0;
+  }
 }
 
 EthernetWebServer::~EthernetWebServer()
@@ -108,6 +120,14 @@ EthernetWebServer::~EthernetWebServer()
     handler = next;
   }
 
+  for (int i = 0; i < HTTP_MAX_PENDING_RESPONSES; i++)
+  {
+    _releasePendingResponse(i);
+  }
+
+  if (_currentOutput)
+    delete _currentOutput;
+
   close();
 }
 
@@ -214,6 +234,8 @@ void EthernetWebServer::_addRequestHandler(RequestHandler* handler)
 
 void EthernetWebServer::handleClient()
 {
+  _handlePendingResponses();
+
   if (_currentStatus == HC_NONE)
   {
     EthernetClient client = _server.available();
@@ -253,6 +275,14 @@ void EthernetWebServer::handleClient()
             _contentLength = CONTENT_LENGTH_NOT_SET;
             _handleRequest();
 
+            if (_parkCurrentClient())
+            {
+              // Response is completed by the following handleClient() calls
+              _currentStatus = HC_NONE;
+
+              return;
+            }
+
             if (_currentClient.connected())
             {
               _currentStatus = HC_WAIT_CLOSE;
@@ -308,6 +338,8 @@ void EthernetWebServer::handleClient()
 
 void EthernetWebServer::handleClient()
 {
+  _handlePendingResponses();
+
   if (_currentStatus == HC_NONE)
   {
     EthernetClient client = _server.available();
@@ -377,6 +409,12 @@ void EthernetWebServer::handleClient()
     //ET_LOGDEBUG(F("handleClient _handleRequest"));
     _handleRequest();
 
+    if (_parkCurrentClient())
+    {
+      _currentStatus = HC_NONE;
+      return;
+    }
+
     if (!_currentClient.connected())
     {
       ET_LOGDEBUG(F("handleClient: Connection closed"));
@@ -422,6 +460,346 @@ stopClient:
 
 #endif
 
+bool EthernetWebServer::_parkCurrentClient()
+{
+  if (_deferredSlot >= 0)
+  {
+    // The connection was already moved to its slot by defer()
+    ET_LOGDEBUG1(F("_parkCurrentClient: deferred slot ="), _deferredSlot);
+
+    _deferredSlot = -1;
+    _currentClient = EthernetClient();
+
+    if (_currentStreamer)
+    {
+      delete _currentStreamer;
+      _currentStreamer = nullptr;
+    }
+
+    return true;
+  }
+
+  bool hasOutput = (_currentOutput && !_currentOutput->empty());
+
+  if (!_currentStreamer && !hasOutput)
+    return false;
+
+  for (int i = 0; i < HTTP_MAX_PENDING_RESPONSES; i++)
+  {
+    if (!_pending[i].inUse())
+    {
+      ET_LOGDEBUG1(F("_parkCurrentClient: pending slot ="), i);
+
+      _pending[i].client    = _currentClient;
+      _pending[i].streamer  = _currentStreamer;
+      _currentStreamer      = nullptr;
+      _currentClient        = EthernetClient();
+
+      if (hasOutput)
+      {
+        _pending[i].output  = _currentOutput;
+        _currentOutput      = nullptr;
+      }
+
+      return true;
+    }
+  }
+
+  // No free slot, finish the transfer now
+  ET_LOGDEBUG(F("_parkCurrentClient: no free slot, sending now"));
+
+  _flushOutput();
+
+  if (_currentStreamer)
+  {
+    _currentStreamer->run(_currentClient, true);
+
+    delete _currentStreamer;
+    _currentStreamer = nullptr;
+  }
+
+  return false;
+}
+
+void EthernetWebServer::_handlePendingResponses()
+{
+  for (int i = 0; i < HTTP_MAX_PENDING_RESPONSES; i++)
+  {
+    if (_pending[i].deferred)
+    {
+      if (!_pending[i].client.connected())
+      {
+        ET_LOGDEBUG1(F("_handlePendingResponses: deferred client gone, slot ="), i);
+
+        _releasePendingResponse(i);
+      }
+      else if (millis() - _pending[i].since >= _pending[i].timeout)
+      {
+        ET_LOGDEBUG1(F("_handlePendingResponses: deferred timeout, slot ="), i);
+
+        _completeDeferred(i, _pending[i].generation, _pending[i].timeoutCode, NULL, String(""));
+      }
+
+      continue;
+    }
+
+    if (_pending[i].output)
+    {
+      // Queued data goes first
+      if (!_pending[i].output->flush(_pending[i].client, false))
+        continue;
+
+      if (_pending[i].output->failed() || !_pending[i].streamer)
+      {
+        _releasePendingResponse(i);
+
+        continue;
+      }
+
+      delete _pending[i].output;
+      _pending[i].output = nullptr;
+    }
+
+    if (!_pending[i].streamer)
+      continue;
+
+    if (_pending[i].streamer->run(_pending[i].client, false))
+    {
+      ET_LOGDEBUG1(F("_handlePendingResponses: done, sent ="), _pending[i].streamer->sent());
+
+      _releasePendingResponse(i);
+    }
+  }
+}
+
+void EthernetWebServer::_releasePendingResponse(int index)
+{
+  if (!_pending[index].inUse())
+    return;
+
+  if (_pending[index].streamer)
+  {
+    delete _pending[index].streamer;
+    _pending[index].streamer = nullptr;
+  }
+
+  if (_pending[index].output)
+  {
+    delete _pending[index].output;
+    _pending[index].output = nullptr;
+  }
+
+  _pending[index].deferred = false;
+
+  _pending[index].client.stop();
+  _pending[index].client = EthernetClient();
+}
+
+DeferredResponse EthernetWebServer::defer(unsigned long timeout_ms, int timeoutCode)
+{
+  if ( (_deferredSlot >= 0) || !_currentClient.connected() )
+    return DeferredResponse();
+
+  for (int i = 0; i < HTTP_MAX_PENDING_RESPONSES; i++)
+  {
+    if (!_pending[i].inUse())
+    {
+      ET_LOGDEBUG1(F("defer: slot ="), i);
+
+      _pending[i].client      = _currentClient;
+      _pending[i].deferred    = true;
+      _pending[i].generation  = ++_deferGeneration;
+      _pending[i].version     = _currentVersion;
+      _pending[i].timeoutCode = timeoutCode;
+      _pending[i].since       = millis();
+      _pending[i].timeout     = timeout_ms;
+
+      _deferredSlot = i;
+
+      return DeferredResponse(this, i, _pending[i].generation);
+    }
+  }
+
+  ET_LOGWARN(F("defer: no free slot"));
+
+  return DeferredResponse();
+}
+
+bool EthernetWebServer::_deferredPending(uint8_t slot, uint16_t generation)
+{
+  return ( (slot < HTTP_MAX_PENDING_RESPONSES) && _pending[slot].deferred && (_pending[slot].generation == generation) );
+}
+
+bool EthernetWebServer::_completeDeferred(uint8_t slot, uint16_t generation, int code, const char* content_type,
+                                          const String& content)
+{
+  if (!_deferredPending(slot, generation))
+    return false;
+
+  PendingResponse& pending = _pending[slot];
+
+  // complete() can be called from anywhere, even another handler: send with the state of the deferred request
+  EthernetClient    savedClient   = _currentClient;
+  uint8_t           savedVersion  = _currentVersion;
+  size_t            savedLength   = _contentLength;
+  bool              savedChunked  = _chunked;
+  String            savedHeaders  = _responseHeaders;
+  ResponseStreamer* savedStreamer = _currentStreamer;
+  OutputQueue*      savedOutput   = _currentOutput;
+
+  _currentClient    = pending.client;
+  _currentVersion   = pending.version;
+  _contentLength    = CONTENT_LENGTH_NOT_SET;
+  _chunked          = false;
+  _responseHeaders  = String("");
+  _currentStreamer  = nullptr;
+  _currentOutput    = nullptr;
+
+  send(code, content_type, content);
+  _finalizeResponse();
+
+  if (_currentOutput && _currentOutput->empty())
+  {
+    delete _currentOutput;
+    _currentOutput = nullptr;
+  }
+
+  if (_currentStreamer || _currentOutput)
+  {
+    // Sent by the following handleClient() calls
+    pending.streamer = _currentStreamer;
+    pending.output   = _currentOutput;
+    pending.deferred = false;
+  }
+  else
+  {
+    _releasePendingResponse(slot);
+  }
+
+  _currentClient    = savedClient;
+  _currentVersion   = savedVersion;
+  _contentLength    = savedLength;
+  _chunked          = savedChunked;
+  _responseHeaders  = savedHeaders;
+  _currentStreamer  = savedStreamer;
+  _currentOutput    = savedOutput;
+
+  return true;
+}
+
+// Write to the current client as much as its TX space permits, and queue the rest. Only waits when
+// the output queue is full. Returns the number of bytes written or queued.
+size_t EthernetWebServer::_write(const void* data, size_t len)
+{
+  const uint8_t* buf = (const uint8_t*) data;
+  size_t written = 0;
+
+  while (written < len)
+  {
+    if (!_currentOutput || _currentOutput->empty())
+    {
+      size_t space = ethernetClientTxSpace(_currentClient);
+
+      if (space)
+      {
+        if (space > len - written)
+          space = len - written;
+
+        size_t count = _currentClient.write(buf + written, space);
+
+        written += count;
+
+        if (count)
+          continue;
+      }
+    }
+
+    if (!_currentOutput)
+    {
+      _currentOutput = new OutputQueue();
+
+      if (!_currentOutput || !_currentOutput->valid())
+      {
+        ET_LOGERROR1(F("_write: Error, can't allocate buffer, Sz ="), HTTP_OUTPUT_BUFFER_SZ);
+
+        if (_currentOutput)
+        {
+          delete _currentOutput;
+          _currentOutput = nullptr;
+        }
+
+        // Blocking write, as before
+        return written + _currentClient.write(buf + written, len - written);
+      }
+    }
+
+    written += _currentOutput->push(buf + written, len - written);
+
+    if (written < len)
+    {
+      // Queue is full, wait for the socket to take some of it
+      _currentOutput->flush(_currentClient, true);
+
+      if (_currentOutput->failed())
+      {
+        _currentOutput->clear();
+
+        break;
+      }
+    }
+  }
+
+  return written;
+}
+
+// Number of bytes out of size which can be sent without waiting, with overhead bytes of framing
+size_t EthernetWebServer::_writable(size_t size, size_t overhead)
+{
+  size_t space = HTTP_OUTPUT_BUFFER_SZ;
+
+  if (_currentOutput)
+  {
+    space = _currentOutput->space();
+
+    if (_currentOutput->empty())
+      space += ethernetClientTxSpace(_currentClient);
+  }
+  else
+  {
+    space += ethernetClientTxSpace(_currentClient);
+  }
+
+  if (space <= overhead)
+    return 0;
+
+  return (size < space - overhead) ? size : (space - overhead);
+}
+
+// Wait until the queued data of the current response has been sent
+void EthernetWebServer::_flushOutput()
+{
+  if (_currentOutput)
+  {
+    _currentOutput->flush(_currentClient, true);
+    _currentOutput->clear();
+  }
+}
+
+bool DeferredResponse::pending() const
+{
+  return ( _server && _server->_deferredPending(_slot, _generation) );
+}
+
+bool DeferredResponse::complete(int code, const char* content_type, const String& content)
+{
+  return ( _server && _server->_completeDeferred(_slot, _generation, code, content_type, content) );
+}
+
+bool DeferredResponse::complete(int code, const String& content_type, const String& content)
+{
+  return complete(code, content_type.c_str(), content);
+}
+
 void EthernetWebServer::close()
 {
   // TODO: Write close method for Ethernet library and uncomment this
@@ -557,13 +935,13 @@ void EthernetWebServer::send(int code, const char* content_type, const String& c
 
   _prepareHeader(header, code, content_type, content.length());
 
-  _currentClient.write((const uint8_t *)header.c_str(), header.length());
+  _write(header.c_str(), header.length());
 
   if (content.length())
   {
     ET_LOGDEBUG1(F("send1: write header = "), fromEWString(header));
     //sendContent(content);
-    sendContent(content, content.length());
+    _sendContent(content.c_str(), content.length(), false);
   }
 }
 
@@ -582,11 +960,11 @@ void EthernetWebServer::send(int code, char* content_type, const String& content
   ET_LOGDEBUG1(F("send2: hdrlen = "), header.length());
   ET_LOGDEBUG1(F("header = "), fromEWString(header));
 
-  _currentClient.write((const uint8_t *) header.c_str(), header.length());
+  _write(header.c_str(), header.length());
 
   if (contentLength)
   {
-    sendContent(content, contentLength);
+    _sendContent(content.c_str(), contentLength, false);
   }
 }
 
@@ -600,35 +978,69 @@ void EthernetWebServer::send(int code, const String& content_type, const String&
   send(code, (const char*)content_type.c_str(), content);
 }
 
-void EthernetWebServer::sendContent(const String& content)
+#if ETHERNET_WEBSERVER_HAS_COROUTINES
+void EthernetWebServer::send(int code, const char* content_type, ResponseGenerator&& body)
 {
-  const char * footer = RETURN_NEWLINE;
-  size_t len = content.length();
+  // Allocate the streamer before anything is sent, so that a failure can still get a complete response
+  GeneratorStreamer* streamer = new GeneratorStreamer(static_cast<ResponseGenerator&&>(body));
 
-  if (_chunked)
+  if (!streamer || !streamer->valid())
   {
-    char * chunkSize = (char *) malloc(11);
+    ET_LOGERROR1(F("send3: Error, can't allocate buffer, Sz ="), 2 * STREAMFILE_BUFFER_SZ);
 
-    if (chunkSize)
-    {
-      sprintf(chunkSize, "%x%s", len, footer);
-      _currentClient.write(chunkSize, strlen(chunkSize));
-      free(chunkSize);
-    }
-  }
+    if (streamer)
+      delete streamer;
 
-  _currentClient.write(content.c_str(), len);
+    send(500, "text/plain", "Out of memory");
 
-  if (_chunked)
-  {
-    _currentClient.write(footer, 2);
+    return;
   }
+
+  EWString header;
+
+  _contentLength = CONTENT_LENGTH_UNKNOWN;
+  _prepareHeader(header, code, content_type, 0);
+
+  ET_LOGDEBUG1(F("send3: hdrlen = "), header.length());
+
+  _write(header.c_str(), header.length());
+
+  // The last chunk is sent by the streamer, not by _finalizeResponse()
+  streamer->setChunked(_chunked);
+  _chunked = false;
+
+  if (_currentStreamer)
+    delete _currentStreamer;
+
+  _currentStreamer = streamer;
+}
+#endif
+
+size_t EthernetWebServer::sendContent(const String& content)
+{
+  return _sendContent(content.c_str(), content.length(), _nonBlockingWrites);
+}
+
+size_t EthernetWebServer::sendContent(const String& content, size_t size)
+{
+  return _sendContent(content.c_str(), size, _nonBlockingWrites);
 }
 
-void EthernetWebServer::sendContent(const String& content, size_t size)
+size_t EthernetWebServer::_sendContent(const char* content, size_t size, bool partial)
 {
   const char * footer = RETURN_NEWLINE;
 
+  if (partial)
+  {
+    size_t accepted = _writable(size, _chunked ? 12 : 0);
+
+    // Don't send an empty chunk, which would end the response
+    if (size && !accepted)
+      return 0;
+
+    size = accepted;
+  }
+
   if (_chunked)
   {
     char * chunkSize = (char *) malloc(11);
@@ -638,19 +1050,21 @@ void EthernetWebServer::sendContent(const String& content, size_t size)
       ET_LOGDEBUG(F("sendContent: _chunked"));
 
       sprintf(chunkSize, "%x%s", size, footer);
-      _currentClient.write(chunkSize, strlen(chunkSize));
+      _write(chunkSize, strlen(chunkSize));
       free(chunkSize);
     }
   }
 
   ET_LOGDEBUG1(F("sendContent: Client.write content: "), content);
 
-  _currentClient.write(content.c_str(), size);
+  _write(content, size);
 
   if (_chunked)
   {
-    _currentClient.write(footer, 2);
+    _write(footer, 2);
   }
+
+  return size;
 }
 
 // KH, Restore PROGMEM commands
@@ -674,11 +1088,11 @@ void EthernetWebServer::send_P(int code, PGM_P content_type, PGM_P content)
   ET_LOGDEBUG1(F("send_P: hdrlen = "), header.length());
   ET_LOGDEBUG1(F("header = "), header);
 
-  _currentClient.write(header.c_str(), header.length());
+  _write(header.c_str(), header.length());
 
   if (contentLength)
   {
-    sendContent_P(content);
+    _sendContent_P(content, contentLength, false);
   }
 }
 
@@ -696,24 +1110,40 @@ void EthernetWebServer::send_P(int code, PGM_P content_type, PGM_P content, size
   ET_LOGDEBUG1(F("send_P: hdrlen = "), header.length());
   ET_LOGDEBUG1(F("header = "), fromEWString(header));
 
-  _currentClient.write((const uint8_t *) header.c_str(), header.length());
+  _write(header.c_str(), header.length());
 
   if (contentLength)
   {
-    sendContent_P(content, contentLength);
+    _sendContent_P(content, contentLength, false);
   }
 }
 
 
-void EthernetWebServer::sendContent_P(PGM_P content)
+size_t EthernetWebServer::sendContent_P(PGM_P content)
 {
-  sendContent_P(content, strlen_P(content));
+  return _sendContent_P(content, strlen_P(content), _nonBlockingWrites);
 }
 
-void EthernetWebServer::sendContent_P(PGM_P content, size_t size)
+size_t EthernetWebServer::sendContent_P(PGM_P content, size_t size)
+{
+  return _sendContent_P(content, size, _nonBlockingWrites);
+}
+
+size_t EthernetWebServer::_sendContent_P(PGM_P content, size_t size, bool partial)
 {
   const char * footer = RETURN_NEWLINE;
 
+  if (partial)
+  {
+    size_t accepted = _writable(size, _chunked ? 12 : 0);
+
+    // Don't send an empty chunk, which would end the response
+    if (size && !accepted)
+      return 0;
+
+    size = accepted;
+  }
+
   if (_chunked)
   {
     char * chunkSize = (char *) malloc(11);
@@ -721,7 +1151,7 @@ void EthernetWebServer::sendContent_P(PGM_P content, size_t size)
     if (chunkSize)
     {
       sprintf(chunkSize, "%x%s", size, footer);
-      _currentClient.write(chunkSize, strlen(chunkSize));
+      _write(chunkSize, strlen(chunkSize));
       free(chunkSize);
     }
   }
@@ -738,24 +1168,26 @@ void EthernetWebServer::sendContent_P(PGM_P content, size_t size)
     {
       /* code */
       memcpy_P(buffer, &content[i * SENDCONTENT_P_BUFFER_SZ], SENDCONTENT_P_BUFFER_SZ);
-      _currentClient.write(buffer, SENDCONTENT_P_BUFFER_SZ);
+      _write(buffer, SENDCONTENT_P_BUFFER_SZ);
     }
 
     memcpy_P(buffer, &content[i * SENDCONTENT_P_BUFFER_SZ], remainder);
-    _currentClient.write(buffer, remainder);
+    _write(buffer, remainder);
 
     delete [] buffer;
   }
   else
   {
     ET_LOGERROR1(F("sendContent_P: Error, can't allocate buffer, Sz ="), SENDCONTENT_P_BUFFER_SZ);
-    return;
+    return 0;
   }
 
   if (_chunked)
   {
-    _currentClient.write(footer, 2);
+    _write(footer, 2);
   }
+
+  return size;
 }
 
 String EthernetWebServer::arg(const String& name)
@@ -925,7 +1357,7 @@ void EthernetWebServer::_finalizeResponse()
 {
   if (_chunked)
   {
-    sendContent(String());
+    _sendContent("", 0, false);
   }
 }
 
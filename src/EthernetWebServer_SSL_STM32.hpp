@@ -135,6 +135,17 @@ enum HTTPAuthMethod
 #define HTTP_MAX_SEND_WAIT      5000 //ms to wait for data chunk to be ACKed
 #define HTTP_MAX_CLOSE_WAIT     2000 //ms to wait for the client to close the connection
 
+// Permit redefinition of HTTP_MAX_PENDING_RESPONSES in sketch. Number of connections whose response
+// is completed in later handleClient() calls, such as streamFileAsync(). Default is 2
+#ifndef HTTP_MAX_PENDING_RESPONSES
+  #define HTTP_MAX_PENDING_RESPONSES    2
+#endif
+
+// Permit redefinition of HTTP_DEFER_TIMEOUT in sketch. Default ms a deferred response waits for complete()
+#ifndef HTTP_DEFER_TIMEOUT
+  #define HTTP_DEFER_TIMEOUT            30000
+#endif
+
 #define CONTENT_LENGTH_UNKNOWN  ((size_t) -1)
 #define CONTENT_LENGTH_NOT_SET  ((size_t) -2)
 
@@ -164,6 +175,49 @@ typedef struct
 } HTTPUpload;
 
 #include "detail/RequestHandler_STM32.h"
+#include "detail/ResponseStreamer_STM32.h"
+#include "detail/ResponseGenerator_STM32.h"
+#include "detail/OutputQueue_STM32.h"
+
+class EthernetWebServer;
+
+// Handle to a request whose response is sent later, see EthernetWebServer::defer()
+class DeferredResponse
+{
+  public:
+    DeferredResponse()
+      : _server(nullptr)
+      , _slot(0)
+      , _generation(0)
+    {
+    }
+
+    // true while the connection waits for complete(), false after completion, timeout or disconnect
+    bool pending() const;
+
+    // Send the response on the waiting connection. Returns false if it is no longer pending
+    bool complete(int code, const char* content_type = NULL, const String& content = String(""));
+    bool complete(int code, const String& content_type, const String& content);
+
+    operator bool() const
+    {
+      return pending();
+    }
+
+  private:
+    friend class EthernetWebServer;
+
+    DeferredResponse(EthernetWebServer* server, uint8_t slot, uint16_t generation)
+      : _server(server)
+      , _slot(slot)
+      , _generation(generation)
+    {
+    }
+
+    EthernetWebServer*  _server;
+    uint8_t             _slot;
+    uint16_t            _generation;
+};
 
 class EthernetWebServer
 {
@@ -243,41 +297,119 @@ class EthernetWebServer
     //KH
     void send(int code, char*  content_type, const String& content, size_t contentLength);
 
+#if ETHERNET_WEBSERVER_HAS_COROUTINES
+    // Send the output of a handler coroutine, chunked for HTTP/1.1 clients. The coroutine is resumed
+    // from the following handleClient() calls whenever the connection can take more data
+    void send(int code, const char* content_type, ResponseGenerator&& body);
+#endif
+
     void setContentLength(size_t contentLength);
     void sendHeader(const String& name, const String& value, bool first = false);
-    void sendContent(const String& content);
-    void sendContent(const String& content, size_t size);
+    // Called from a handler to respond later. The handler returns without sending anything and the
+    // connection waits, without holding handleClient(), until complete() is called on the returned handle
+    // or timeout_ms expires, in which case a response with timeoutCode is sent. If all the pending
+    // slots are busy the handle isn't pending, and the handler has to respond as usual.
+    DeferredResponse defer(unsigned long timeout_ms = HTTP_DEFER_TIMEOUT, int timeoutCode = 204);
+
+    // Return the number of content bytes accepted, which is less than size only with non-blocking writes
+    size_t sendContent(const String& content);
+    size_t sendContent(const String& content, size_t size);
     
     // KH, Restore PROGMEM commands
     void send_P(int code, PGM_P content_type, PGM_P content);
     void send_P(int code, PGM_P content_type, PGM_P content, size_t contentLength);
     
-    void sendContent_P(PGM_P content);
-    void sendContent_P(PGM_P content, size_t size);
+    size_t sendContent_P(PGM_P content);
+    size_t sendContent_P(PGM_P content, size_t size);
+
+    // With non-blocking writes, sendContent() only accepts what the socket and the output buffer can take
+    // without waiting, and the handler sends the rest later, e.g. from a deferred response. Response data
+    // that doesn't fit the socket is always queued and sent by the following handleClient() calls.
+    void setNonBlockingWrites(bool nonBlocking)
+    {
+      _nonBlockingWrites = nonBlocking;
+    }
+
+    // Number of bytes of the current response queued, waiting for TX space
+    size_t pendingOutput() const
+    {
+      return _currentOutput ? _currentOutput->size() : 0;
+    }
     //////
 
     static String urlDecode(const String& text);
 
-    template<typename T> size_t streamFile(T &file, const String& contentType) 
+    template<typename T> size_t streamFile(T &file, const String& contentType)
     {
-      using namespace mime;
-      setContentLength(file.size());
-      
-      if (String(file.name()).endsWith(mimeTable[gz].endsWith) && contentType != mimeTable[gz].mimeType && contentType != mimeTable[none].mimeType) 
+      _streamFileHeader(file, contentType);
+
+      FileStreamer<T&> streamer(file, false);
+
+      if (!streamer.valid())
       {
-        sendHeader("Content-Encoding", "gzip");
+        ET_LOGERROR1(F("streamFile: Error, can't allocate buffer, Sz ="), 2 * STREAMFILE_BUFFER_SZ);
+
+        _flushOutput();
+
+        return _currentClient.write(file);
       }
-      
-      send(200, contentType, "");
-      
-      return _currentClient.write(file);
+
+      _flushOutput();
+      streamer.run(_currentClient, true);
+
+      return streamer.sent();
     }
 
+    // Same as streamFile(), but the file is sent from the following handleClient() calls, so that the
+    // loop isn't held by a slow client. The server keeps a copy of the file handle and closes it when the
+    // transfer ends, so the handler must not close the file. Returns the number of bytes to be sent.
+    template<typename T> size_t streamFileAsync(T &file, const String& contentType)
+    {
+      size_t contentLength = file.size();
+
+      // A stream already started by this handler is finished first, as when no pending slot is free
+      if (_currentStreamer)
+      {
+        _flushOutput();
+        _currentStreamer->run(_currentClient, true);
+
+        delete _currentStreamer;
+        _currentStreamer = nullptr;
+      }
+
+      _streamFileHeader(file, contentType);
+
+      ResponseStreamer* streamer = new FileStreamer<T>(file, true);
+
+      if (!streamer || !streamer->valid())
+      {
+        ET_LOGERROR1(F("streamFileAsync: Error, can't allocate buffer, Sz ="), 2 * STREAMFILE_BUFFER_SZ);
+
+        if (streamer)
+          delete streamer;
+
+        _flushOutput();
+        _currentClient.write(file);
+        file.close();
+
+        return contentLength;
+      }
+
+      _currentStreamer = streamer;
+
+      return contentLength;
+    }
 
   protected:
     void _addRequestHandler(RequestHandler* handler);
     void _handleRequest();
     void _finalizeResponse();
+
+    size_t _write(const void* data, size_t len);
+    size_t _writable(size_t size, size_t overhead);
+    void _flushOutput();
+    size_t _sendContent(const char* content, size_t size, bool partial);
+    size_t _sendContent_P(PGM_P content, size_t size, bool partial);
     bool _parseRequest(EthernetClient& client);
     
     //KH
@@ -298,12 +430,54 @@ class EthernetWebServer
     void _prepareHeader(EWString& response, int code, const char* content_type, size_t contentLength);
     bool _collectHeader(const char* headerName, const char* headerValue);
 
+    template<typename T> void _streamFileHeader(T &file, const String& contentType)
+    {
+      using namespace mime;
+      setContentLength(file.size());
+
+      if (String(file.name()).endsWith(mimeTable[gz].endsWith) && contentType != mimeTable[gz].mimeType && contentType != mimeTable[none].mimeType)
+      {
+        sendHeader("Content-Encoding", "gzip");
+      }
+
+      send(200, contentType, "");
+    }
+
+    friend class DeferredResponse;
+
+    bool _parkCurrentClient();
+    bool _deferredPending(uint8_t slot, uint16_t generation);
+    bool _completeDeferred(uint8_t slot, uint16_t generation, int code, const char* content_type, const String& content);
+    void _handlePendingResponses();
+    void _releasePendingResponse(int index);
+
     struct RequestArgument 
     {
       String key;
       String value;
     };
 
+    // Connection whose response is still being sent after its request was handled
+    struct PendingResponse
+    {
+      EthernetClient      client;
+      ResponseStreamer*   streamer;
+      OutputQueue*        output;
+
+      // Waiting for DeferredResponse::complete()
+      bool                deferred;
+      uint16_t            generation;
+      uint8_t             version;
+      int                 timeoutCode;
+      unsigned long       since;
+      unsigned long       timeout;
+
+      bool inUse() const
+      {
+        return (streamer || output || deferred);
+      }
+    };
+
     EthernetServer  _server;
 
     EthernetClient    _currentClient;
@@ -339,6 +513,14 @@ class EthernetWebServer
 
     String            _hostHeader;
     bool              _chunked;
+
+    ResponseStreamer* _currentStreamer;
+    PendingResponse   _pending[HTTP_MAX_PENDING_RESPONSES];
+    int               _deferredSlot;
+    uint16_t          _deferGeneration;
+
+    OutputQueue*      _currentOutput;
+    bool              _nonBlockingWrites;
 };
 
 #endif  // ETHERNET_WEBSERVER_SSL_STM32_HPP
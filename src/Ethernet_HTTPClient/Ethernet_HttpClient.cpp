@@ -46,7 +46,7 @@ const char* EthernetHttpClient::kTransferEncodingChunked = HTTP_HEADER_TRANSFER_
 
 EthernetHttpClient::EthernetHttpClient(Client& aClient, const char* aServerName, uint16_t aServerPort)
   : iClient(&aClient), iServerName(aServerName), iServerAddress(), iServerPort(aServerPort),
-    iConnectionClose(true), iSendDefaultRequestHeaders(true)
+    iConnectionClose(true), iSendDefaultRequestHeaders(true), iCorkCallback(NULL), iCorked(false)
 {
   resetState();
 }
@@ -58,7 +58,7 @@ EthernetHttpClient::EthernetHttpClient(Client& aClient, const String& aServerNam
 
 EthernetHttpClient::EthernetHttpClient(Client& aClient, const IPAddress& aServerAddress, uint16_t aServerPort)
   : iClient(&aClient), iServerName(NULL), iServerAddress(aServerAddress), iServerPort(aServerPort),
-    iConnectionClose(true), iSendDefaultRequestHeaders(true)
+    iConnectionClose(true), iSendDefaultRequestHeaders(true), iCorkCallback(NULL), iCorked(false)
 {
   resetState();
 }
@@ -75,11 +75,17 @@ void EthernetHttpClient::resetState()
 
   iIsChunked            = false;
   iChunkLength          = 0;
+  iChunkLineLength      = 0;
+  iChunkExtension       = false;
   iHttpResponseTimeout  = kHttpResponseTimeout;
+
+  iRxHead = 0;
+  iRxTail = 0;
 }
 
 void EthernetHttpClient::stop()
 {
+  corkClient(false);
   iClient->stop();
   resetState();
 }
@@ -102,7 +108,7 @@ void EthernetHttpClient::beginRequest()
 int EthernetHttpClient::startRequest(const char* aURLPath, const char* aHttpMethod,
                                      const char* aContentType, int aContentLength, const byte aBody[])
 {
-  if (iState == eReadingBody || iState == eReadingChunkLength || iState == eReadingBodyChunk)
+  if (endOfHeadersReached())
   {
     flushClientRx();
 
@@ -142,7 +148,9 @@ int EthernetHttpClient::startRequest(const char* aURLPath, const char* aHttpMeth
     ET_LOGDEBUG(F("EthernetHttpClient::startRequest: Connection already open"));
   }
 
-  // Now we're connected, send the first part of the request
+  // Now we're connected, send the first part of the request, grouped until it is complete
+  corkClient(true);
+
   int ret = sendInitialHeaders(aURLPath, aHttpMethod);
 
   if (HTTP_SUCCESS == ret)
@@ -173,6 +181,12 @@ int EthernetHttpClient::startRequest(const char* aURLPath, const char* aHttpMeth
     }
   }
 
+  // else endRequest() or responseStatusCode() sends it
+  if (iState >= eRequestSent || HTTP_SUCCESS != ret)
+  {
+    corkClient(false);
+  }
+
   return ret;
 }
 
@@ -300,8 +314,20 @@ void EthernetHttpClient::finishHeaders()
   iState = eRequestSent;
 }
 
+void EthernetHttpClient::corkClient(bool aCorked)
+{
+  if (iCorkCallback && iCorked != aCorked)
+  {
+    iCorked = aCorked;
+    iCorkCallback(*iClient, aCorked);
+  }
+}
+
 void EthernetHttpClient::flushClientRx()
 {
+  iRxHead = 0;
+  iRxTail = 0;
+
   while (iClient->available())
   {
     iClient->read();
@@ -311,6 +337,7 @@ void EthernetHttpClient::flushClientRx()
 void EthernetHttpClient::endRequest()
 {
   beginBody();
+  corkClient(false);
 }
 
 void EthernetHttpClient::beginBody()
@@ -441,6 +468,9 @@ int EthernetHttpClient::responseStatusCode()
     return HTTP_ERROR_API;
   }
 
+  // send what is still grouped before waiting for the answer
+  corkClient(false);
+
   // The first line will be of the form Status-Line:
   //   HTTP-Version SP Status-Code SP Reason-Phrase CRLF
   // Where HTTP-Version is of the form:
@@ -574,7 +604,12 @@ int EthernetHttpClient::skipResponseHeaders()
   {
     if (available())
     {
-      (void)readHeader();
+      // Parse all that is buffered before asking the client again
+      do
+      {
+        (void)readHeader();
+      } while (!endOfHeadersReached() && (iRxHead != iRxTail));
+
       // We read something, reset the timeout counter
       timeoutStart = millis();
     }
@@ -600,7 +635,8 @@ int EthernetHttpClient::skipResponseHeaders()
 
 bool EthernetHttpClient::endOfHeadersReached()
 {
-  return (iState == eReadingBody || iState == eReadingChunkLength || iState == eReadingBodyChunk);
+  return (iState == eReadingBody || iState == eReadingChunkLength || iState == eReadingBodyChunk ||
+          iState == eReadingChunkTrailer || iState == eChunkedBodyRead);
 };
 
 int EthernetHttpClient::contentLength()
@@ -631,29 +667,72 @@ String EthernetHttpClient::responseBody()
     }
   }
 
-  // keep on timedRead'ing, until:
-  //  - we have a content length: body length equals consumed or no bytes
-  //                              available
-  //  - no content length:        no bytes are available
-  while (iBodyLengthConsumed != bodyLength)
+  char block[64 + 1];
+  unsigned long timeoutStart = millis();
+
+  // keep on reading by blocks, until:
+  //  - we have a content length: body length equals consumed
+  //  - chunked:                  the last chunk has been read
+  //  - no content length:        the server closed the connection
+  // or no bytes arrived for the Stream timeout
+  while (!endOfBodyReached())
   {
-    // KH test
-    int c = timedRead();
-    //int c = iClient->read();
+    size_t blockSize = sizeof(block) - 1;
 
-    ET_LOGDEBUG1(F("EthernetHttpClient::responseBody => c ="), String(c));
-    //////
+    if (bodyLength > 0 && (bodyLength - iBodyLengthConsumed) < (int)blockSize)
+    {
+      // don't read past the body
+      blockSize = bodyLength - iBodyLengthConsumed;
+    }
 
-    if (c == -1)
+    if (iState == eReadingBodyChunk)
+    {
+      // grow the String once per chunk rather than once per block
+      response.reserve(response.length() + iChunkLength);
+    }
+
+    int len = read((uint8_t*)block, blockSize);
+
+    if (len > 0)
+    {
+      block[len] = '\0';
+
+      if (strlen(block) == (size_t)len)
+      {
+        if (!response.concat(block))
+        {
+          // adding block failed
+          return String((const char*)NULL);
+        }
+      }
+      else
+      {
+        // the block holds a NUL, append it char by char
+        for (int i = 0; i < len; i++)
+        {
+          if (!response.concat(block[i]))
+          {
+            // adding char failed
+            return String((const char*)NULL);
+          }
+        }
+      }
+
+      timeoutStart = millis();
+    }
+    else if ( (bodyLength == kNoContentLengthHeader) && !iIsChunked && !connected() )
+    {
+      // the server closed the connection at the end of the body
+      break;
+    }
+    else if ( (millis() - timeoutStart) >= _timeout )
     {
       // read timed out, done
       break;
     }
-
-    if (!response.concat((char)c))
+    else
     {
-      // adding char failed
-      return String((const char*)NULL);
+      yield();
     }
   }
 
@@ -668,6 +747,17 @@ String EthernetHttpClient::responseBody()
 
 bool EthernetHttpClient::endOfBodyReached()
 {
+  if (endOfHeadersReached() && iIsChunked)
+  {
+    // The body ends with the last chunk and the trailer after it
+    if (iState == eReadingChunkLength || iState == eReadingChunkTrailer)
+    {
+      readChunkLength();
+    }
+
+    return (iState == eChunkedBodyRead);
+  }
+
   if (endOfHeadersReached() && (contentLength() != kNoContentLengthHeader))
   {
     // We've got to the body and we know how long it will be
@@ -677,44 +767,158 @@ bool EthernetHttpClient::endOfBodyReached()
   return false;
 }
 
-int EthernetHttpClient::available()
+// Value of a hexadecimal digit, or -1
+static int hexDigitValue(const char c)
+{
+  if (c >= '0' && c <= '9')
+  {
+    return c - '0';
+  }
+  else if (c >= 'a' && c <= 'f')
+  {
+    return c - 'a' + 10;
+  }
+  else if (c >= 'A' && c <= 'F')
+  {
+    return c - 'A' + 10;
+  }
+
+  return -1;
+}
+
+int EthernetHttpClient::fillRxBuffer()
 {
-  if (iState == eReadingChunkLength)
+  if (iRxHead == iRxTail)
   {
-    while (iClient->available())
+    iRxHead = 0;
+    iRxTail = 0;
+
+    int len = iClient->read(iRxBuffer, sizeof(iRxBuffer));
+
+    if (len > 0)
     {
-      char c = iClient->read();
+      iRxTail = len;
+    }
+  }
 
-      if (c == '\n')
+  return (iRxTail - iRxHead);
+}
+
+int EthernetHttpClient::readRx(uint8_t *buf, size_t size)
+{
+  size_t buffered = iRxTail - iRxHead;
+
+  if ( (buffered == 0) && (size < sizeof(iRxBuffer)) )
+  {
+    buffered = fillRxBuffer();
+  }
+
+  if (buffered == 0)
+  {
+    // Large reads go straight to the client, without a copy
+    return iClient->read(buf, size);
+  }
+
+  size_t len = min(buffered, size);
+
+  memcpy(buf, iRxBuffer + iRxHead, len);
+  iRxHead += len;
+
+  return len;
+}
+
+void EthernetHttpClient::readChunkLength()
+{
+  // The lines are:
+  //   chunk-size [ ";" chunk-ext ] CRLF, after the CRLF ending the previous chunk's data
+  //   and, after the last chunk of size 0, the trailer fields up to an empty line
+  while ( (iState == eReadingChunkLength || iState == eReadingChunkTrailer) && (fillRxBuffer() > 0) )
+  {
+    const uint8_t* start = iRxBuffer + iRxHead;
+    const uint8_t* lineEnd = (const uint8_t*) memchr(start, '\n', iRxTail - iRxHead);
+    const uint8_t* end = lineEnd ? lineEnd : iRxBuffer + iRxTail;
+
+    for (const uint8_t* p = start; p < end; p++)
+    {
+      if (*p == '\r')
       {
-        iState = eReadingBodyChunk;
-        break;
+        continue;
       }
-      else if (c == '\r')
+
+      iChunkLineLength++;
+
+      if ( (iState == eReadingChunkLength) && !iChunkExtension )
       {
-        // no-op
+        int digit = hexDigitValue(*p);
+
+        if (digit >= 0)
+        {
+          iChunkLength = (iChunkLength * 16) + digit;
+        }
+        else
+        {
+          iChunkExtension = true;
+        }
       }
-      else if (isHexadecimalDigit(c))
-      {
-        char digit[2] = {c, '\0'};
+    }
+
+    iRxHead = end - iRxBuffer;
+
+    if (!lineEnd)
+    {
+      // the rest of the line isn't there yet
+      continue;
+    }
+
+    // consume the '\n'
+    iRxHead++;
 
-        iChunkLength = (iChunkLength * 16) + strtol(digit, NULL, 16);
+    if (iState == eReadingChunkTrailer)
+    {
+      if (iChunkLineLength == 0)
+      {
+        iState = eChunkedBodyRead;
       }
     }
+    else if (iChunkLineLength == 0)
+    {
+      // the CRLF ending the data of the previous chunk
+    }
+    else if (iChunkLength == 0)
+    {
+      iState = eReadingChunkTrailer;
+    }
+    else
+    {
+      iState = eReadingBodyChunk;
+    }
+
+    iChunkLineLength = 0;
+    iChunkExtension = false;
   }
+}
 
-  if (iState == eReadingBodyChunk && iChunkLength == 0)
+int EthernetHttpClient::available()
+{
+  if (iState == eReadingChunkLength || iState == eReadingChunkTrailer)
   {
-    iState = eReadingChunkLength;
+    readChunkLength();
   }
 
-  if (iState == eReadingChunkLength)
+  if (iState == eReadingChunkLength || iState == eReadingChunkTrailer || iState == eChunkedBodyRead)
   {
     return 0;
   }
 
   int clientAvailable = iClient->available();
 
+  if (clientAvailable < 0)
+  {
+    clientAvailable = 0;
+  }
+
+  clientAvailable += (iRxTail - iRxHead);
+
   if (iState == eReadingBodyChunk)
   {
     return min(clientAvailable, iChunkLength);
@@ -725,37 +929,40 @@ int EthernetHttpClient::available()
   }
 }
 
-
 int EthernetHttpClient::read()
 {
-  if (iIsChunked && !available())
+  uint8_t b;
+
+  if (EthernetHttpClient::read(&b, 1) == 1)
   {
-    return -1;
+    return b;
   }
 
-  int ret = iClient->read();
+  return -1;
+}
 
-  if (ret >= 0)
+int EthernetHttpClient::peek()
+{
+  if (iIsChunked && endOfHeadersReached())
   {
-    if (endOfHeadersReached() && iContentLength > 0)
+    if (iState != eReadingBodyChunk)
     {
-      // We're outputting the body now and we've seen a Content-Length header
-      // So keep track of how many bytes are left
-      iBodyLengthConsumed++;
+      readChunkLength();
     }
 
-    if (iState == eReadingBodyChunk)
+    if (iState != eReadingBodyChunk)
     {
-      iChunkLength--;
-
-      if (iChunkLength == 0)
-      {
-        iState = eReadingChunkLength;
-      }
+      // between two chunks, or after the last one
+      return -1;
     }
   }
 
-  return ret;
+  if (fillRxBuffer() == 0)
+  {
+    return -1;
+  }
+
+  return iRxBuffer[iRxHead];
 }
 
 bool EthernetHttpClient::headerAvailable()
@@ -822,16 +1029,43 @@ String EthernetHttpClient::readHeaderValue()
 
 int EthernetHttpClient::read(uint8_t *buf, size_t size)
 {
-  int ret = iClient->read(buf, size);
+  if (iIsChunked && endOfHeadersReached())
+  {
+    if (iState != eReadingBodyChunk)
+    {
+      readChunkLength();
+    }
+
+    if (iState != eReadingBodyChunk)
+    {
+      // between two chunks, or after the last one
+      return -1;
+    }
 
-  if (endOfHeadersReached() && iContentLength > 0)
+    // stop at the end of the chunk, its CRLF and the next length are not data
+    size = min(size, (size_t)iChunkLength);
+  }
+
+  int ret = readRx(buf, size);
+
+  if (ret > 0)
   {
-    // We're outputting the body now and we've seen a Content-Length header
-    // So keep track of how many bytes are left
-    if (ret >= 0)
+    if (endOfHeadersReached() && iContentLength > 0)
     {
+      // We're outputting the body now and we've seen a Content-Length header
+      // So keep track of how many bytes are left
       iBodyLengthConsumed += ret;
     }
+
+    if (iState == eReadingBodyChunk)
+    {
+      iChunkLength -= ret;
+
+      if (iChunkLength == 0)
+      {
+        iState = eReadingChunkLength;
+      }
+    }
   }
 
   return ret;
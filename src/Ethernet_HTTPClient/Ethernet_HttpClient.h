@@ -84,6 +84,11 @@ static const int HTTP_ERROR_INVALID_RESPONSE = -4;
 // processing)
 #define kHttpResponseTimeout      30000L
 
+// Number of bytes of the response read from the client at once. The status
+// line, the headers and the chunk lengths are parsed from this buffer, and
+// small reads of the body are served from it
+#define kHttpRxBufferSize         256
+
 class EthernetHttpClient : public Client
 {
   public:
@@ -313,7 +318,8 @@ class EthernetHttpClient : public Client
     bool endOfHeadersReached();
 
     /** Test whether the end of the body has been reached.
-      Only works if the Content-Length header was returned by the server
+      Only works if the Content-Length header was returned by the server,
+      or if the body is chunked
       @return true if we are now at the end of the body, else false
     */
     bool endOfBodyReached();
@@ -359,6 +365,21 @@ class EthernetHttpClient : public Client
     */
     void noDefaultRequestHeaders();
 
+    /** Function to group the writes of a request, called with true before the
+      request line and with false once the request is sent
+    */
+    typedef void (*CorkCallback)(Client& aClient, bool aCorked);
+
+    /** Sends the request line, headers and body in as few records and segments
+      as possible, e.g. setCorkCallback(EthernetSSLClient::corkClient) when the
+      client is an EthernetSSLClient
+      @param aCallback Function corking the client, or NULL (the default)
+    */
+    void setCorkCallback(CorkCallback aCallback)
+    {
+      iCorkCallback = aCallback;
+    }
+
     // Inherited from Print
     // Note: 1st call to these indicates the user is sending the body, so if need
     // Note: be we should finish the header first
@@ -389,12 +410,14 @@ class EthernetHttpClient : public Client
       @return Byte read or -1 if there are no bytes available.
     */
     virtual int read();
+
+    /** Read up to size bytes from the server, without crossing the end of
+      the current chunk if the body is chunked.
+      @return Number of bytes read or -1 if there are no bytes available.
+    */
     virtual int read(uint8_t *buf, size_t size);
 
-    virtual int peek()
-    {
-      return iClient->peek();
-    };
+    virtual int peek();
 
     virtual void flush()
     {
@@ -416,7 +439,8 @@ class EthernetHttpClient : public Client
 
     virtual uint8_t connected()
     {
-      return iClient->connected();
+      // what is still buffered can be read after the server closed the connection
+      return (iRxHead != iRxTail) || iClient->connected();
     };
 
     virtual operator bool()
@@ -455,6 +479,26 @@ class EthernetHttpClient : public Client
     */
     void flushClientRx();
 
+    /** Cork or uncork the client with iCorkCallback, if not already
+    */
+    void corkClient(bool aCorked);
+
+    /** Read from the client into iRxBuffer, if it is empty
+      @return Number of bytes in iRxBuffer
+    */
+    int fillRxBuffer();
+
+    /** Read from iRxBuffer, or from the client directly once it is empty
+      and the read is at least as large as it
+      @return Number of bytes read or -1 if there are no bytes available.
+    */
+    int readRx(uint8_t *buf, size_t size);
+
+    /** Parse the chunk length lines, and the trailer after the last chunk,
+      from the bytes available
+    */
+    void readChunkLength();
+
     static const char* kContentLengthPrefix;
     static const char* kTransferEncodingChunked;
 
@@ -470,7 +514,9 @@ class EthernetHttpClient : public Client
       eLineStartingCRFound,
       eReadingBody,
       eReadingChunkLength,
-      eReadingBodyChunk
+      eReadingBodyChunk,
+      eReadingChunkTrailer,
+      eChunkedBodyRead
     } tHttpState;
 
     // Client we're using
@@ -496,10 +542,20 @@ class EthernetHttpClient : public Client
     bool iIsChunked;
     // Stores the value of the current chunk length, if present
     int iChunkLength;
+    // Number of characters, besides CR, of the chunk length or trailer line being read
+    int iChunkLineLength;
+    // Set once a chunk extension, or anything else than the length, starts on the line
+    bool iChunkExtension;
     uint32_t iHttpResponseTimeout;
     bool iConnectionClose;
     bool iSendDefaultRequestHeaders;
+    CorkCallback iCorkCallback;
+    bool iCorked;
     String iHeaderLine;
+    // Bytes read from the client but not yet consumed, from iRxHead to iRxTail
+    uint8_t iRxBuffer[kHttpRxBufferSize];
+    size_t iRxHead;
+    size_t iRxTail;
 };
 
 #endif  // ETHERNET_HTTP_CLIENT_H
@@ -0,0 +1,155 @@
+/**
+   SSLBufferPool.h
+
+   This file contains a pool of I/O buffers lent to the connections of several
+   EthernetSSLClient instances, so that idle connections don't each hold one.
+*/
+
+#pragma once
+
+#include "Arduino.h"
+
+/**
+   \brief Fixed size I/O buffers, lent to EthernetSSLClient instances while they need one.
+
+   The I/O buffer is most of the RAM of an EthernetSSLClient, 2K by default and up to 33K for full size
+   records. With EthernetSSLClient::setBufferPool(), a client takes a buffer from the pool at connect() and
+   gives it back at stop(), and optionally while its connection is idle, between records. Several clients
+   then share fewer buffers than they have connections, as long as they aren't all busy at once. Define
+   SSLCLIENT_IOBUF_SIZE as 0 so that the clients don't also allocate their built-in buffer.
+
+   All the buffers of a pool have the same size, which is used as EthernetSSLClient::setBuffers(buf, len)
+   would: mono up to BR_SSL_BUFSIZE_MONO bytes, bidi above. A pool has at most 32 buffers.
+
+   The trust anchors, the configuration of BearSSL and the session cache (SSLSessionCache::shared()) are
+   already shared by the clients; each one keeps its BearSSL contexts, which hold the state of the connection.
+*/
+class SSLBufferPool
+{
+  public:
+
+    /** @brief Largest number of buffers in a pool */
+    static const size_t MAX_BUFFERS = 32;
+
+    /**
+       @param mem count buffers of block_len bytes, which must outlive the pool
+       @param block_len Size of a buffer, at least 837 bytes (512 bytes records)
+       @param count Number of buffers, at most MAX_BUFFERS
+    */
+    SSLBufferPool(unsigned char* mem, const size_t block_len, const size_t count)
+      : m_mem(mem)
+      , m_block_len(block_len)
+      , m_count(count > MAX_BUFFERS ? MAX_BUFFERS : count)
+      , m_used(0)
+      , m_peak(0)
+      , m_failures(0)
+    {
+    }
+
+    SSLBufferPool(const SSLBufferPool&) = delete;
+    SSLBufferPool& operator=(const SSLBufferPool&) = delete;
+
+    /** @brief Take a free buffer, nullptr if all of them are lent */
+    unsigned char* acquire()
+    {
+      for (size_t i = 0; i < m_count; i++)
+      {
+        const uint32_t bit = (uint32_t) 1 << i;
+
+        if (m_used & bit)
+          continue;
+
+        m_used |= bit;
+
+        if (inUse() > m_peak)
+          m_peak = inUse();
+
+        return m_mem + i * m_block_len;
+      }
+
+      m_failures++;
+
+      return nullptr;
+    }
+
+    /** @brief Give back a buffer taken with acquire() */
+    void release(const unsigned char* block)
+    {
+      if (block < m_mem || block >= m_mem + m_count * m_block_len)
+        return;
+
+      m_used &= ~((uint32_t) 1 << ((block - m_mem) / m_block_len));
+    }
+
+    /** @brief Size of the buffers, in bytes */
+    size_t blockSize() const
+    {
+      return m_block_len;
+    }
+
+    /** @brief Number of buffers of the pool */
+    size_t size() const
+    {
+      return m_count;
+    }
+
+    /** @brief Number of buffers lent */
+    size_t inUse() const
+    {
+      size_t n = 0;
+
+      for (uint32_t used = m_used; used; used &= used - 1)
+        n++;
+
+      return n;
+    }
+
+    /** @brief Number of free buffers */
+    size_t available() const
+    {
+      return m_count - inUse();
+    }
+
+    /** @brief Largest number of buffers lent at once */
+    size_t peak() const
+    {
+      return m_peak;
+    }
+
+    /** @brief Number of acquire() calls which found no free buffer */
+    unsigned long failures() const
+    {
+      return m_failures;
+    }
+
+  private:
+
+    unsigned char*  m_mem;
+    size_t          m_block_len;
+    size_t          m_count;
+    // one bit per buffer lent
+    uint32_t        m_used;
+    size_t          m_peak;
+    unsigned long   m_failures;
+};
+
+/**
+   @brief SSLBufferPool with its own COUNT buffers of BLOCK_LEN bytes, sized at compile time.
+
+   e.g. a global SSLBufferPoolBuf<2048, 2> for three or four clients which are seldom busy at the same time.
+*/
+template<size_t BLOCK_LEN, size_t COUNT>
+class SSLBufferPoolBuf : public SSLBufferPool
+{
+  public:
+    SSLBufferPoolBuf()
+      : SSLBufferPool(m_blocks, BLOCK_LEN, COUNT)
+    {
+    }
+
+  private:
+    static_assert(BLOCK_LEN >= 837, "SSLBufferPoolBuf: BLOCK_LEN must be at least 837");
+    static_assert(COUNT >= 1 && COUNT <= SSLBufferPool::MAX_BUFFERS, "SSLBufferPoolBuf: COUNT must be 1 to 32");
+
+    unsigned char m_blocks[BLOCK_LEN * COUNT];
+};
@@ -0,0 +1,235 @@
+/**
+   SSLCertificatePin.h
+
+   This file contains an X.509 validation engine which wraps br_x509_minimal, and skips
+   the validation of the chain when the server presents the certificate it presented before.
+*/
+
+#pragma once
+
+#include "SSLClient/bearssl.h"
+#include "Arduino.h"
+
+// Permit redefinition of SSLCLIENT_PIN_REVALIDATE_MS in sketch. Default interval between full
+// validations of a pinned certificate, see EthernetSSLClient::setCertificatePinning()
+#ifndef SSLCLIENT_PIN_REVALIDATE_MS
+  #define SSLCLIENT_PIN_REVALIDATE_MS     (24UL * 60 * 60 * 1000)
+#endif
+
+/**
+   \brief Remembers the SHA-256 of the server certificate after a full validation of its chain.
+
+   br_x509_minimal verifies one signature per certificate of the chain, RSA or ECDSA, which
+   takes most of a handshake on a Cortex-M. When the end-entity certificate of a later handshake
+   has the same SHA-256 and the same server name, it is still decoded and checked by br_x509_minimal
+   (server name, validity dates, public key), but the rest of the chain is skipped, so the
+   signatures of the chain aren't verified again. The signature of the end-entity certificate is
+   only checked when its issuer is a trust anchor.
+
+   The pin is dropped when the certificate changes or a validation fails, and is only used for
+   the revalidation interval after the full validation, after which the chain is validated again.
+*/
+class SSLCertificatePin
+{
+  public:
+
+    /**
+       @param inner The validation engine used for full validations, which also decodes the end-entity certificate
+    */
+    explicit SSLCertificatePin(br_x509_minimal_context* inner)
+      : m_vtable(&m_class)
+      , m_inner(inner)
+      , m_sha()
+      , m_num_certs(0)
+      , m_armed(false)
+      , m_fast(false)
+      , m_has_pin(false)
+      , m_validated_at(0)
+      , m_revalidate_ms(SSLCLIENT_PIN_REVALIDATE_MS)
+      , m_hits(0)
+      , m_name()
+    {
+      memset(m_pin, 0, sizeof m_pin);
+
+      m_class.context_size  = sizeof(SSLCertificatePin);
+      m_class.start_chain   = m_start_chain;
+      m_class.start_cert    = m_start_cert;
+      m_class.append        = m_append;
+      m_class.end_cert      = m_end_cert;
+      m_class.end_chain     = m_end_chain;
+      m_class.get_pkey      = m_get_pkey;
+    }
+
+    SSLCertificatePin(const SSLCertificatePin&) = delete;
+    SSLCertificatePin& operator=(const SSLCertificatePin&) = delete;
+
+    /** @brief The context to give to br_ssl_engine_set_x509() */
+    const br_x509_class** x509()
+    {
+      return &m_vtable;
+    }
+
+    /** @brief Set the time after which a pinned certificate is validated again, in ms */
+    void setRevalidateInterval(const unsigned long interval_ms)
+    {
+      m_revalidate_ms = interval_ms;
+    }
+
+    /** @brief Forget the pinned certificate, the next handshake does a full validation */
+    void clear()
+    {
+      m_has_pin = false;
+      m_name    = "";
+    }
+
+    /** @brief true if a certificate is pinned */
+    bool pinned() const
+    {
+      return m_has_pin;
+    }
+
+    /** @brief true if the last validation used the pin */
+    bool lastWasPinned() const
+    {
+      return m_fast;
+    }
+
+    /** @brief Number of validations which used the pin */
+    unsigned long hits() const
+    {
+      return m_hits;
+    }
+
+  private:
+
+    static SSLCertificatePin* m_self(const br_x509_class** ctx)
+    {
+      return (SSLCertificatePin*) (void*) ctx;
+    }
+
+    static void m_start_chain(const br_x509_class** ctx, const char* server_name)
+    {
+      SSLCertificatePin* pin = m_self(ctx);
+      const char* name = server_name ? server_name : "";
+
+      pin->m_num_certs  = 0;
+      pin->m_fast       = false;
+      pin->m_armed      = pin->m_has_pin && pin->m_name.equals(name)
+                          && (millis() - pin->m_validated_at < pin->m_revalidate_ms);
+
+      if (pin->m_has_pin && !pin->m_armed)
+        pin->clear();
+
+      // remember the name for the pin, at the start as the engine may not keep it
+      if (!pin->m_has_pin)
+        pin->m_name = name;
+
+      pin->m_inner->vtable->start_chain(&pin->m_inner->vtable, server_name);
+    }
+
+    static void m_start_cert(const br_x509_class** ctx, uint32_t length)
+    {
+      SSLCertificatePin* pin = m_self(ctx);
+
+      if (pin->m_num_certs == 0)
+        br_sha256_init(&pin->m_sha);
+
+      if (!pin->m_fast)
+        pin->m_inner->vtable->start_cert(&pin->m_inner->vtable, length);
+    }
+
+    static void m_append(const br_x509_class** ctx, const unsigned char* buf, size_t len)
+    {
+      SSLCertificatePin* pin = m_self(ctx);
+
+      if (pin->m_num_certs == 0)
+        br_sha256_update(&pin->m_sha, buf, len);
+
+      if (!pin->m_fast)
+        pin->m_inner->vtable->append(&pin->m_inner->vtable, buf, len);
+    }
+
+    static void m_end_cert(const br_x509_class** ctx)
+    {
+      SSLCertificatePin* pin = m_self(ctx);
+
+      if (pin->m_fast)
+        return;
+
+      pin->m_inner->vtable->end_cert(&pin->m_inner->vtable);
+
+      if (pin->m_num_certs++ != 0)
+        return;
+
+      unsigned char hash[br_sha256_SIZE];
+      br_sha256_out(&pin->m_sha, hash);
+
+      if (pin->m_armed)
+      {
+        // the end-entity certificate passed the checks of br_x509_minimal, skip the rest of the chain
+        if ((memcmp(hash, pin->m_pin, sizeof hash) == 0) && (pin->m_inner->err == 0 || pin->m_inner->err == BR_ERR_X509_OK))
+        {
+          pin->m_fast = true;
+          pin->m_hits++;
+        }
+        else
+        {
+          // keep m_name, it is this server's and the new certificate is pinned under it if the chain validates
+          pin->m_has_pin = false;
+        }
+      }
+
+      if (!pin->m_has_pin)
+        memcpy(pin->m_pin, hash, sizeof hash);
+    }
+
+    static unsigned m_end_chain(const br_x509_class** ctx)
+    {
+      SSLCertificatePin* pin = m_self(ctx);
+      br_x509_minimal_context* inner = pin->m_inner;
+
+      if (pin->m_fast)
+      {
+        inner->err = BR_ERR_X509_OK;
+
+        return 0;
+      }
+
+      // only pin a chain which ends at a trust anchor, br_x509_minimal also accepts untrusted ones
+      const bool trusted = (inner->err == BR_ERR_X509_OK);
+      const unsigned err = inner->vtable->end_chain(&inner->vtable);
+
+      if (err == 0 && trusted && pin->m_num_certs > 0)
+      {
+        pin->m_has_pin      = true;
+        pin->m_validated_at = millis();
+      }
+      else
+        pin->clear();
+
+      return err;
+    }
+
+    static const br_x509_pkey* m_get_pkey(const br_x509_class* const* ctx, unsigned* usages)
+    {
+      const SSLCertificatePin* pin = (const SSLCertificatePin*) (const void*) ctx;
+
+      return pin->m_inner->vtable->get_pkey(&pin->m_inner->vtable, usages);
+    }
+
+    // first member, the engine calls the functions with a pointer to it
+    const br_x509_class*      m_vtable;
+    br_x509_class             m_class;
+    br_x509_minimal_context*  m_inner;
+    br_sha256_context         m_sha;
+    unsigned char             m_pin[br_sha256_SIZE];
+    unsigned                  m_num_certs;
+    // the pin can be used for this chain, and was
+    bool                      m_armed;
+    bool                      m_fast;
+    bool                      m_has_pin;
+    unsigned long             m_validated_at;
+    unsigned long             m_revalidate_ms;
+    unsigned long             m_hits;
+    String                    m_name;
+};
@@ -25,8 +25,58 @@
 
 #include "Client.h"
 #include "SSLClient/SSLSession.h"
+#include "SSLClient/SSLSessionCache.h"
+#include "SSLClient/SSLCertificatePin.h"
+#include "SSLClient/SSLKeyPool.h"
+#include "SSLClient/SSLCryptoProfile.h"
+#include "SSLClient/SSLBufferPool.h"
+#include "SSLClient/SSLRecordTrace.h"
 #include "SSLClient/SSLClientParameters.h"
-#include <vector>
+
+// Permit redefinition of SSLCLIENT_IOBUF_SIZE in sketch. Size of the I/O buffer built into EthernetSSLClient,
+// default is 2K. Set to 0 to leave it out, and supply the buffers with EthernetSSLClient::setBuffers()
+// or use EthernetSSLClientBuf. BearSSL needs at least 837 bytes (512 bytes records)
+#ifndef SSLCLIENT_IOBUF_SIZE
+  #define SSLCLIENT_IOBUF_SIZE    2048
+#endif
+
+// Permit redefinition of SSLCLIENT_WAIT_MAX_MS in sketch. Longest sleep, in ms, while waiting for data from
+// the server with the default wait strategy (SSL_WAIT_BACKOFF). Default is 10, the delay used before
+#ifndef SSLCLIENT_WAIT_MAX_MS
+  #define SSLCLIENT_WAIT_MAX_MS   10
+#endif
+
+// Permit redefinition of SSLCLIENT_RECORD_SMALL_LEN in sketch. Plaintext length of the records sent at the
+// start of a connection or after an idle time, with EthernetSSLClient::setRecordSizing(). Default is 1360,
+// so that a record with its header, MAC and padding fits one TCP segment of 1460 bytes
+#ifndef SSLCLIENT_RECORD_SMALL_LEN
+  #define SSLCLIENT_RECORD_SMALL_LEN    1360
+#elif (SSLCLIENT_RECORD_SMALL_LEN < 64)
+  #undef SSLCLIENT_RECORD_SMALL_LEN
+  #define SSLCLIENT_RECORD_SMALL_LEN    64
+
+  #warning SSLCLIENT_RECORD_SMALL_LEN reset to min 64 bytes
+#endif
+
+// Permit redefinition of SSLCLIENT_RECORD_RAMP_BYTES in sketch. Bytes sent in small records before
+// the records grow to the size of the output buffer. Default is 16K
+#ifndef SSLCLIENT_RECORD_RAMP_BYTES
+  #define SSLCLIENT_RECORD_RAMP_BYTES   16384UL
+#endif
+
+// Permit redefinition of SSLCLIENT_RECORD_IDLE_MS in sketch. Time without sending after which the records
+// are small again. Default is 1000 ms
+#ifndef SSLCLIENT_RECORD_IDLE_MS
+  #define SSLCLIENT_RECORD_IDLE_MS      1000UL
+#endif
+
+// Permit redefinition of SSLCLIENT_STATS in sketch. 1 to collect EthernetSSLClient::getStats() and call the
+// trace callback. Default is 0, which leaves them out of the build: no code, no RAM and no time
+#ifndef SSLCLIENT_STATS
+  #define SSLCLIENT_STATS               0
+#endif
+
+static_assert( (SSLCLIENT_IOBUF_SIZE == 0) || (SSLCLIENT_IOBUF_SIZE >= 837), "SSLCLIENT_IOBUF_SIZE must be 0 or at least 837");
 
 /**
    @brief The main SSLClient class.
@@ -81,6 +131,158 @@ class EthernetSSLClient : public Client
       SSL_DUMP = 4,
     };
 
+    /**
+       @brief What EthernetSSLClient does while BearSSL waits for a record and the socket has no data,
+       see EthernetSSLClient::setWaitStrategy().
+    */
+    enum WaitMode
+    {
+      /** delay() for the maximum wait time each time, as older versions did with 10ms */
+      SSL_WAIT_FIXED = 0,
+      /** yield() for the first polls, then delay() 1ms, doubled up to the maximum wait time */
+      SSL_WAIT_BACKOFF = 1,
+      /** Call the function given to EthernetSSLClient::setWaitCallback() */
+      SSL_WAIT_CALLBACK = 2
+    };
+
+    /**
+       @brief Called when waiting for data from the server, instead of sleeping.
+
+       @param client The socket EthernetSSLClient is waiting on
+       @param hint_ms The time SSL_WAIT_BACKOFF would sleep, 0 on the first polls. The function can
+       return earlier, e.g. when the Ethernet chip signals received data, or later.
+    */
+    typedef void (*WaitCallback)(Client& client, unsigned hint_ms);
+
+    /**
+       @brief State of the connection, as advanced by EthernetSSLClient::poll(), see EthernetSSLClient::state().
+    */
+    enum AsyncState
+    {
+      /** Not connected */
+      SSL_ASYNC_IDLE = 0,
+      /** TLS handshake in progress, after EthernetSSLClient::connectAsync() */
+      SSL_ASYNC_HANDSHAKE = 1,
+      /** Connected, data can be sent and received */
+      SSL_ASYNC_READY = 2,
+      /** Handshake or connection failed, see getWriteError() */
+      SSL_ASYNC_FAILED = 3
+    };
+
+    /**
+       @brief Time spent in the phases of the last connection, in microseconds.
+    */
+    struct HandshakeTiming
+    {
+      /** TCP connect, blocking in the Ethernet libraries */
+      unsigned long tcp_us;
+      /** From the start of the handshake (ClientHello) to the first byte from the server */
+      unsigned long first_byte_us;
+      /** Whole TLS handshake */
+      unsigned long handshake_us;
+      /** Part of the handshake spent in BearSSL (mostly crypto) and socket I/O, the rest is waiting for the server */
+      unsigned long engine_us;
+      /** Handshake bytes sent and received */
+      unsigned long bytes_out;
+      unsigned long bytes_in;
+      /** Number of EthernetSSLClient::poll() calls, or engine updates for connect() */
+      unsigned long polls;
+    };
+
+    /**
+       @brief Statistics of the last connection, see EthernetSSLClient::getStats(). Needs SSLCLIENT_STATS.
+
+       The phases are in microseconds from the start of connect() or connectAsync(), and are 0 if not reached,
+       e.g. the certificate and key exchange of a resumed session. The gaps between them show where a slow
+       connection spends its time: TCP connect, waiting for the server (up to the ServerHello), the chain
+       validation and ECDHE of the client (certificate to key exchange), and the server again (key exchange to
+       finished). wait_us tells how much of it was spent sleeping in the wait strategy.
+    */
+    struct Stats
+    {
+      /** TCP connected */
+      unsigned long tcp_us;
+      /** ServerHello received */
+      unsigned long server_hello_us;
+      /** Certificate of the server received, its validation starts */
+      unsigned long certificate_us;
+      /** ClientKeyExchange sent, the certificate was validated and the ECDHE key computed */
+      unsigned long key_exchange_us;
+      /** Finished of the server processed, the handshake is complete */
+      unsigned long finished_us;
+      /** The server resumed the session of the cache */
+      bool resumed;
+      /** Negotiated version and cipher suite, e.g. BR_TLS12 and BR_TLS_ECDHE_ECDSA_WITH_AES_128_GCM_SHA256 */
+      uint16_t version;
+      uint16_t cipher_suite;
+      /** Curve of the ECDHE key exchange, e.g. BR_EC_curve25519, 0 if none */
+      int curve;
+      /** Bytes and records sent and received on the socket, handshake included */
+      unsigned long bytes_out;
+      unsigned long bytes_in;
+      unsigned long records_out;
+      unsigned long records_in;
+      /** Time spent waiting for the server (delay() or the wait callback), in microseconds, and number of waits.
+          getWaitTime() and getWaitCount() count the same waits until resetWaitStats() */
+      unsigned long wait_us;
+      unsigned long wait_count;
+      /** BearSSL error (BR_ERR_*) which ended the connection, 0 if none */
+      int br_error;
+      /** getWriteError() when the connection failed, SSL_OK if none or if only BearSSL reported the failure */
+      int ssl_error;
+    };
+
+    /**
+       @brief Events of the trace callback, see EthernetSSLClient::setTraceCallback().
+    */
+    enum TraceEvent
+    {
+      /** TCP connected, Stats::tcp_us */
+      SSL_TRACE_TCP_CONNECTED = 0,
+      /** Stats::server_hello_us */
+      SSL_TRACE_SERVER_HELLO = 1,
+      /** Stats::certificate_us */
+      SSL_TRACE_CERTIFICATE = 2,
+      /** Stats::key_exchange_us */
+      SSL_TRACE_KEY_EXCHANGE = 3,
+      /** Handshake complete, Stats::finished_us */
+      SSL_TRACE_FINISHED = 4,
+      /** The connection failed, see Stats::br_error and Stats::ssl_error */
+      SSL_TRACE_FAILED = 5
+    };
+
+    /**
+       @brief Called at each event of a connection, with the time since the start of connect() in microseconds.
+
+       It runs within connect(), poll() and the other calls which advance the connection, so it should be short,
+       e.g. store the event, or print it if the time taken by Serial doesn't matter.
+    */
+    typedef void (*TraceCallback)(EthernetSSLClient& client, TraceEvent event, unsigned long us);
+
+    /**
+       @brief How BearSSL uses the I/O buffers, see EthernetSSLClient::setBuffers().
+    */
+    enum BufferMode
+    {
+      /** One buffer, used for incoming and outgoing records in turn (half-duplex) */
+      SSL_BUFFER_MONO = 0,
+      /** One buffer, split between incoming and outgoing records (full-duplex) */
+      SSL_BUFFER_BIDI = 1,
+      /** Separate input and output buffers (full-duplex) */
+      SSL_BUFFER_SPLIT = 2
+    };
+
+    /**
+       @brief Curves offered for the ECDHE key exchange, see EthernetSSLClient::setCurvePolicy().
+    */
+    enum CurvePolicy
+    {
+      /** X25519, P-256, P-384 and P-521, with the default EC implementation of BearSSL */
+      SSL_CURVES_ALL = 0,
+      /** X25519 and P-256 only, with the fastest implementations for the target (br_ec_x25519_p256) */
+      SSL_CURVES_X25519_P256 = 1
+    };
+
     /**
        @brief Initialize EthernetSSLClient with all of the prerequisites needed.
 
@@ -95,7 +297,8 @@ class EthernetSSLClient : public Client
        of the SSL server certificate. Check out TrustAnchors.md for more info.
        @param trust_anchors_num The number of objects in the trust_anchors array.
        @param analog_pin An analog pin to pull random bytes from, used in seeding the RNG.
-       @param max_sessions The maximum number of SSL sessions to store connection information from.
+       @param max_sessions 0 disables session resumption for this client. Sessions are otherwise stored
+       in SSLSessionCache::shared(), sized with SSLCLIENT_SESSION_CACHE_SIZE, see setSessionCache().
        @param debug The level of debug logging (use the ::DebugLevel enum).
     */
     explicit EthernetSSLClient( Client& client,
@@ -114,9 +317,10 @@ class EthernetSSLClient : public Client
 
        EthernetSSLClient::connect(host, port) should be preferred over this function,
        as verifying the domain name is a step in ensuring the certificate is
-       legitimate, which is important to the security of the device. Additionally,
-       SSL sessions cannot be resumed when using this function, which can drastically increase initial
-       connect time.
+       legitimate, which is important to the security of the device. If the server has a name,
+       set it with EthernetSSLClient::setServerNameOverride(), it is then sent to the server (SNI)
+       and verified in its certificate. Sessions are resumed from the session cache, keyed by IP
+       address, port and that name.
 
        This function initializes the socket by calling m_client::connect(IPAddress, uint16_t)
        with the parameters supplied, then once the socket is open, uses BearSSL to
@@ -199,6 +403,9 @@ class EthernetSSLClient : public Client
        can handle, data will be written to the network in pages the size of EthernetSSLClient::m_iobuf until
        all the data in buf is sent--attempting to keep all writes to the network grouped together. For information
        on why this is the case check out README.md .
+       With EthernetSSLClient::setRecordSizing(), the records are sent as soon as they hold SSLCLIENT_RECORD_SMALL_LEN
+       bytes at the start of a connection, and EthernetSSLClient::setAutoFlush() sends a record whose data has waited
+       too long.
 
        The implementation for this function can be found in EthernetSSLClient::write_impl(const uint8_t*, size_t)
 
@@ -282,6 +489,43 @@ class EthernetSSLClient : public Client
     */
     int peek() override;
 
+    /**
+       @brief Get a pointer into BearSSL's plaintext send buffer, to write data in place instead of copying it with write().
+
+       Write up to len bytes at the returned pointer, then call EthernetSSLClient::commit() with the number of bytes
+       written. As with write(), the data is sent when the buffer is full, or on flush().
+
+       @pre EthernetSSLClient is connected
+       @param len Set to the number of bytes which can be written, 0 on error
+       @returns The pointer, or nullptr if the connection failed
+    */
+    uint8_t* reserve(size_t* len);
+
+    /**
+       @brief Mark n bytes written at the pointer returned by EthernetSSLClient::reserve() as data to send.
+
+       @param n Number of bytes written, at most the length given by reserve()
+       @returns n, or 0 on error
+    */
+    size_t commit(const size_t n);
+
+    /**
+       @brief View the decrypted data received, to parse it in place instead of copying it with read().
+
+       The data stays valid until EthernetSSLClient::consume() or another call to EthernetSSLClient.
+
+       @param len Set to the number of bytes available, 0 if none
+       @returns A pointer to the data, or nullptr if none is available
+    */
+    const uint8_t* peekSpan(size_t* len);
+
+    /**
+       @brief Remove n bytes of the data returned by EthernetSSLClient::peekSpan().
+
+       @param n Number of bytes processed, at most the length given by peekSpan()
+    */
+    void consume(const size_t n);
+
     /**
        @brief Force writing the buffered bytes from EthernetSSLClient::write to the network.
 
@@ -294,13 +538,97 @@ class EthernetSSLClient : public Client
     /**
        @brief Close the connection
 
-       If the SSL session is still active, all incoming data is discarded and BearSSL will attempt to
-       close the session gracefully (will write to the network), and then call m_client::stop. If the session is not active or an
+       If the SSL session is still active, the buffered data is sent (without waiting for an answer), all incoming
+       data is discarded and BearSSL will attempt to close the session gracefully (will write to the network), and
+       then call m_client::stop. If the session is not active or an
        error was encountered previously, this function will simply call m_client::stop.
        The implementation for this function can be found in EthernetSSLClient::peek.
     */
     void stop() override;
 
+    /**
+       @brief Start a connection without waiting for the TLS handshake.
+
+       The TCP connection is opened as by connect(), which blocks in the Ethernet libraries (a few ms on a LAN),
+       then the handshake is advanced by EthernetSSLClient::poll() until state() is SSL_ASYNC_READY or
+       SSL_ASYNC_FAILED. The handshake fails if it isn't complete after getTimeout().
+
+       @returns 1 if the handshake started, 0 on failure
+    */
+    int connectAsync(const char *host, uint16_t port);
+    int connectAsync(IPAddress ip, uint16_t port);
+
+    /**
+       @brief Advance the connection as far as the socket permits, without waiting for the server.
+
+       During the handshake, process what the server sent and send what BearSSL has to. Once connected, send
+       complete records and decrypt received ones, without sending the partial record of write() or writeSome().
+
+       @returns The new state
+    */
+    AsyncState poll();
+
+    /** @brief State of the connection, see EthernetSSLClient::AsyncState */
+    AsyncState state() const
+    {
+      return m_async_state;
+    }
+
+    /**
+       @brief Write what fits in BearSSL's send buffer without waiting, as opposed to write().
+
+       A full buffer is encrypted and sent as a record, the rest stays buffered until the next writeSome(),
+       flushAsync() or flush().
+
+       @returns The number of bytes taken, 0 if the engine can't take data now (e.g. received data must be read
+       first with a mono buffer) or on error
+    */
+    size_t writeSome(const uint8_t *buf, size_t size);
+
+    /**
+       @brief Send the buffered data as a record, without waiting for the server to answer as flush() does.
+
+       @returns true once all the data has been handed to the socket (or on error, see getWriteError())
+    */
+    bool flushAsync();
+
+    /** @brief Timing of the phases of the last connection */
+    const HandshakeTiming& getHandshakeTiming() const
+    {
+      return m_hs_timing;
+    }
+
+    /**
+       @brief Statistics of the last connection, or of the current one so far.
+
+       They are only collected when SSLCLIENT_STATS is defined as 1 before the library is included, all zero
+       otherwise. They are reset by connect() and connectAsync(), and kept after stop().
+    */
+    const Stats& getStats() const
+    {
+#if SSLCLIENT_STATS
+      return m_stats;
+#else
+      static const Stats none = Stats();
+
+      return none;
+#endif
+    }
+
+    /**
+       @brief Call callback at each phase of the handshake, and when a connection fails. Needs SSLCLIENT_STATS.
+
+       @param callback The function to call, nullptr to stop
+    */
+    void setTraceCallback(TraceCallback callback)
+    {
+#if SSLCLIENT_STATS
+      m_trace_callback = callback;
+#else
+      (void) callback;
+#endif
+    }
+
     /**
        @brief Check if the device is connected.
 
@@ -331,39 +659,78 @@ class EthernetSSLClient : public Client
     void setMutualAuthParams(const SSLClientParameters& params);
 
     /**
-       @brief Gets a session reference corresponding to a host and IP, or a reference to a empty session if none exist
-
-       If no session corresponding to the host and IP exist, then this function will cycle through
-       sessions in a rotating order. This allows the session cache to continually store sessions,
-       however it will also result in old sessions being cleared and returned. In general, it is a
-       good idea to use a SessionCache size equal to the number of domains you plan on connecting to.
+       @brief Gets the session stored for a host and port in the session cache
 
-       The implementation for this function can be found at EthernetSSLClient::get_session_impl.
+       The session is marked as the most recently used. The pointer is only valid until the
+       next connection of a client using the same cache.
 
        @param host A hostname c string, or NULL if one is not available
-       @param addr An IP address
+       @param port The server port
        @returns A pointer to the SSLSession, or NULL of none matched the criteria available
     */
-    SSLSession* getSession(const char* host);
+    SSLSession* getSession(const char* host, const uint16_t port = 443);
 
     /**
-       @brief Clear the session corresponding to a host and IP
-
-       The implementation for this function can be found at EthernetSSLClient::remove_session_impl.
+       @brief Clear the session corresponding to a host and port
 
        @param host A hostname c string, or nullptr if one is not available
-       @param addr An IP address
+       @param port The server port
     */
-    void removeSession(const char* host);
+    void removeSession(const char* host, const uint16_t port = 443);
+
+    /** @brief Gets the session stored for an IP address connection, with the current server name override */
+    SSLSession* getSession(const IPAddress& ip, const uint16_t port);
+
+    /** @brief Clear the session of an IP address connection, with the current server name override */
+    void removeSession(const IPAddress& ip, const uint16_t port);
 
     /**
-       @brief Get the maximum number of SSL sessions that can be stored at once
+       @brief Set the server name of connections by IP address
 
-        @returns The SessionCache template parameter.
+       connect(IPAddress, uint16_t) then sends the name to the server (SNI) and checks it in the
+       server certificate, as connect(const char*, uint16_t) does with the hostname, e.g. for a
+       broker without DNS entry whose certificate is issued to "broker.local".
+
+       @param name The server name, copied, or nullptr to connect without checking the name (the default)
+    */
+    void setServerNameOverride(const char* name)
+    {
+      m_server_name = name ? name : "";
+    }
+
+    /** @brief The server name of connections by IP address, nullptr if none */
+    const char* getServerNameOverride() const
+    {
+      return m_server_name.length() ? m_server_name.c_str() : nullptr;
+    }
+
+    /**
+       @brief Get the number of SSL sessions stored in the session cache
+
+        @returns The number of sessions, 0 if session resumption is disabled
     */
     size_t getSessionCount() const
     {
-      return m_sessions.size();
+      return m_session_cache ? m_session_cache->size() : 0;
+    }
+
+    /**
+       @brief Use another session cache than SSLSessionCache::shared()
+
+       Clients connecting to servers which shouldn't see each other's sessions, or with
+       different trust anchors, can be given their own cache.
+
+       @param cache The cache, which must outlive the client, or nullptr to disable session resumption
+    */
+    void setSessionCache(SSLSessionCache* cache)
+    {
+      m_session_cache = cache;
+    }
+
+    /** @brief The session cache used by this client, nullptr if session resumption is disabled */
+    SSLSessionCache* getSessionCache() const
+    {
+      return m_session_cache;
     }
 
     /**
@@ -414,6 +781,336 @@ class EthernetSSLClient : public Client
 
     void setVerificationTime(uint32_t days, uint32_t seconds);
 
+    /**
+      @brief Find the trust anchors by binary search instead of comparing each of them to every certificate.
+
+      For large sets of trust anchors, generate the header with pycert_bearssl --index, which sorts the
+      anchors and emits the index array (TAs_INDEX by default), then call
+      setTrustAnchorIndex(TAs_INDEX, sizeof TAs_INDEX). The index is checked against the trust
+      anchors given to the constructor, which costs one SHA-256 per anchor.
+
+      @param index BR_X509_TA_INDEX_LEN bytes per trust anchor, or nullptr to search them all
+      @param index_len Size of index in bytes, which must be BR_X509_TA_INDEX_LEN times the number of trust anchors
+      @returns false if the index doesn't match the trust anchors, which are then all searched
+    */
+    bool setTrustAnchorIndex(const unsigned char* index, const size_t index_len);
+
+    /**
+      @brief Skip the validation of the certificate chain when the server presents the same certificate again.
+
+      After a full validation, the SHA-256 of the server certificate is remembered. A later handshake with
+      the same server name whose certificate has the same SHA-256 only checks that certificate (name, dates,
+      key), without verifying the signatures of its chain, which saves one RSA or ECDSA verification per
+      certificate. See SSLCertificatePin.
+
+      @param enable true to enable pinning, false to validate every chain (the default)
+      @param revalidate_ms The time after which the chain is validated again, default SSLCLIENT_PIN_REVALIDATE_MS (24h)
+      @pre EthernetSSLClient is not connected
+    */
+    void setCertificatePinning(const bool enable, const unsigned long revalidate_ms = SSLCLIENT_PIN_REVALIDATE_MS);
+
+    /** @brief Forget the pinned certificate, so that the next handshake validates the chain */
+    void clearCertificatePin()
+    {
+      m_cert_pin.clear();
+    }
+
+    /** @brief true if the certificate of the last handshake was validated with the pin */
+    bool isCertificatePinned() const
+    {
+      return m_cert_pin.lastWasPinned();
+    }
+
+    /**
+      @brief Take the ECDHE key pairs of the handshakes from a pool filled in idle time.
+
+      The public point of the client key pair is then not computed during the handshake, which saves
+      one of the two EC multiplications of the ECDHE key exchange. Call SSLKeyPool::refill() from loop() to keep
+      the pool full; a pool can be shared by several clients. See SSLKeyPool.
+
+      @param pool The pool, which must outlive the client, or nullptr to generate the key pairs inline
+    */
+    void setKeyPool(SSLKeyPool* pool)
+    {
+      m_key_pool = pool;
+      br_ssl_client_set_ecdhe_source(&m_sslctx, pool ? pool->source() : nullptr);
+    }
+
+    /** @brief The key pool used by this client, nullptr if none */
+    SSLKeyPool* getKeyPool() const
+    {
+      return m_key_pool;
+    }
+
+    /**
+      @brief Use the BearSSL implementations chosen by SSLCryptoProfile::calibrate() instead of the default ones.
+
+      Call it before setMutualAuthParams(), which signs with the EC implementation of the client.
+
+      @param profile The calibrated or restored profile, which is only read during the call
+      @pre EthernetSSLClient is not connected
+    */
+    void setCryptoProfile(const SSLCryptoProfile& profile)
+    {
+      profile.apply(&m_sslctx, &m_x509ctx);
+    }
+
+    /**
+      @brief Choose the curves offered to the server for the ECDHE key exchange.
+
+      BearSSL offers X25519 first, then P-256, P-384 and P-521. A server which prefers its own order may still
+      pick P-384 or P-521, whose generic code takes several times longer than X25519 on a Cortex-M.
+      SSL_CURVES_X25519_P256 only offers X25519 and P-256, with the fastest implementations for the target.
+      The certificate chain is still verified with the EC implementation of the X.509 engine, so CAs with
+      P-384 keys are accepted, but the server certificate, if EC, must be on P-256, as must a client certificate
+      of setMutualAuthParams().
+
+      Call it after setCryptoProfile(), which sets the EC implementation as well. SSL_CURVES_ALL, the initial
+      policy, goes back to the implementation in use before SSL_CURVES_X25519_P256, the one of the profile or
+      the default of BearSSL.
+
+      @param policy See EthernetSSLClient::CurvePolicy
+      @pre EthernetSSLClient is not connected
+    */
+    void setCurvePolicy(const CurvePolicy policy);
+
+    /**
+       @brief Use buf as the I/O buffer of BearSSL, instead of the built-in one.
+
+       The largest TLS record needs BR_SSL_BUFSIZE_MONO (16709) bytes for receiving. A server sending
+       larger records than the buffer can take fails the connection, unless it honours the maximum
+       fragment length extension, which BearSSL requests from the buffer size. Larger buffers also
+       mean fewer records, and higher throughput. The smallest usable buffer is 837 bytes (mono) or
+       1434 bytes (bidi).
+
+       The buffer must stay valid for the lifetime of EthernetSSLClient.
+
+       @pre EthernetSSLClient is not connected.
+       @param buf The buffer
+       @param len Its length, in bytes
+       @param mode SSL_BUFFER_MONO or SSL_BUFFER_BIDI. If not given, the buffer is bidi if it is
+       larger than BR_SSL_BUFSIZE_MONO, as for the built-in buffer.
+       @returns false if the buffer is too small or EthernetSSLClient is connected
+    */
+    bool setBuffers(unsigned char* buf, const size_t len, const BufferMode mode);
+    bool setBuffers(unsigned char* buf, const size_t len);
+
+    /**
+       @brief Use separate input and output buffers (full-duplex).
+
+       Optimal sizes are BR_SSL_BUFSIZE_INPUT and BR_SSL_BUFSIZE_OUTPUT, outgoing records are sized to
+       fit the output buffer.
+
+       @pre EthernetSSLClient is not connected.
+       @returns false if a buffer is too small or EthernetSSLClient is connected
+    */
+    bool setBuffers(unsigned char* ibuf, const size_t ilen, unsigned char* obuf, const size_t olen);
+
+    /**
+       @brief Take the I/O buffer from a pool for each connection, instead of keeping one.
+
+       The buffer is taken at connect() and given back at stop(). With idle_ms, it is also given back once the
+       connection has neither sent nor received a record for idle_ms, at a point where BearSSL holds no data:
+       no partial record, nothing to send and nothing unread. The connection stays open, and takes a buffer
+       again when the sketch writes or the server sends something, checked by available() and poll(). Until
+       a buffer is free, available() returns 0 and write() fails, the data of the server waits in the socket.
+       See SSLBufferPool.
+
+       Don't call available() or poll() between reserve() and commit() with an idle time.
+
+       @param pool The pool, which must outlive the client, or nullptr to use the buffers of setBuffers()
+       @param idle_ms Time after which an idle connection gives its buffer back, 0 to keep it until stop()
+       @pre EthernetSSLClient is not connected.
+       @returns false if EthernetSSLClient is connected
+    */
+    bool setBufferPool(SSLBufferPool* pool, const unsigned long idle_ms = 0);
+
+    /** @brief true while the connection is open but has given its buffer back to the pool */
+    bool isBufferParked() const
+    {
+      return m_parked;
+    }
+
+    /** @brief Size of the buffer for incoming records, in bytes. The same buffer is used for output in mono mode */
+    size_t getInputBufferSize() const
+    {
+      return m_ibuf_len;
+    }
+
+    /** @brief Size of the buffer for outgoing records, in bytes */
+    size_t getOutputBufferSize() const
+    {
+      return m_obuf_len;
+    }
+
+    /** @brief Current EthernetSSLClient::BufferMode */
+    BufferMode getBufferMode() const
+    {
+      return m_buf_mode;
+    }
+
+    /**
+       @brief Set how EthernetSSLClient waits for data from the server.
+
+       The handshake, connected(), available(), read() and flush() all poll the socket until BearSSL
+       has a full record. Sleeping between polls spares the Ethernet chip's bus, but adds up to the
+       sleep time to every round trip. SSL_WAIT_BACKOFF, the default, only sleeps once the data is
+       late, and then longer and longer.
+
+       @param mode See EthernetSSLClient::WaitMode
+       @param max_ms Longest sleep in ms, the fixed sleep of SSL_WAIT_FIXED
+    */
+    void setWaitStrategy(const WaitMode mode, const unsigned max_ms = SSLCLIENT_WAIT_MAX_MS)
+    {
+      m_wait_mode   = mode;
+      m_wait_max_ms = max_ms;
+    }
+
+    /** @brief Use a wait callback (SSL_WAIT_CALLBACK), e.g. to run other tasks or wake on a socket interrupt */
+    void setWaitCallback(WaitCallback callback)
+    {
+      m_wait_callback = callback;
+      m_wait_mode     = callback ? SSL_WAIT_CALLBACK : SSL_WAIT_BACKOFF;
+    }
+
+    /** @brief Total time spent waiting for data from the server, in microseconds */
+    unsigned long getWaitTime() const
+    {
+      return m_wait_us;
+    }
+
+    /** @brief Number of times EthernetSSLClient waited for data from the server */
+    unsigned long getWaitCount() const
+    {
+      return m_wait_count;
+    }
+
+    /**
+       @brief Send small records while a connection is interactive, and full size records for bulk data.
+
+       By default, write() fills the output buffer before it makes a record, and a smaller record is only
+       sent by flush() or available(). With adaptive sizing, a record is sent as soon as it holds small_len
+       bytes, until ramp_bytes have been sent; the records then grow to the size of the output buffer. After
+       idle_ms without sending, the records are small again. The first bytes of a request or of a control
+       packet then leave in one TCP segment, which the server can decrypt without waiting for the next one,
+       while uploads still use the largest records.
+
+       @param adaptive true to enable adaptive sizing, false to always fill the buffer (the default)
+       @param small_len Largest plaintext of the small records, default SSLCLIENT_RECORD_SMALL_LEN
+       @param ramp_bytes Bytes sent in small records before they grow, default SSLCLIENT_RECORD_RAMP_BYTES
+       @param idle_ms Time without sending after which the records are small again, default SSLCLIENT_RECORD_IDLE_MS
+    */
+    void setRecordSizing(const bool adaptive, const size_t small_len = SSLCLIENT_RECORD_SMALL_LEN,
+                         const unsigned long ramp_bytes = SSLCLIENT_RECORD_RAMP_BYTES,
+                         const unsigned long idle_ms = SSLCLIENT_RECORD_IDLE_MS)
+    {
+      m_rec_adaptive  = adaptive;
+      m_rec_small_len = small_len ? small_len : 1;
+      m_rec_ramp      = ramp_bytes;
+      m_rec_idle_ms   = idle_ms;
+    }
+
+    /**
+       @brief Send a partially filled record once its first byte has waited flush_ms.
+
+       The timer is checked by write(), available() and poll(), so a sketch which writes a few bytes and
+       goes on with loop() doesn't need to call flush(), which waits for the server.
+
+       @param flush_ms The longest time written data is held, 0 to disable (the default)
+    */
+    void setAutoFlush(const unsigned long flush_ms)
+    {
+      m_flush_ms = flush_ms;
+    }
+
+    /**
+       @brief Hold the written data until uncork(), so that a burst of small writes leaves in one record.
+
+       While corked, a partially filled record isn't sent by available(), poll() or the auto-flush timer, and
+       small records (see setRecordSizing()) grow to the size of the buffer. Records which fill the buffer
+       are still written to the socket, but the socket is only flushed (a SEND on W5x00) by uncork(). flush()
+       and flushAsync() close the record and write it to the socket, but don't flush the socket either.
+       Calls nest, the last uncork() sends what is held. stop() and connect() reset the nesting.
+    */
+    void cork()
+    {
+      m_cork_depth++;
+    }
+
+    /** @brief Send the data held since cork() as one record, and flush the socket, without waiting for the server */
+    void uncork();
+
+    /** @brief true between cork() and the matching uncork() */
+    bool isCorked() const
+    {
+      return m_cork_depth > 0;
+    }
+
+    /**
+       @brief cork() or uncork() a Client which is an EthernetSSLClient, e.g. for EthernetHttpClient::setCorkCallback()
+
+       @param client An EthernetSSLClient
+       @param corked true to cork(), false to uncork()
+    */
+    static void corkClient(Client& client, const bool corked)
+    {
+      EthernetSSLClient& ssl = static_cast<EthernetSSLClient&>(client);
+
+      if (corked)
+        ssl.cork();
+      else
+        ssl.uncork();
+    }
+
+    /** @brief Number of records of application data sent since connect() */
+    unsigned long getRecordsSent() const
+    {
+      return m_rec_count;
+    }
+
+    /** @brief Reset the wait time and count */
+    void resetWaitStats()
+    {
+      m_wait_us     = 0;
+      m_wait_count  = 0;
+    }
+
+    /**
+       @brief Ask the server for records of at most len bytes of plaintext (Maximum Fragment Length, RFC 6066).
+
+       BearSSL always requests the largest of 512, 1024, 2048 or 4096 bytes which fits the I/O buffers, so
+       that incoming records match them, e.g. 1024 with the default 2K mono buffer. This lowers the request
+       further, and caps outgoing records at len as the extension requires. A server which ignores the
+       extension (many do) can still send full size records, which fail the connection with
+       BR_ERR_TOO_LARGE unless the input buffer is BR_SSL_BUFSIZE_INPUT bytes.
+
+       The smallest buffers for a given length are EthernetSSLClient::inputBufferSize(len) and
+       EthernetSSLClient::outputBufferSize(len), e.g. 1349 bytes mono for 1024 bytes records.
+
+       @pre EthernetSSLClient is not connected.
+       @param len 512, 1024, 2048 or 4096, or 0 to only use the length derived from the buffers
+       @returns false if len isn't valid or EthernetSSLClient is connected
+    */
+    bool setMaxFragmentLength(const size_t len);
+
+    /** @brief Maximum plaintext length requested from the server, 16384 if the extension isn't sent */
+    size_t getMaxFragmentLength() const
+    {
+      return (size_t) 1 << m_sslctx.eng.log_max_frag_len;
+    }
+
+    /** @brief Smallest input (or mono) buffer for records of max_frag_len bytes of plaintext */
+    static constexpr size_t inputBufferSize(const size_t max_frag_len)
+    {
+      return max_frag_len + (BR_SSL_BUFSIZE_INPUT - 16384);
+    }
+
+    /** @brief Smallest output buffer for records of max_frag_len bytes of plaintext */
+    static constexpr size_t outputBufferSize(const size_t max_frag_len)
+    {
+      return max_frag_len + (BR_SSL_BUFSIZE_OUTPUT - 16384);
+    }
+
   private:
     /** @brief Returns an instance of m_client that is polymorphic and can be used by EthernetSSLClient */
     Client& get_arduino_client()
@@ -434,8 +1131,42 @@ class EthernetSSLClient : public Client
     int m_run_until(const unsigned target);
     /** proxy for available that returns the state */
     unsigned m_update_engine();
-    /** utility function to find a session index based off of a host and IP */
-    int m_get_session_index(const char* host) const;
+    /** give the I/O buffers to BearSSL, obuf is nullptr in mono mode */
+    bool m_set_buffers(unsigned char* ibuf, const size_t ilen, unsigned char* obuf, const size_t olen, const BufferMode mode);
+    /** seed and reset the engine for a connection on the connected client */
+    int m_begin_ssl(const char* host, SSLSession* ssl_ses);
+    /** complete a connection after the handshake, and save the session */
+    void m_end_ssl(const char* host);
+    /** mark the handshake or connection as failed */
+    void m_fail_async(const char* msg, const char* func_name);
+    /** wait for data from the server, as set by setWaitStrategy() */
+    void m_wait_for_data();
+    /** bytes written but not yet sent in a record, in m_write_idx and in the engine */
+    size_t m_record_pending() const;
+    /** room left in the current record for write(), out of the alen bytes given by the engine */
+    size_t m_record_room(const size_t alen);
+    /** close the current record, so that m_update_engine() sends it */
+    void m_send_record();
+    /** send the current record if its first byte has waited m_flush_ms */
+    void m_auto_flush();
+    /** take a buffer from m_buf_pool for a new connection */
+    bool m_acquire_buffer(const char* func_name);
+    /** give the buffer back to m_buf_pool at the end of a connection */
+    void m_release_buffer();
+    /** give the buffers in use before m_acquire_buffer() back to the engine */
+    void m_restore_buffers();
+    /** give the buffer back to m_buf_pool if the connection is idle between records */
+    void m_park_if_idle();
+    /** take a buffer again for a parked connection */
+    bool m_unpark(const char* func_name);
+    /** start the statistics of a connection, see getStats() */
+    void m_stats_begin();
+    /** record an event at the current time, and call the trace callback */
+    void m_stats_event(const TraceEvent event);
+    /** follow bytes written to (out) or read from the socket */
+    void m_stats_io(const bool out, const unsigned char* buf, const size_t len);
+    /** record the failure of the connection, once */
+    void m_stats_fail(const int br_error);
 
     /** @brief Prints a debugging prefix to all logs, so we can attatch them to useful information */
     void m_print_prefix(const char* func_name, const DebugLevel level) const;
@@ -488,10 +1219,14 @@ class EthernetSSLClient : public Client
     // create a reference the client
     Client& m_client;
 
-    // also store an array of SSLSessions, so we can resume communication with multiple websites
-    std::vector<SSLSession> m_sessions;
-    // as well as the maximmum number of sessions we can store
-    const size_t m_max_sessions;
+    // sessions, so we can resume communication with multiple websites, shared with the other clients by default
+    SSLSessionCache* m_session_cache;
+    // port and IP address of the connection, part of the session key, the IP address only if connected by IP address
+    uint16_t m_port;
+    IPAddress m_ip;
+    bool m_by_ip;
+    // server name of connections by IP address, see setServerNameOverride()
+    String m_server_name;
     // store the pin to fetch an RNG see from
     //const int m_analog_pin;
     // store whether to enable debug logging
@@ -503,6 +1238,12 @@ class EthernetSSLClient : public Client
     // store the context values required for SSL
     br_ssl_client_context m_sslctx;
     br_x509_minimal_context m_x509ctx;
+    // validation with the pinned certificate, wrapping m_x509ctx
+    SSLCertificatePin m_cert_pin;
+    // precomputed ECDHE key pairs, see setKeyPool()
+    SSLKeyPool* m_key_pool;
+    // EC implementation replaced by SSL_CURVES_X25519_P256, see setCurvePolicy()
+    const br_ec_impl* m_ec_all;
     // use a mono-directional buffer by default to cut memory in half
     // can expand to a bi-directional buffer with maximum of BR_SSL_BUFSIZE_BIDI
     // or shrink to below BR_SSL_BUFSIZE_MONO, and bearSSL will adapt automatically
@@ -517,16 +1258,116 @@ class EthernetSSLClient : public Client
        connection.
     */
     // KH test increase
-    unsigned char m_iobuf[2048];
-    //unsigned char m_iobuf[4096];
+#if (SSLCLIENT_IOBUF_SIZE > 0)
+    unsigned char m_iobuf[SSLCLIENT_IOBUF_SIZE];
+#endif
     //////
 
+    // the buffers given to BearSSL, m_iobuf or those from setBuffers()
+    unsigned char* m_ibuf;
+    unsigned char* m_obuf;
+    size_t m_ibuf_len;
+    size_t m_obuf_len;
+    BufferMode m_buf_mode;
+    // requested Maximum Fragment Length, 0 if derived from the buffers
+    size_t m_max_frag_len;
+    // buffers lent by a pool, see setBufferPool()
+    SSLBufferPool* m_buf_pool;
+    unsigned long m_pool_idle_ms;
+    // holding a buffer of the pool, or given back while the connection is idle
+    bool m_pool_held;
+    bool m_parked;
+    // the buffers in use before the pool lent one, given back to BearSSL with it
+    unsigned char* m_own_ibuf;
+    unsigned char* m_own_obuf;
+    size_t m_own_ibuf_len;
+    size_t m_own_obuf_len;
+    BufferMode m_own_buf_mode;
+    // offset of the output buffer in a bidi buffer, kept while parked
+    size_t m_obuf_off;
+    // time of the last record sent or received
+    unsigned long m_last_io;
+
     // store the index of where we are writing in the buffer
     // so we can send our records all at once to prevent
     // weird timing issues
     size_t m_write_idx;
+    // adaptive record sizing, see setRecordSizing()
+    bool m_rec_adaptive;
+    size_t m_rec_small_len;
+    unsigned long m_rec_ramp;
+    unsigned long m_rec_idle_ms;
+    // bytes sent since the connection started or was last idle, records sent, time of the last one
+    unsigned long m_rec_sent;
+    unsigned long m_rec_count;
+    unsigned long m_rec_last;
+    // auto-flush, see setAutoFlush(), and when the first byte of the current record was written
+    unsigned long m_flush_ms;
+    unsigned long m_pending_since;
+    // nesting of cork(), and records written to the socket since its last flush
+    unsigned m_cork_depth;
+    bool m_unflushed;
     // store the last BearSSL state so we can print changes to the console
     unsigned m_br_last_state;
+    // wait strategy and instrumentation
+    WaitMode m_wait_mode;
+    unsigned m_wait_max_ms;
+    WaitCallback m_wait_callback;
+    // consecutive waits without data, for the backoff
+    unsigned m_wait_streak;
+    unsigned long m_wait_us;
+    unsigned long m_wait_count;
+    // non-blocking connection
+    AsyncState m_async_state;
+    bool m_async_connect;
+    // set during poll() so that m_update_engine() doesn't wait for data
+    bool m_no_wait;
+    String m_async_host;
+    unsigned long m_hs_start;
+    HandshakeTiming m_hs_timing;
+#if SSLCLIENT_STATS
+    // statistics and trace, see getStats()
+    Stats m_stats;
+    TraceCallback m_trace_callback;
+    unsigned long m_stats_start;
+    SSLRecordTrace m_trace_out;
+    SSLRecordTrace m_trace_in;
+    // a ServerKeyExchange was received, the engine then has the ECDHE curve
+    bool m_stats_skx;
+    bool m_stats_failed;
+#endif
+};
+
+/**
+   @brief EthernetSSLClient with its own I/O buffers, sized at compile time.
+
+   EthernetSSLClientBuf<BR_SSL_BUFSIZE_MONO> accepts full size records, EthernetSSLClientBuf<BR_SSL_BUFSIZE_INPUT,
+   BR_SSL_BUFSIZE_OUTPUT> is full-duplex with separate buffers. If OUT_SIZE is 0, the buffer is mono, or bidi if
+   IN_SIZE is larger than BR_SSL_BUFSIZE_MONO. Define SSLCLIENT_IOBUF_SIZE as 0 so that the built-in buffer
+   isn't allocated as well.
+*/
+template<size_t IN_SIZE, size_t OUT_SIZE = 0>
+class EthernetSSLClientBuf : public EthernetSSLClient
+{
+  public:
+    explicit EthernetSSLClientBuf(Client& client,
+                                  const br_x509_trust_anchor *trust_anchors,
+                                  const size_t trust_anchors_num,
+                                  const size_t max_sessions = 1,
+                                  const DebugLevel debug = SSL_WARN)
+      : EthernetSSLClient(client, trust_anchors, trust_anchors_num, max_sessions, debug)
+    {
+      if (OUT_SIZE)
+        setBuffers(m_inbuf, IN_SIZE, m_outbuf, OUT_SIZE);
+      else
+        setBuffers(m_inbuf, IN_SIZE);
+    }
+
+  private:
+    static_assert(IN_SIZE >= 837, "EthernetSSLClientBuf: IN_SIZE must be at least 837");
+
+    unsigned char m_inbuf[IN_SIZE];
+    unsigned char m_outbuf[OUT_SIZE ? OUT_SIZE : 1];
 };
 
 #endif  // SSL_CLIENT_H
@@ -107,27 +107,34 @@ static std::vector<char> make_vector_pem(const char* data, const size_t len)
 
 /**
    Use the br_skey api family to decode a private key into the important numbers.
-   This function supports both RSA and EC private keys, and returns a context
+   This function supports both RSA and EC private keys, and fills a context
    which can be used by BearSSL later to authenticate with mTLS.
+   @param out context used by BearSSL to store information about the keys. You can
+   use the br_skey_* family of APIs to access information from this context. The
+   decoded key points into it, so it is filled in place rather than returned.
    @param der DER encoded certificate, as a vector of bytes.
-   @returns context used by BearSSL to store information about the keys. You can
-   use the br_skey_* family of APIs to access information from this context.
 */
-static br_skey_decoder_context make_key_from_der(const std::vector<char>& der)
+static void make_key_from_der(br_skey_decoder_context* out, const std::vector<char>& der)
 {
-  br_skey_decoder_context out;
-  br_skey_decoder_init(&out);
-  br_skey_decoder_push(&out, der.data(), der.size());
-
-  return out;
+  br_skey_decoder_init(out);
+  br_skey_decoder_push(out, der.data(), der.size());
 }
 
 /* See SSLClientParams.h */
 SSLClientParameters::SSLClientParameters(const char* cert, const size_t cert_len, const char* key, const size_t key_len,
                                          bool is_der)
-  : m_cert(is_der ? std::vector<char>(cert, cert + cert_len) : make_vector_pem(cert, cert_len))
+  : m_blob(nullptr)
+  , m_cert(is_der ? std::vector<char>(cert, cert + cert_len) : make_vector_pem(cert, cert_len))
   , m_cert_struct{ const_cast<unsigned char*>(reinterpret_cast<const unsigned char*>(m_cert.data())), m_cert.size() }
-  , m_key_struct( make_key_from_der( is_der ? std::vector<char>(key, key + key_len) : make_vector_pem(key, key_len) ) )
+{
+  make_key_from_der(&m_key_struct, is_der ? std::vector<char>(key, key + key_len) : make_vector_pem(key, key_len));
+}
+
+/* See SSLClientParams.h */
+SSLClientParameters::SSLClientParameters(const SSLClientBlob& blob)
+  : m_blob(&blob)
+  , m_cert()
+  , m_cert_struct{ nullptr, 0 }
 {}
 
 /* See SSLClientParams.h */
@@ -143,3 +150,9 @@ SSLClientParameters SSLClientParameters::fromDER(const char* cert_der, const siz
 {
   return SSLClientParameters(cert_der, cert_len, key_der, key_len, true);
 }
+
+/* See SSLClientParams.h */
+SSLClientParameters SSLClientParameters::fromBlob(const SSLClientBlob& blob)
+{
+  return SSLClientParameters(blob);
+}
@@ -32,6 +32,25 @@
 #undef max
 #include <vector>
 
+/**
+   @brief A client certificate and its private key, already decoded, for SSLClientParameters::fromBlob().
+
+   Generate it from the PEM files with `pycert_bearssl.py mtls`. The generated header defines the DER
+   certificate and the numbers of the key as const arrays, and a const SSLClientBlob which points to
+   them, so that all of it stays in flash.
+*/
+struct SSLClientBlob
+{
+  /** The DER encoded certificate */
+  br_x509_certificate cert;
+  /** BR_KEYTYPE_EC or BR_KEYTYPE_RSA */
+  int                 key_type;
+  /** The private key, if key_type is BR_KEYTYPE_EC */
+  br_ec_private_key   ec;
+  /** The private key, if key_type is BR_KEYTYPE_RSA */
+  br_rsa_private_key  rsa;
+};
+
 /**
    @brief This class stores data required for SSLClient to use mutual authentication.
 
@@ -113,36 +132,61 @@ class SSLClientParameters
     static SSLClientParameters fromDER(const char* cert_der, const size_t cert_len, const char* key_der,
                                        const size_t key_len);
 
+    /**
+       @brief Create mutual authentication parameters from a certificate and private key decoded ahead of time
+
+       fromPEM() and fromDER() copy the certificate to the heap and decode the private key each time the
+       firmware boots. The blob was decoded on the host by `pycert_bearssl.py mtls`, and this function only
+       references it: nothing is parsed, copied or allocated, and the certificate and key stay in flash.
+
+       The blob must stay accessible for as long as the parameters are used, which a const global
+       such as the generated one does. As with fromDER(), an invalid blob isn't reported, and SSLClient
+       then falls back to regular TLS.
+
+       @param blob The certificate and key, generated by `pycert_bearssl.py mtls`
+       @return An SSLClientParameters context, to be used with SSLClient::setMutualAuthParams.
+    */
+    static SSLClientParameters fromBlob(const SSLClientBlob& blob);
+
     /** mTLS information used by SSLClient during authentication */
     const br_x509_certificate* getCertChain() const
     {
-      return &m_cert_struct;
+      return m_blob ? &m_blob->cert : &m_cert_struct;
     }
 
     /** mTLS information used by SSLClient during authentication */
     int getCertType() const
     {
-      return br_skey_decoder_key_type(&m_key_struct);
+      return m_blob ? m_blob->key_type : br_skey_decoder_key_type(&m_key_struct);
     }
 
     /** mTLS information used by SSLClient during authentication */
     const br_ec_private_key* getECKey() const
     {
+      if (m_blob)
+        return (m_blob->key_type == BR_KEYTYPE_EC && m_blob->ec.x != NULL) ? &m_blob->ec : NULL;
+
       return br_skey_decoder_get_ec(&m_key_struct);
     }
 
     /** mTLS information used by SSLClient during authentication */
     const br_rsa_private_key* getRSAKey() const
     {
+      if (m_blob)
+        return (m_blob->key_type == BR_KEYTYPE_RSA && m_blob->rsa.p != NULL) ? &m_blob->rsa : NULL;
+
       return br_skey_decoder_get_rsa(&m_key_struct);
     }
 
   protected:
     SSLClientParameters(const char* cert, const size_t cert_len, const char* key, const size_t key_len, bool is_der);
+    explicit SSLClientParameters(const SSLClientBlob& blob);
 
   private:
+    // set by fromBlob(), m_cert is then empty and m_key_struct is left undecoded
+    const SSLClientBlob* m_blob;
     const std::vector<char> m_cert;
     const br_x509_certificate m_cert_struct;
-    const br_skey_decoder_context m_key_struct;
+    br_skey_decoder_context m_key_struct;
 };
 
@@ -33,26 +33,248 @@ EthernetSSLClient::EthernetSSLClient(   Client& client,
                                         const size_t max_sessions,
                                         const DebugLevel debug)
   : m_client(client)
-  , m_sessions()
-  , m_max_sessions(max_sessions)
+  , m_session_cache(max_sessions ? &SSLSessionCache::shared() : nullptr)
+  , m_port(0)
+  , m_ip()
+  , m_by_ip(false)
+  , m_server_name()
     //, m_analog_pin(analog_pin)      // KH mod
   , m_debug(debug)
   , m_is_connected(false)
+  , m_cert_pin(&m_x509ctx)
+  , m_key_pool(nullptr)
+  , m_ec_all(nullptr)
+  , m_ibuf(nullptr)
+  , m_obuf(nullptr)
+  , m_ibuf_len(0)
+  , m_obuf_len(0)
+  , m_buf_mode(SSL_BUFFER_MONO)
+  , m_max_frag_len(0)
+  , m_buf_pool(nullptr)
+  , m_pool_idle_ms(0)
+  , m_pool_held(false)
+  , m_parked(false)
+  , m_own_ibuf(nullptr)
+  , m_own_obuf(nullptr)
+  , m_own_ibuf_len(0)
+  , m_own_obuf_len(0)
+  , m_own_buf_mode(SSL_BUFFER_MONO)
+  , m_obuf_off(0)
+  , m_last_io(0)
   , m_write_idx(0)
+  , m_rec_adaptive(false)
+  , m_rec_small_len(SSLCLIENT_RECORD_SMALL_LEN)
+  , m_rec_ramp(SSLCLIENT_RECORD_RAMP_BYTES)
+  , m_rec_idle_ms(SSLCLIENT_RECORD_IDLE_MS)
+  , m_rec_sent(0)
+  , m_rec_count(0)
+  , m_rec_last(0)
+  , m_flush_ms(0)
+  , m_pending_since(0)
+  , m_cork_depth(0)
+  , m_unflushed(false)
   , m_br_last_state(0)
+  , m_wait_mode(SSL_WAIT_BACKOFF)
+  , m_wait_max_ms(SSLCLIENT_WAIT_MAX_MS)
+  , m_wait_callback(nullptr)
+  , m_wait_streak(0)
+  , m_wait_us(0)
+  , m_wait_count(0)
+  , m_async_state(SSL_ASYNC_IDLE)
+  , m_async_connect(false)
+  , m_no_wait(false)
+  , m_hs_start(0)
+  , m_hs_timing()
+#if SSLCLIENT_STATS
+  , m_stats()
+  , m_trace_callback(nullptr)
+  , m_stats_start(0)
+  , m_trace_out()
+  , m_trace_in()
+  , m_stats_skx(false)
+  , m_stats_failed(false)
+#endif
 {
   setTimeout(30 * 1000);
 
-  // zero the iobuf just in case it's still garbage
-  memset(m_iobuf, 0, sizeof m_iobuf);
-
   // initialize the various bearssl libraries so they're ready to go when we connect
   //br_client_init_TLS12_only(&m_sslctx, &m_x509ctx, trust_anchors, trust_anchors_num);
   // comment the above line and uncomment the line below if you're having trouble connecting over SSL
   br_ssl_client_init_full(&m_sslctx, &m_x509ctx, trust_anchors, trust_anchors_num);
-  // check if the buffer size is half or full duplex
-  constexpr auto duplex = sizeof m_iobuf <= BR_SSL_BUFSIZE_MONO ? 0 : 1;
-  br_ssl_engine_set_buffer(&m_sslctx.eng, m_iobuf, sizeof m_iobuf, duplex);
+
+#if (SSLCLIENT_IOBUF_SIZE > 0)
+  // zero the iobuf just in case it's still garbage
+  memset(m_iobuf, 0, sizeof m_iobuf);
+
+  // half or full duplex, depending on the buffer size
+  setBuffers(m_iobuf, sizeof m_iobuf);
+#endif
+}
+
+/* see SSLClient.h */
+bool EthernetSSLClient::setBuffers(unsigned char* buf, const size_t len)
+{
+  return setBuffers(buf, len, (len <= BR_SSL_BUFSIZE_MONO) ? SSL_BUFFER_MONO : SSL_BUFFER_BIDI);
+}
+
+/* see SSLClient.h */
+bool EthernetSSLClient::setBuffers(unsigned char* buf, const size_t len, const BufferMode mode)
+{
+  if (mode == SSL_BUFFER_MONO)
+    return m_set_buffers(buf, len, nullptr, 0, SSL_BUFFER_MONO);
+
+  // Same split as br_ssl_engine_set_buffer(): incoming records get up to BR_SSL_BUFSIZE_INPUT bytes,
+  // the rest is for outgoing records, but at least 512 bytes of plaintext
+  const size_t min_out = 512 + (BR_SSL_BUFSIZE_OUTPUT - 16384);
+  size_t olen = (len > BR_SSL_BUFSIZE_INPUT + min_out) ? len - BR_SSL_BUFSIZE_INPUT : min_out;
+
+  if (len < olen + 512 + (BR_SSL_BUFSIZE_INPUT - 16384))
+  {
+    m_error("Buffer too small for bidi mode", __func__);
+
+    return false;
+  }
+
+  return m_set_buffers(buf, len - olen, buf + len - olen, olen, SSL_BUFFER_BIDI);
+}
+
+/* see SSLClient.h */
+bool EthernetSSLClient::setBuffers(unsigned char* ibuf, const size_t ilen, unsigned char* obuf, const size_t olen)
+{
+  if (obuf == nullptr)
+  {
+    m_error("Invalid buffer", __func__);
+
+    return false;
+  }
+
+  return m_set_buffers(ibuf, ilen, obuf, olen, SSL_BUFFER_SPLIT);
+}
+
+/* see SSLClient.h */
+bool EthernetSSLClient::setBufferPool(SSLBufferPool* pool, const unsigned long idle_ms)
+{
+  if (m_is_connected)
+  {
+    m_error("Can't change the buffer pool while connected", __func__);
+
+    return false;
+  }
+
+  // a buffer of the previous pool
+  m_release_buffer();
+
+  m_buf_pool      = pool;
+  m_pool_idle_ms  = idle_ms;
+
+  return true;
+}
+
+/* see SSLClient.h */
+void EthernetSSLClient::setCurvePolicy(const CurvePolicy policy)
+{
+  const br_ec_impl* ec = br_ssl_engine_get_ec(&m_sslctx.eng);
+
+  if (policy == SSL_CURVES_X25519_P256)
+  {
+    if (ec != &br_ec_x25519_p256)
+    {
+      m_ec_all = ec;
+      br_ssl_engine_set_ec(&m_sslctx.eng, &br_ec_x25519_p256);
+    }
+  }
+  // the implementation of the profile is kept, only X25519_P256 is undone
+  else if (ec == &br_ec_x25519_p256)
+  {
+    br_ssl_engine_set_ec(&m_sslctx.eng, m_ec_all ? m_ec_all : br_ec_get_default());
+  }
+}
+
+/* see SSLClient.h */
+bool EthernetSSLClient::setMaxFragmentLength(const size_t len)
+{
+  const char* func_name = __func__;
+
+  if ( (len != 0) && (len != 512) && (len != 1024) && (len != 2048) && (len != 4096) )
+  {
+    m_error("Max Fragment Length must be 512, 1024, 2048 or 4096", func_name);
+
+    return false;
+  }
+
+  if (m_is_connected)
+  {
+    m_error("Can't change the Max Fragment Length while connected", func_name);
+
+    return false;
+  }
+
+  m_max_frag_len = len;
+
+  // applied with the buffers
+  if (m_ibuf)
+    return m_set_buffers(m_ibuf, m_ibuf_len, m_obuf, m_obuf_len, m_buf_mode);
+
+  return true;
+}
+
+/* see SSLClient.h */
+bool EthernetSSLClient::m_set_buffers(unsigned char* ibuf, const size_t ilen, unsigned char* obuf, const size_t olen,
+                                      const BufferMode mode)
+{
+  const char* func_name = __func__;
+
+  if (m_is_connected)
+  {
+    m_error("Can't change the buffers while connected", func_name);
+
+    return false;
+  }
+
+  if (ibuf == nullptr)
+  {
+    m_error("Invalid buffer", func_name);
+
+    return false;
+  }
+
+  br_ssl_engine_set_buffers_bidi(&m_sslctx.eng, ibuf, ilen, obuf, olen);
+
+  if (br_ssl_engine_last_error(&m_sslctx.eng) != BR_ERR_OK)
+  {
+    m_error("Buffer too small, BearSSL needs at least 512 bytes records", func_name);
+    m_ibuf = nullptr;
+
+    return false;
+  }
+
+  m_ibuf      = ibuf;
+  m_obuf      = obuf;
+  m_ibuf_len  = ilen;
+  m_obuf_len  = obuf ? olen : ilen;
+  m_buf_mode  = mode;
+
+  // BearSSL derives the Maximum Fragment Length from the buffers, lower it if requested
+  if ( m_max_frag_len && (m_sslctx.eng.max_frag_len > m_max_frag_len) )
+  {
+    unsigned log_len = 9;
+
+    while (((size_t) 1 << log_len) < m_max_frag_len)
+      log_len++;
+
+    m_sslctx.eng.log_max_frag_len = log_len;
+    m_sslctx.eng.max_frag_len     = m_max_frag_len;
+  }
+
+  m_info("Max Fragment Length:", func_name);
+  m_info(getMaxFragmentLength(), func_name);
+
+  m_info("Input buffer size:", func_name);
+  m_info(m_ibuf_len, func_name);
+  m_info("Output buffer size:", func_name);
+  m_info(m_obuf_len, func_name);
+
+  return true;
 }
 
 /* see SSLClient.h*/
@@ -66,23 +288,45 @@ int EthernetSSLClient::connect(IPAddress ip, uint16_t port)
 
   // reset indexs for safety
   m_write_idx = 0;
+  m_unflushed = false;
+  m_cork_depth = 0;
+
+  if (m_ibuf == nullptr && m_buf_pool == nullptr)
+  {
+    m_error("No I/O buffer, see EthernetSSLClient::setBuffers()", func_name);
+    setWriteError(SSL_INTERNAL_ERROR);
+    return 0;
+  }
 
   // Warning for security
-  m_warn("Using a raw IP Address for an SSL connection bypasses some important verification steps. You should use a domain name (www.google.com) whenever possible.",
-         func_name);
+  if (getServerNameOverride() == nullptr)
+    m_warn("Using a raw IP Address for an SSL connection bypasses some important verification steps. You should use a domain name (www.google.com) or setServerNameOverride() whenever possible.",
+           func_name);
 
   // first we need our hidden client member to negotiate the socket for us,
   // since most times socket functionality is implemented in hardeware.
+  m_port  = port;
+  m_ip    = ip;
+  m_by_ip = true;
+  m_hs_timing = HandshakeTiming();
+  m_stats_begin();
+  const unsigned long tcp_start = micros();
+
   if (!m_client.connect(ip, port))
   {
     m_error("Failed to connect using m_client. Are you connected to the internet?", func_name);
     setWriteError(SSL_CLIENT_CONNECT_FAIL);
+    m_async_state = SSL_ASYNC_FAILED;
+    m_stats_fail(BR_ERR_OK);
     return 0;
   }
 
+  m_hs_timing.tcp_us = micros() - tcp_start;
+  m_stats_event(SSL_TRACE_TCP_CONNECTED);
+
   m_info("Base client connected!", func_name);
 
-  return m_start_ssl(nullptr);
+  return m_start_ssl(getServerNameOverride(), getSession(ip, port));
 }
 
 /* see SSLClient.h*/
@@ -96,20 +340,40 @@ int EthernetSSLClient::connect(const char *host, uint16_t port)
 
   // reset indexs for saftey
   m_write_idx = 0;
+  m_unflushed = false;
+  m_cork_depth = 0;
+
+  if (m_ibuf == nullptr && m_buf_pool == nullptr)
+  {
+    m_error("No I/O buffer, see EthernetSSLClient::setBuffers()", func_name);
+    setWriteError(SSL_INTERNAL_ERROR);
+    return 0;
+  }
 
   // first we need our hidden client member to negotiate the socket for us,
   // since most times socket functionality is implemented in hardeware.
+  m_port  = port;
+  m_by_ip = false;
+  m_hs_timing = HandshakeTiming();
+  m_stats_begin();
+  const unsigned long tcp_start = micros();
+
   if (!m_client.connect(host, port))
   {
     m_error("Failed to connect using m_client. Are you connected to the internet?", func_name);
     setWriteError(SSL_CLIENT_CONNECT_FAIL);
+    m_async_state = SSL_ASYNC_FAILED;
+    m_stats_fail(BR_ERR_OK);
     return 0;
   }
 
+  m_hs_timing.tcp_us = micros() - tcp_start;
+  m_stats_event(SSL_TRACE_TCP_CONNECTED);
+
   m_info("Base client connected!", func_name);
 
   // start ssl!
-  return m_start_ssl(host, getSession(host));
+  return m_start_ssl(host, getSession(host, port));
 }
 
 /* see SSLClient.h*/
@@ -125,7 +389,9 @@ size_t EthernetSSLClient::write(const uint8_t *buf, size_t size)
   if (!m_soft_connected(func_name) || !buf || !size)
     return 0;
 
-  // wait until bearssl is ready to send
+  // send what has waited too long before adding to it, and wait until bearssl is ready to send
+  m_auto_flush();
+
   if (m_run_until(BR_SSL_SENDAPP) < 0)
   {
     m_error("Failed while waiting for the engine to enter BR_SSL_SENDAPP", func_name);
@@ -143,13 +409,17 @@ size_t EthernetSSLClient::write(const uint8_t *buf, size_t size)
     return 0;
   }
 
+  if (m_record_pending() == 0)
+    m_pending_since = millis();
+
   // while there are still elements to write
   while (cur_idx < size)
   {
-    // if we're about to fill the buffer, we need to send the data and then wait
-    // for another oppurtinity to send
-    // so we only send the smallest of the buffer size or our data size - how much we've already sent
-    const size_t cpamount = size - cur_idx >= alen - m_write_idx ? alen - m_write_idx : size - cur_idx;
+    // if we're about to fill the buffer (or the record, see setRecordSizing()), we need to send
+    // the data and then wait for another oppurtinity to send
+    // so we only send the smallest of the room left and our data size - how much we've already sent
+    const size_t room = m_record_room(alen);
+    const size_t cpamount = size - cur_idx >= room ? room : size - cur_idx;
 
     memcpy(br_buf + m_write_idx, buf + cur_idx, cpamount);
     // increment write idx
@@ -157,13 +427,11 @@ size_t EthernetSSLClient::write(const uint8_t *buf, size_t size)
     // increment the buffer pointer
     cur_idx += cpamount;
 
-    // if we filled the buffer, reset m_write_idx, and mark the data for sending
-    if (m_write_idx == alen)
+    // if we filled the buffer or the record, mark the data for sending
+    if (m_write_idx == alen || m_record_room(alen) == 0)
     {
-      // indicate to bearssl that we are done writing
-      br_ssl_engine_sendapp_ack(&m_sslctx.eng, m_write_idx);
-      // reset the write index
-      m_write_idx = 0;
+      // indicate to bearssl that we are done writing, and reset the write index
+      m_send_record();
 
       // write to the socket immediatly
       if (m_run_until(BR_SSL_SENDAPP) < 0)
@@ -181,15 +449,147 @@ size_t EthernetSSLClient::write(const uint8_t *buf, size_t size)
   return size;
 }
 
+/* see SSLClient.h */
+uint8_t* EthernetSSLClient::reserve(size_t* len)
+{
+  const char* func_name = __func__;
+
+  if (!len)
+    return nullptr;
+
+  *len = 0;
+
+  // check if the socket is still open and such
+  if (!m_soft_connected(func_name))
+    return nullptr;
+
+  // wait until bearssl is ready to send
+  if (m_run_until(BR_SSL_SENDAPP) < 0)
+  {
+    m_error("Failed while waiting for the engine to enter BR_SSL_SENDAPP", func_name);
+    return nullptr;
+  }
+
+  size_t alen;
+  unsigned char *br_buf = br_ssl_engine_sendapp_buf(&m_sslctx.eng, &alen);
+
+  if (alen == 0 || br_buf == nullptr || alen <= m_write_idx)
+  {
+    m_error("BearSSL returned zero length buffer for sending, did an internal error occur?", func_name);
+    return nullptr;
+  }
+
+  // a small record which is full, see setRecordSizing()
+  if (m_record_room(alen) == 0)
+  {
+    m_send_record();
+
+    if (m_run_until(BR_SSL_SENDAPP) < 0)
+    {
+      m_error("Failed while waiting for the engine to enter BR_SSL_SENDAPP", func_name);
+      return nullptr;
+    }
+
+    br_buf = br_ssl_engine_sendapp_buf(&m_sslctx.eng, &alen);
+
+    if (alen == 0 || br_buf == nullptr)
+    {
+      m_error("BearSSL returned zero length buffer for sending, did an internal error occur?", func_name);
+      return nullptr;
+    }
+  }
+
+  if (m_record_pending() == 0)
+    m_pending_since = millis();
+
+  *len = m_record_room(alen);
+
+  return br_buf + m_write_idx;
+}
+
+/* see SSLClient.h */
+size_t EthernetSSLClient::commit(const size_t n)
+{
+  const char* func_name = __func__;
+
+  if (!n)
+    return 0;
+
+  size_t alen;
+  unsigned char *br_buf = br_ssl_engine_sendapp_buf(&m_sslctx.eng, &alen);
+
+  if (br_buf == nullptr || (m_write_idx + n > alen))
+  {
+    m_error("Committing more than was reserved", func_name);
+    setWriteError(SSL_INTERNAL_ERROR);
+
+    return 0;
+  }
+
+  // super debug
+  if (m_debug >= DebugLevel::SSL_DUMP)
+    Serial.write(br_buf + m_write_idx, n);
+
+  m_write_idx += n;
+
+  // if we filled the buffer or the record, mark the data for sending, as write() does
+  if (m_write_idx == alen || m_record_room(alen) == 0)
+  {
+    m_send_record();
+
+    // write to the socket immediatly
+    if (m_run_until(BR_SSL_SENDAPP) < 0)
+    {
+      m_error("Failed while waiting for the engine to enter BR_SSL_SENDAPP", func_name);
+      return 0;
+    }
+  }
+
+  return n;
+}
+
+/* see SSLClient.h */
+const uint8_t* EthernetSSLClient::peekSpan(size_t* len)
+{
+  if (!len)
+    return nullptr;
+
+  *len = 0;
+
+  // check that the engine is ready to read
+  if (available() <= 0)
+    return nullptr;
+
+  return br_ssl_engine_recvapp_buf(&m_sslctx.eng, len);
+}
+
+/* see SSLClient.h */
+void EthernetSSLClient::consume(const size_t n)
+{
+  size_t alen;
+
+  if (!n || br_ssl_engine_recvapp_buf(&m_sslctx.eng, &alen) == nullptr)
+    return;
+
+  br_ssl_engine_recvapp_ack(&m_sslctx.eng, n > alen ? alen : n);
+}
+
 /* see SSLClient.h*/
 int EthernetSSLClient::available()
 {
   const char* func_name = __func__;
 
+  // a parked connection only takes a buffer again when the server sends something
+  if (m_parked && m_client.available() <= 0)
+    return 0;
+
   // connection check
   if (!m_soft_connected(func_name))
     return 0;
 
+  // send a record which has waited too long, see setAutoFlush()
+  m_auto_flush();
+
   // run the SSL engine until we are waiting for either user input or a server response
   unsigned state = m_update_engine();
 
@@ -206,8 +606,10 @@ int EthernetSSLClient::available()
   else if (state == BR_SSL_CLOSED)
     m_info("Engine closed after update", func_name);
   // flush the buffer if it's stuck in the SENDAPP state
-  else if (state & BR_SSL_SENDAPP)
-    br_ssl_engine_flush(&m_sslctx.eng, 0);
+  else if ((state & BR_SSL_SENDAPP) && m_cork_depth == 0)
+    m_send_record();
+
+  m_park_if_idle();
 
   // other state, or client is closed
   return 0;
@@ -255,7 +657,8 @@ int EthernetSSLClient::peek()
 /* see SSLClient.h */
 void EthernetSSLClient::flush()
 {
-  if (m_write_idx > 0)
+  // poll(), writeSome() and available() may have acked the written bytes into the engine already
+  if (m_record_pending() > 0)
   {
     if (m_run_until(BR_SSL_RECVAPP) < 0)
     {
@@ -271,6 +674,24 @@ void EthernetSSLClient::flush()
   }
 }
 
+/* see SSLClient.h */
+void EthernetSSLClient::uncork()
+{
+  if (m_cork_depth == 0 || --m_cork_depth > 0)
+    return;
+
+  if (!m_soft_connected(__func__))
+    return;
+
+  // make a record of what is held, m_update_engine() writes it and flushes the socket
+  if (br_ssl_engine_current_state(&m_sslctx.eng) & BR_SSL_SENDAPP)
+    m_send_record();
+
+  m_no_wait = true;
+  m_update_engine();
+  m_no_wait = false;
+}
+
 /* see SSLClient.h */
 void EthernetSSLClient::stop()
 {
@@ -282,6 +703,7 @@ void EthernetSSLClient::stop()
 
   if (state != BR_SSL_CLOSED
       && state != 0
+      && !m_parked
       && connected())
   {
     /*
@@ -294,8 +716,8 @@ void EthernetSSLClient::stop()
       br_ssl_engine_recvapp_ack(&m_sslctx.eng, len);
     }
 
-    // run SSL to finish any existing transactions
-    flush();
+    // send what is buffered, without waiting for the server to answer
+    flushAsync();
   }
 
   // close the ethernet socket
@@ -305,6 +727,10 @@ void EthernetSSLClient::stop()
 
   // we are no longer connected
   m_is_connected = false;
+  m_async_state = SSL_ASYNC_IDLE;
+  m_cork_depth = 0;
+
+  m_release_buffer();
 }
 
 /* see SSLClient.h */
@@ -350,34 +776,58 @@ uint8_t EthernetSSLClient::connected()
 }
 
 /* see SSLClient.h */
-SSLSession* EthernetSSLClient::getSession(const char* host)
+SSLSession* EthernetSSLClient::getSession(const char* host, const uint16_t port)
+{
+  const char* func_name = __func__;
+
+  if (m_session_cache == nullptr)
+    return nullptr;
+
+  SSLSession* session = m_session_cache->find(host, port);
+
+  if (session != nullptr)
+  {
+    m_info("Using session for: ", func_name);
+    m_info(session->get_hostname(), func_name);
+  }
+
+  return session;
+}
+
+/* see SSLClient.h */
+SSLSession* EthernetSSLClient::getSession(const IPAddress& ip, const uint16_t port)
 {
   const char* func_name = __func__;
-  // search for a matching session with the IP
-  int temp_index = m_get_session_index(host);
 
-  // if none available, use m_session_index
-  if (temp_index < 0)
+  if (m_session_cache == nullptr)
     return nullptr;
 
-  // return the pointed to value
-  m_info("Using session index: ", func_name);
-  m_info(temp_index, func_name);
+  SSLSession* session = m_session_cache->find(ip, port, getServerNameOverride());
+
+  if (session != nullptr)
+    m_info("Using session for IP address", func_name);
+
+  return session;
+}
+
+/* see SSLClient.h */
+void EthernetSSLClient::removeSession(const IPAddress& ip, const uint16_t port)
+{
+  const char* func_name = __func__;
 
-  return &(m_sessions[temp_index]);
+  if (m_session_cache != nullptr && m_session_cache->remove(ip, port, getServerNameOverride()))
+    m_info(" Deleted session for IP address", func_name);
 }
 
 /* see SSLClient.h */
-void EthernetSSLClient::removeSession(const char* host)
+void EthernetSSLClient::removeSession(const char* host, const uint16_t port)
 {
   const char* func_name = __func__;
-  int temp_index = m_get_session_index(host);
 
-  if (temp_index >= 0)
+  if (m_session_cache != nullptr && m_session_cache->remove(host, port))
   {
     m_info(" Deleted session ", func_name);
-    m_info(temp_index, func_name);
-    m_sessions.erase(m_sessions.begin() + static_cast<size_t>(temp_index));
+    m_info(host, func_name);
   }
 }
 
@@ -412,29 +862,91 @@ void EthernetSSLClient::setVerificationTime(uint32_t days, uint32_t seconds)
   br_x509_minimal_set_time(&m_x509ctx, days, seconds);
 }
 
-bool EthernetSSLClient::m_soft_connected(const char* func_name)
+/* see SSLClient.h */
+bool EthernetSSLClient::setTrustAnchorIndex(const unsigned char* index, const size_t index_len)
 {
-  // check if the socket is still open and such
-  if (getWriteError())
+  br_x509_minimal_set_ta_index(&m_x509ctx, nullptr);
+
+  if (index == nullptr)
+    return true;
+
+  // a header generated for another set of anchors, checked before any entry is read
+  if (index_len != m_x509ctx.trust_anchors_num * BR_X509_TA_INDEX_LEN)
   {
-    m_error("Cannot operate if the write error is not reset: ", func_name);
-    m_print_ssl_error(getWriteError(), SSL_ERROR);
+    m_error("Trust anchor index size doesn't match the number of trust anchors, regenerate them with pycert_bearssl --index", __func__);
 
     return false;
   }
 
-  // check if the ssl engine is still open
-  if (!m_is_connected || br_ssl_engine_current_state(&m_sslctx.eng) == BR_SSL_CLOSED)
+  unsigned char hash[br_sha256_SIZE];
+
+  for (size_t i = 0; i < m_x509ctx.trust_anchors_num; i++)
   {
-    m_error("Cannot operate on a closed SSL connection.", func_name);
-    int error = br_ssl_engine_last_error(&m_sslctx.eng);
+    const br_x509_trust_anchor& ta = m_x509ctx.trust_anchors[i];
+    const unsigned char* entry = index + i * BR_X509_TA_INDEX_LEN;
 
-    if (error != BR_ERR_OK)
-      m_print_br_error(error, SSL_ERROR);
+    br_sha256_context sha;
+    br_sha256_init(&sha);
+    br_sha256_update(&sha, ta.dn.data, ta.dn.len);
+    br_sha256_out(&sha, hash);
+
+    if ( (memcmp(hash, entry, BR_X509_TA_INDEX_LEN) != 0) ||
+         ((i > 0) && (memcmp(entry - BR_X509_TA_INDEX_LEN, entry, BR_X509_TA_INDEX_LEN) > 0)) )
+    {
+      m_error("Trust anchor index doesn't match the trust anchors, regenerate them with pycert_bearssl --index", __func__);
+
+      return false;
+    }
+  }
+
+  br_x509_minimal_set_ta_index(&m_x509ctx, index);
+
+  return true;
+}
+
+/* see SSLClient.h */
+void EthernetSSLClient::setCertificatePinning(const bool enable, const unsigned long revalidate_ms)
+{
+  if (m_is_connected)
+  {
+    m_error("Can't change the certificate validation while connected", __func__);
+
+    return;
+  }
+
+  m_cert_pin.clear();
+  m_cert_pin.setRevalidateInterval(revalidate_ms);
+
+  br_ssl_engine_set_x509(&m_sslctx.eng, enable ? m_cert_pin.x509() : &m_x509ctx.vtable);
+}
+
+bool EthernetSSLClient::m_soft_connected(const char* func_name)
+{
+  // check if the socket is still open and such
+  if (getWriteError())
+  {
+    m_error("Cannot operate if the write error is not reset: ", func_name);
+    m_print_ssl_error(getWriteError(), SSL_ERROR);
+
+    return false;
+  }
+
+  // check if the ssl engine is still open
+  if (!m_is_connected || br_ssl_engine_current_state(&m_sslctx.eng) == BR_SSL_CLOSED)
+  {
+    m_error("Cannot operate on a closed SSL connection.", func_name);
+    int error = br_ssl_engine_last_error(&m_sslctx.eng);
+
+    if (error != BR_ERR_OK)
+      m_print_br_error(error, SSL_ERROR);
 
     return false;
   }
 
+  // the connection gave its buffer back while idle
+  if (m_parked && !m_unpark(func_name))
+    return false;
+
   return true;
 }
 
@@ -443,8 +955,57 @@ int EthernetSSLClient::m_start_ssl(const char* host, SSLSession* ssl_ses)
 {
   const char* func_name = __func__;
 
+  if (!m_begin_ssl(host, ssl_ses))
+    return 0;
+
+  // connectAsync(), the handshake is run by poll()
+  if (m_async_connect)
+  {
+    m_info("Handshake started", func_name);
+
+    m_async_host = host ? host : "";
+
+    return 1;
+  }
+
+  const unsigned long wait_start = m_wait_us;
+
+  // initialize the SSL socket over the network
+  // normally this would happen in write, but I think it makes
+  // a little more structural sense to put it here
+  if (m_run_until(BR_SSL_SENDAPP) < 0)
+  {
+    m_error("Failed to initlalize the SSL layer", func_name);
+    m_print_br_error(br_ssl_engine_last_error(&m_sslctx.eng), SSL_ERROR);
+    m_async_state = SSL_ASYNC_FAILED;
+    m_stats_fail(br_ssl_engine_last_error(&m_sslctx.eng));
+    m_release_buffer();
+    return 0;
+  }
+
+  m_hs_timing.engine_us = (micros() - m_hs_start) - (m_wait_us - wait_start);
+
+  m_end_ssl(host);
+
+  return 1;
+}
+
+/* see SSLClient.h */
+int EthernetSSLClient::m_begin_ssl(const char* host, SSLSession* ssl_ses)
+{
+  const char* func_name = __func__;
+
   // clear the write error
   setWriteError(SSL_OK);
+
+  if (!m_acquire_buffer(func_name))
+  {
+    m_client.stop();
+    m_async_state = SSL_ASYNC_FAILED;
+
+    return 0;
+  }
+
   // get some random data by reading the analog pin we've been handed
   // we want 128 bits to be safe, as recommended by the bearssl docs
   uint8_t rng_seeds[16];
@@ -472,46 +1033,233 @@ int EthernetSSLClient::m_start_ssl(const char* host, SSLSession* ssl_ses)
     m_info("Set SSL session!", func_name);
   }
 
-  // reset the engine, but make sure that it reset successfully
-  int ret = br_ssl_client_reset(&m_sslctx, host, 1);
+  // reset the engine, but make sure that it reset successfully. Only resume a session of the cache,
+  // not the last one of the engine, which may belong to another server
+  int ret = br_ssl_client_reset(&m_sslctx, host, ssl_ses != nullptr);
 
   if (!ret)
   {
     m_error("Reset of bearSSL failed (is bearssl setup properly?)", func_name);
     m_print_br_error(br_ssl_engine_last_error(&m_sslctx.eng), SSL_ERROR);
     setWriteError(SSL_BR_CONNECT_FAIL);
+    m_async_state = SSL_ASYNC_FAILED;
+    m_release_buffer();
 
     return 0;
   }
 
-  // initialize the SSL socket over the network
-  // normally this would happen in write, but I think it makes
-  // a little more structural sense to put it here
-  if (m_run_until(BR_SSL_SENDAPP) < 0)
-  {
-    m_error("Failed to initlalize the SSL layer", func_name);
-    m_print_br_error(br_ssl_engine_last_error(&m_sslctx.eng), SSL_ERROR);
-    return 0;
-  }
+  m_async_state = SSL_ASYNC_HANDSHAKE;
+  m_hs_start    = micros();
+
+  return 1;
+}
+
+/* see SSLClient.h */
+void EthernetSSLClient::m_end_ssl(const char* host)
+{
+  const char* func_name = __func__;
+
+  m_hs_timing.handshake_us = micros() - m_hs_start;
+
+#if SSLCLIENT_STATS
+  m_stats.resumed       = m_stats.certificate_us == 0;
+  m_stats.version       = m_sslctx.eng.session.version;
+  m_stats.cipher_suite  = m_sslctx.eng.session.cipher_suite;
+  m_stats.curve         = m_stats_skx ? m_sslctx.eng.ecdhe_curve : 0;
+#endif
+
+  m_stats_event(SSL_TRACE_FINISHED);
 
   m_info("Connection successful!", func_name);
   m_is_connected = true;
+  m_async_state = SSL_ASYNC_READY;
+
+  m_last_io = millis();
+
+  // small records first, see setRecordSizing()
+  m_rec_sent  = 0;
+  m_rec_count = 0;
+  m_rec_last  = millis();
 
   // all good to go! the SSL socket should be up and running
-  // overwrite the session we got with new parameters
-  if (ssl_ses != nullptr)
-    br_ssl_engine_get_session_parameters(&m_sslctx.eng, ssl_ses->to_br_session());
-  else if (host != nullptr)
+  // save the session, looked up again as another client may have replaced it during the handshake
+  if (m_session_cache != nullptr && (host != nullptr || m_by_ip))
   {
-    if (m_sessions.size() >= m_max_sessions)
-      m_sessions.erase(m_sessions.begin());
+    SSLSession* session = m_by_ip ? m_session_cache->insert(m_ip, m_port, host) : m_session_cache->insert(host, m_port);
 
-    SSLSession session(host);
-    br_ssl_engine_get_session_parameters(&m_sslctx.eng, session.to_br_session());
-    m_sessions.push_back(session);
+    if (session != nullptr)
+      br_ssl_engine_get_session_parameters(&m_sslctx.eng, session->to_br_session());
   }
+}
 
-  return 1;
+/* see SSLClient.h */
+void EthernetSSLClient::m_fail_async(const char* msg, const char* func_name)
+{
+  m_error(msg, func_name);
+
+  const int error = br_ssl_engine_last_error(&m_sslctx.eng);
+
+  if (error != BR_ERR_OK)
+    m_print_br_error(error, SSL_ERROR);
+
+  if (!getWriteError())
+    setWriteError(SSL_BR_CONNECT_FAIL);
+
+  m_stats_fail(error);
+
+  m_client.stop();
+  m_is_connected = false;
+  m_async_state = SSL_ASYNC_FAILED;
+
+  m_release_buffer();
+}
+
+/* see SSLClient.h */
+int EthernetSSLClient::connectAsync(const char *host, uint16_t port)
+{
+  m_async_connect = true;
+  const int ret = connect(host, port);
+  m_async_connect = false;
+
+  return ret;
+}
+
+/* see SSLClient.h */
+int EthernetSSLClient::connectAsync(IPAddress ip, uint16_t port)
+{
+  m_async_connect = true;
+  const int ret = connect(ip, port);
+  m_async_connect = false;
+
+  return ret;
+}
+
+/* see SSLClient.h */
+EthernetSSLClient::AsyncState EthernetSSLClient::poll()
+{
+  const char* func_name = __func__;
+
+  if (m_async_state == SSL_ASYNC_HANDSHAKE)
+  {
+    const unsigned long start = micros();
+
+    m_no_wait = true;
+    const unsigned state = m_update_engine();
+    m_no_wait = false;
+
+    m_hs_timing.engine_us += micros() - start;
+
+    if (state == 0 || (state & BR_SSL_CLOSED) || getWriteError())
+    {
+      m_fail_async("Handshake failed", func_name);
+    }
+    else if (state & (BR_SSL_SENDAPP | BR_SSL_RECVAPP))
+    {
+      m_end_ssl(m_async_host.length() ? m_async_host.c_str() : nullptr);
+
+      m_async_host = "";
+    }
+    else if (micros() - m_hs_start > getTimeout() * 1000UL)
+    {
+      m_fail_async("Handshake timed out", func_name);
+    }
+  }
+  else if (m_async_state == SSL_ASYNC_READY)
+  {
+    if (!m_is_connected || br_ssl_engine_current_state(&m_sslctx.eng) == BR_SSL_CLOSED)
+    {
+      m_fail_async("Connection closed", func_name);
+    }
+    else if (m_parked && (m_client.available() <= 0 || !m_unpark(func_name)))
+    {
+      // the buffer was given back while idle, nothing to do until the server sends something
+    }
+    else
+    {
+      m_auto_flush();
+
+      m_no_wait = true;
+      const unsigned state = m_update_engine();
+      m_no_wait = false;
+
+      if (state == 0 || getWriteError())
+        m_fail_async("Connection failed", func_name);
+      else
+        m_park_if_idle();
+    }
+  }
+
+  return m_async_state;
+}
+
+/* see SSLClient.h */
+size_t EthernetSSLClient::writeSome(const uint8_t *buf, size_t size)
+{
+  const char* func_name = __func__;
+
+  if (!m_soft_connected(func_name) || !buf || !size)
+    return 0;
+
+  // send complete records and take in received ones, without waiting
+  m_no_wait = true;
+  const unsigned state = m_update_engine();
+  m_no_wait = false;
+
+  if (!(state & BR_SSL_SENDAPP))
+    return 0;
+
+  size_t alen;
+  unsigned char *br_buf = br_ssl_engine_sendapp_buf(&m_sslctx.eng, &alen);
+
+  if (br_buf == nullptr || alen <= m_write_idx)
+    return 0;
+
+  if (m_record_pending() == 0)
+    m_pending_since = millis();
+
+  const size_t room = m_record_room(alen);
+  const size_t cpamount = (size > room) ? room : size;
+
+  // super debug
+  if (m_debug >= DebugLevel::SSL_DUMP)
+    Serial.write(buf, cpamount);
+
+  memcpy(br_buf + m_write_idx, buf, cpamount);
+  m_write_idx += cpamount;
+
+  // if we filled the buffer or the record, encrypt and send it
+  if (m_write_idx == alen || m_record_room(alen) == 0)
+  {
+    m_send_record();
+
+    m_no_wait = true;
+    m_update_engine();
+    m_no_wait = false;
+  }
+
+  return cpamount;
+}
+
+/* see SSLClient.h */
+bool EthernetSSLClient::flushAsync()
+{
+  if (!m_soft_connected(__func__))
+    return true;
+
+  unsigned state = br_ssl_engine_current_state(&m_sslctx.eng);
+
+  // make a record of what is buffered
+  if (state & BR_SSL_SENDAPP)
+    m_send_record();
+
+  m_no_wait = true;
+  state = m_update_engine();
+  m_no_wait = false;
+
+  if (state == 0 || getWriteError())
+    return true;
+
+  return (m_write_idx == 0) && !(state & BR_SSL_SENDREC);
 }
 
 /* see SSLClient.h */
@@ -624,7 +1372,7 @@ int EthernetSSLClient::m_run_until(const unsigned target)
     */
     if (state & BR_SSL_SENDAPP && target & BR_SSL_RECVAPP)
     {
-      br_ssl_engine_flush(&m_sslctx.eng, 0);
+      m_send_record();
     }
   }
 }
@@ -634,6 +1382,9 @@ unsigned EthernetSSLClient::m_update_engine()
 {
   const char* func_name = __func__;
 
+  if (m_async_state == SSL_ASYNC_HANDSHAKE)
+    m_hs_timing.polls++;
+
   for (;;)
   {
     //ET_LOGDEBUG(F("======================================================"));
@@ -650,7 +1401,15 @@ unsigned EthernetSSLClient::m_update_engine()
     }
 
     if (state & BR_SSL_CLOSED)
+    {
+#if SSLCLIENT_STATS
+
+      if (br_ssl_engine_last_error(&m_sslctx.eng) != BR_ERR_OK)
+        m_stats_fail(br_ssl_engine_last_error(&m_sslctx.eng));
+
+#endif
       return state;
+    }
 
     /*
       If there is some record data to send, do it. This takes
@@ -664,8 +1423,7 @@ unsigned EthernetSSLClient::m_update_engine()
 
       buf = br_ssl_engine_sendrec_buf(&m_sslctx.eng, &len);
       wlen = m_client.write(buf, len);
-      m_client.flush();
-
+      m_unflushed = true;
 
       if (wlen <= 0)
       {
@@ -685,12 +1443,24 @@ unsigned EthernetSSLClient::m_update_engine()
 
       if (wlen > 0)
       {
+        m_stats_io(true, buf, wlen);
         br_ssl_engine_sendrec_ack(&m_sslctx.eng, wlen);
+        m_last_io = millis();
+
+        if (m_async_state == SSL_ASYNC_HANDSHAKE)
+          m_hs_timing.bytes_out += wlen;
       }
 
       continue;
     }
 
+    // flush the socket once for all the records written, unless corked
+    if (m_unflushed && m_cork_depth == 0)
+    {
+      m_client.flush();
+      m_unflushed = false;
+    }
+
     /*
        If the client has specified there is client data to send, and
        the engine is ready to handle it, send it along.
@@ -784,7 +1554,18 @@ unsigned EthernetSSLClient::m_update_engine()
 
         if (rlen > 0)
         {
+          m_stats_io(false, buf, rlen);
           br_ssl_engine_recvrec_ack(&m_sslctx.eng, rlen);
+          m_wait_streak = 0;
+          m_last_io = millis();
+
+          if (m_async_state == SSL_ASYNC_HANDSHAKE)
+          {
+            if (m_hs_timing.bytes_in == 0)
+              m_hs_timing.first_byte_us = micros() - m_hs_start;
+
+            m_hs_timing.bytes_in += rlen;
+          }
         }
 
         continue;
@@ -795,8 +1576,9 @@ unsigned EthernetSSLClient::m_update_engine()
         //ET_LOGDEBUG3(F("m_update_engine #4-5, Bytes avail ="), avail,  F(", Bytes needed ="), len);
         //////
 
-        // add a delay since spamming get_arduino_client().availible breaks the poor wiz chip
-        delay(10);
+        // don't spam get_arduino_client().available(), it breaks the poor wiz chip
+        if (!m_no_wait)
+          m_wait_for_data();
 
         return state;
       }
@@ -808,28 +1590,398 @@ unsigned EthernetSSLClient::m_update_engine()
   }
 }
 
-/* see SSLClientImpl.h */
-int EthernetSSLClient::m_get_session_index(const char* host) const
+/* see SSLClient.h */
+size_t EthernetSSLClient::m_record_pending() const
 {
-  const char* func_name = __func__;
+  const br_ssl_engine_context& eng = m_sslctx.eng;
+  size_t pending = m_write_idx;
 
-  if (host == nullptr)
-    return -1;
+  // while a record is filled, the engine holds the acked bytes from oxc to oxa
+  if (eng.oxa != eng.oxb && eng.oxc <= eng.oxa)
+    pending += eng.oxa - eng.oxc;
+
+  return pending;
+}
 
-  // search for a matching session with the IP
-  for (uint8_t i = 0; i < getSessionCount(); i++)
+/* see SSLClient.h */
+size_t EthernetSSLClient::m_record_room(const size_t alen)
+{
+  const size_t room = alen - m_write_idx;
+
+  if (!m_rec_adaptive || m_cork_depth > 0)
+    return room;
+
+  // small records again after an idle time
+  if (millis() - m_rec_last >= m_rec_idle_ms)
+    m_rec_sent = 0;
+
+  if (m_rec_sent >= m_rec_ramp)
+    return room;
+
+  const size_t pending = m_record_pending();
+
+  if (pending >= m_rec_small_len)
+    return 0;
+
+  return (room > m_rec_small_len - pending) ? m_rec_small_len - pending : room;
+}
+
+/* see SSLClient.h */
+void EthernetSSLClient::m_send_record()
+{
+  const size_t pending = m_record_pending();
+
+  if (m_write_idx > 0)
   {
-    // if we're looking at a real session
-    if (m_sessions[i].get_hostname().equals(host))
-    {
-      m_info(m_sessions[i].get_hostname(), func_name);
+    br_ssl_engine_sendapp_ack(&m_sslctx.eng, m_write_idx);
+    m_write_idx = 0;
+  }
 
-      return i;
-    }
+  // the engine only makes a record by itself when the buffer is full
+  br_ssl_engine_flush(&m_sslctx.eng, 0);
+
+  if (pending > 0)
+  {
+    m_rec_sent += pending;
+    m_rec_count++;
+    m_rec_last = millis();
+  }
+
+  m_pending_since = millis();
+}
+
+/* see SSLClient.h */
+void EthernetSSLClient::m_auto_flush()
+{
+  if (m_flush_ms == 0 || m_cork_depth > 0 || millis() - m_pending_since < m_flush_ms || m_record_pending() == 0)
+    return;
+
+  if (br_ssl_engine_current_state(&m_sslctx.eng) & BR_SSL_SENDAPP)
+    m_send_record();
+}
+
+/* see SSLClient.h */
+bool EthernetSSLClient::m_acquire_buffer(const char* func_name)
+{
+  if (m_buf_pool == nullptr)
+    return true;
+
+  // a new connection on an open one
+  if (m_parked)
+    return m_unpark(func_name);
+
+  if (m_pool_held)
+    return true;
+
+  unsigned char* block = m_buf_pool->acquire();
+
+  if (block == nullptr)
+  {
+    m_error("No free buffer in the pool", func_name);
+    setWriteError(SSL_OUT_OF_MEMORY);
+
+    return false;
+  }
+
+  // the engine is reset for the new connection
+  m_is_connected = false;
+
+  m_own_ibuf      = m_ibuf;
+  m_own_obuf      = m_obuf;
+  m_own_ibuf_len  = m_ibuf_len;
+  m_own_obuf_len  = m_obuf_len;
+  m_own_buf_mode  = m_buf_mode;
+
+  if (!setBuffers(block, m_buf_pool->blockSize()))
+  {
+    m_buf_pool->release(block);
+    m_restore_buffers();
+    setWriteError(SSL_INTERNAL_ERROR);
+
+    return false;
+  }
+
+  m_pool_held = true;
+
+  return true;
+}
+
+/* see SSLClient.h */
+void EthernetSSLClient::m_release_buffer()
+{
+  if (m_buf_pool == nullptr || !(m_pool_held || m_parked))
+    return;
+
+  if (m_pool_held)
+    m_buf_pool->release(m_ibuf);
+
+  m_pool_held = false;
+  m_parked    = false;
+
+  m_restore_buffers();
+}
+
+/* see SSLClient.h */
+void EthernetSSLClient::m_restore_buffers()
+{
+  if (m_own_ibuf)
+  {
+    // the engine keeps the state and error of the connection that used the block
+    const unsigned char iomode  = m_sslctx.eng.iomode;
+    const int           err     = m_sslctx.eng.err;
+
+    m_set_buffers(m_own_ibuf, m_own_ibuf_len, m_own_obuf, m_own_obuf_len, m_own_buf_mode);
+
+    m_sslctx.eng.iomode = iomode;
+    m_sslctx.eng.err    = err;
+  }
+  else
+  {
+    // no buffers of our own, the engine mustn't point into the block given back
+    m_sslctx.eng.ibuf     = nullptr;
+    m_sslctx.eng.ibuf_len = 0;
+    m_sslctx.eng.obuf     = nullptr;
+    m_sslctx.eng.obuf_len = 0;
+
+    m_ibuf      = nullptr;
+    m_obuf      = nullptr;
+    m_ibuf_len  = 0;
+    m_obuf_len  = 0;
+  }
+
+  m_own_ibuf  = nullptr;
+  m_own_obuf  = nullptr;
+}
+
+/* see SSLClient.h */
+void EthernetSSLClient::m_park_if_idle()
+{
+  if (!m_pool_held || m_pool_idle_ms == 0 || !m_is_connected || millis() - m_last_io < m_pool_idle_ms)
+    return;
+
+  const br_ssl_engine_context& eng = m_sslctx.eng;
+
+  // between records: waiting for the header of the next one, and nothing to send or being sent
+  if (br_ssl_engine_current_state(&eng) != (BR_SSL_SENDAPP | BR_SSL_RECVREC) || m_record_pending() != 0
+      || eng.ixa != 0 || eng.ixb != 0 || eng.ixc != 5 || eng.oxa != eng.oxc)
+    return;
+
+  m_obuf_off = eng.obuf - eng.ibuf;
+  m_buf_pool->release(m_ibuf);
+
+  m_pool_held = false;
+  m_parked    = true;
+
+  m_info("Idle, buffer given back to the pool", __func__);
+}
+
+/* see SSLClient.h */
+bool EthernetSSLClient::m_unpark(const char* func_name)
+{
+  unsigned char* block = m_buf_pool->acquire();
+
+  if (block == nullptr)
+  {
+    m_warn("No free buffer in the pool", func_name);
+
+    return false;
   }
 
-  // none found
-  return -1;
+  // the engine holds no data, a buffer of the same size in place of the previous one
+  m_sslctx.eng.ibuf = block;
+  m_sslctx.eng.obuf = block + m_obuf_off;
+
+  m_ibuf      = block;
+  m_obuf      = m_obuf ? block + m_obuf_off : nullptr;
+  m_pool_held = true;
+  m_parked    = false;
+  m_last_io   = millis();
+
+  return true;
+}
+
+/* see SSLClient.h */
+void EthernetSSLClient::m_wait_for_data()
+{
+  // polls before the backoff starts sleeping, data is usually only late by a few hundred us on a LAN
+  const unsigned yield_polls = 4;
+
+  unsigned hint_ms = 0;
+
+  if (m_wait_streak >= yield_polls)
+  {
+    const unsigned shift = m_wait_streak - yield_polls;
+
+    hint_ms = (shift < 16) ? (1u << shift) : m_wait_max_ms;
+
+    if (hint_ms > m_wait_max_ms)
+      hint_ms = m_wait_max_ms;
+  }
+
+  m_wait_streak++;
+  m_wait_count++;
+
+  const unsigned long start = micros();
+
+  switch (m_wait_mode)
+  {
+    case SSL_WAIT_FIXED:
+      delay(m_wait_max_ms);
+      break;
+
+    case SSL_WAIT_CALLBACK:
+      if (m_wait_callback)
+      {
+        m_wait_callback(get_arduino_client(), hint_ms);
+        break;
+      }
+
+      // no callback, back off instead
+      // fall through
+    case SSL_WAIT_BACKOFF:
+    default:
+      if (hint_ms)
+        delay(hint_ms);
+      else
+        yield();
+
+      break;
+  }
+
+  const unsigned long waited = micros() - start;
+
+  m_wait_us += waited;
+
+#if SSLCLIENT_STATS
+  // the same wait, counted again from connect()
+  m_stats.wait_us += waited;
+  m_stats.wait_count++;
+#endif
+}
+
+/* see SSLClient.h */
+void EthernetSSLClient::m_stats_begin()
+{
+#if SSLCLIENT_STATS
+  m_stats         = Stats();
+  m_stats_start   = micros();
+  m_stats_skx     = false;
+  m_stats_failed  = false;
+  m_trace_out.reset();
+  m_trace_in.reset();
+#endif
+}
+
+/* see SSLClient.h */
+void EthernetSSLClient::m_stats_event(const TraceEvent event)
+{
+#if SSLCLIENT_STATS
+  // never 0, which means not reached
+  unsigned long us = micros() - m_stats_start;
+
+  if (us == 0)
+    us = 1;
+
+  switch (event)
+  {
+    case SSL_TRACE_TCP_CONNECTED:
+      m_stats.tcp_us = us;
+      break;
+
+    case SSL_TRACE_SERVER_HELLO:
+      m_stats.server_hello_us = us;
+      break;
+
+    case SSL_TRACE_CERTIFICATE:
+      m_stats.certificate_us = us;
+      break;
+
+    case SSL_TRACE_KEY_EXCHANGE:
+      m_stats.key_exchange_us = us;
+      break;
+
+    case SSL_TRACE_FINISHED:
+      m_stats.finished_us = us;
+      break;
+
+    default:
+      break;
+  }
+
+  if (m_trace_callback)
+    m_trace_callback(*this, event, us);
+
+#else
+  (void) event;
+#endif
+}
+
+/* see SSLClient.h */
+void EthernetSSLClient::m_stats_io(const bool out, const unsigned char* buf, const size_t len)
+{
+#if SSLCLIENT_STATS
+  // handshake messages of TLS 1.2, RFC 5246 7.4
+  const uint8_t SERVER_HELLO        = 2;
+  const uint8_t CERTIFICATE         = 11;
+  const uint8_t SERVER_KEY_EXCHANGE = 12;
+  const uint8_t CLIENT_KEY_EXCHANGE = 16;
+
+  if (out)
+  {
+    const uint32_t done = m_trace_out.process(buf, len);
+
+    m_stats.bytes_out   += len;
+    m_stats.records_out = m_trace_out.records();
+
+    if (done & SSLRecordTrace::message(CLIENT_KEY_EXCHANGE))
+      m_stats_event(SSL_TRACE_KEY_EXCHANGE);
+  }
+  else
+  {
+    const uint32_t done = m_trace_in.process(buf, len);
+
+    m_stats.bytes_in    += len;
+    m_stats.records_in  = m_trace_in.records();
+
+    if (done & SSLRecordTrace::message(SERVER_HELLO))
+      m_stats_event(SSL_TRACE_SERVER_HELLO);
+
+    if (done & SSLRecordTrace::message(CERTIFICATE))
+      m_stats_event(SSL_TRACE_CERTIFICATE);
+
+    if (done & SSLRecordTrace::message(SERVER_KEY_EXCHANGE))
+      m_stats_skx = true;
+  }
+
+#else
+  (void) out;
+  (void) buf;
+  (void) len;
+#endif
+}
+
+/* see SSLClient.h */
+void EthernetSSLClient::m_stats_fail(const int br_error)
+{
+#if SSLCLIENT_STATS
+
+  // the engine may fail before EthernetSSLClient sets its write error, keep the first of each
+  if (m_stats.br_error == BR_ERR_OK)
+    m_stats.br_error = br_error;
+
+  if (m_stats.ssl_error == SSL_OK)
+    m_stats.ssl_error = getWriteError();
+
+  if (m_stats_failed)
+    return;
+
+  m_stats_failed = true;
+
+  m_stats_event(SSL_TRACE_FAILED);
+
+#else
+  (void) br_error;
+#endif
 }
 
 /* See SSLClient.h */
@@ -935,6 +2087,7 @@ void EthernetSSLClient::m_print_br_error(const unsigned br_error_code, const Deb
 
     case BR_ERR_TOO_LARGE:
       Serial.println("Incoming record is too large to be processed, or buffer is too small for the handshake message to send.");
+      Serial.println("The server probably ignored the Max Fragment Length extension, use a larger input buffer.");
       break;
 
     case BR_ERR_BAD_MAC:
@@ -0,0 +1,737 @@
+/**
+   SSLCryptoProfile.h
+
+   This file contains a calibration of the BearSSL implementations compiled in, which
+   picks the fastest one of each primitive on the running board.
+*/
+
+#pragma once
+
+#include "SSLClient/bearssl.h"
+#include "Arduino.h"
+
+/**
+   \brief The BearSSL implementations to use for each primitive, chosen by timing them on the board.
+
+   BearSSL has several constant-time implementations of most primitives: 15, 31, 32 or 62-bit
+   big integers for RSA, 15, 31, 62 or 64-bit field arithmetic for EC, bitsliced AES on 32 or 64-bit
+   words, carry-less multiplications for GHASH and Poly1305 on 32 or 64-bit words, and the AES-NI,
+   POWER8 and SSE2 ones where the CPU has them. br_ssl_client_init_full() picks one from the compile
+   time configuration, which isn't the fastest on every core: the Cortex-M0/M3/M4/M7 and the A7 of the
+   STM32MP1 differ in their multipliers and caches.
+
+   calibrate() runs each implementation which is available on a test input for a share of a time
+   budget, checks its result against the first one, and keeps the fastest. apply() installs the chosen
+   ones into a client context, see EthernetSSLClient::setCryptoProfile(). The implementations which
+   aren't constant-time, aes_big and the 4-bit table GHASH (br_ghash_shoup4), are only candidates
+   after allowVariableTime(), and useTableGcm() chooses them without calibrating. apply() doesn't install
+   them without one of these opt-ins, which serialize() saves with the choices.
+
+   A calibration takes as long as its budget, so the result can be saved with serialize() and
+   restored at boot with deserialize(). A primitive which wasn't calibrated keeps the implementation of
+   br_ssl_client_init_full().
+
+   Calling calibrate() links every candidate into the firmware, tens of kB of flash. A firmware which only
+   calls deserialize() and apply() links them as well, since any of them can be chosen.
+*/
+class SSLCryptoProfile
+{
+  public:
+
+    /** @brief The primitives which are calibrated */
+    enum Primitive
+    {
+      RSA,          // RSA public key operation, server keys and certificates (2048-bit modulus)
+      EC,           // EC scalar multiplications, ECDHE and ECDSA (P-256)
+      ECDSA,        // ECDSA signature verification, with the chosen EC implementation
+      AES_CTR,      // AES-GCM and AES-CCM cipher suites
+      AES_CBC,      // AES-CBC cipher suites
+      GHASH,        // AES-GCM cipher suites
+      CHACHA20,     // ChaCha20-Poly1305 cipher suites
+      POLY1305,     // ChaCha20-Poly1305 cipher suites
+      NUM_PRIMITIVES
+    };
+
+    /** @brief Value of choice() for a primitive which keeps the implementation of br_ssl_client_init_full() */
+    static const uint8_t DEFAULT_IMPL = 0xFF;
+
+    SSLCryptoProfile()
+      : m_variable_time(false)
+    {
+      clear();
+    }
+
+    /** @brief Keep the implementations of br_ssl_client_init_full() for every primitive */
+    void clear()
+    {
+      for (size_t p = 0; p < NUM_PRIMITIVES; p++)
+      {
+        m_choice[p] = DEFAULT_IMPL;
+        m_ns[p]     = 0;
+      }
+    }
+
+    /**
+       @brief Time the implementations of each primitive, and choose the fastest one.
+
+       Each implementation is run for about budget_ms divided by the number of implementations, at
+       least once. The primitives are calibrated in the order of Primitive; those not reached when the
+       budget is spent keep their previous choice.
+
+       @param budget_ms The time budget, in ms
+       @returns true if every primitive was calibrated within the budget
+    */
+    bool calibrate(const unsigned long budget_ms)
+    {
+      const unsigned long start = millis();
+      size_t candidates = 0;
+
+      for (size_t p = 0; p < NUM_PRIMITIVES; p++)
+      {
+        for (uint8_t i = 0; i < m_num_impls((Primitive) p); i++)
+          candidates += m_candidate((Primitive) p, i) ? 1 : 0;
+      }
+
+      const unsigned long slice_us = (budget_ms * 1000UL) / candidates;
+
+      for (size_t p = 0; p < NUM_PRIMITIVES; p++)
+      {
+        if (millis() - start >= budget_ms)
+          return false;
+
+        uint8_t best = DEFAULT_IMPL;
+        unsigned long best_ns = 0;
+        uint8_t reference[REF_SZ];
+        bool has_reference = false;
+
+        for (uint8_t i = 0; i < m_num_impls((Primitive) p); i++)
+        {
+          unsigned long ns;
+
+          if (!m_candidate((Primitive) p, i) || !m_time((Primitive) p, i, slice_us, reference, has_reference, ns))
+            continue;
+
+          if (best == DEFAULT_IMPL || ns < best_ns)
+          {
+            best    = i;
+            best_ns = ns;
+          }
+        }
+
+        m_choice[p] = best;
+        m_ns[p]     = best_ns;
+      }
+
+      return true;
+    }
+
+    /**
+       @brief Let calibrate() choose aes_big and the 4-bit table GHASH as well, if they are faster.
+
+       These implementations are NOT constant-time: their table lookups depend on the key and the data,
+       which may leak through the timings of the cache and the memory. Only allow them where side channels
+       are out of scope, e.g. a device which is alone on its core and whose timings can't be measured
+       precisely from the network.
+
+       The choice is saved by serialize(). apply() ignores aes_big and the 4-bit table GHASH unless it is true.
+
+       @param allow true to make them candidates, false (the default) for the constant-time ones only
+    */
+    void allowVariableTime(const bool allow)
+    {
+      m_variable_time = allow;
+    }
+
+    /**
+       @brief Choose the table based AES (aes_big) and GHASH (Shoup's 4-bit tables) for AES-GCM, without calibrating.
+
+       On cores without AES or carry-less multiply instructions, such as the Cortex-M, they encrypt and
+       authenticate bulk transfers (firmware images, log uploads) several times faster than the bitsliced
+       AES and the constant-time GHASH. They are NOT constant-time, see allowVariableTime(). The AES-GCM
+       cipher suites then use them in the clients the profile is applied to, the other clients aren't
+       affected. tools/bearssl_bench measures the gain on a host. This implies allowVariableTime(true).
+    */
+    void useTableGcm()
+    {
+      m_variable_time   = true;
+      m_choice[AES_CTR] = AES_BIG;
+      m_ns[AES_CTR]     = 0;
+      m_choice[GHASH]   = GHASH_SHOUP4;
+      m_ns[GHASH]       = 0;
+    }
+
+    /**
+       @brief Install the chosen implementations into a client context and its X.509 validation context.
+       @pre The client isn't connected
+    */
+    void apply(br_ssl_client_context* cc, br_x509_minimal_context* xc) const
+    {
+      br_ssl_engine_context* eng = &cc->eng;
+      Impl impl;
+
+      if (m_get(RSA, m_choice[RSA], impl))
+      {
+        br_ssl_client_set_rsapub(cc, impl.rsa.pub);
+        br_ssl_engine_set_rsavrfy(eng, impl.rsa.vrfy);
+        br_x509_minimal_set_rsa(xc, impl.rsa.vrfy);
+      }
+
+      if (m_get(EC, m_choice[EC], impl))
+        br_ssl_engine_set_ec(eng, impl.ec);
+
+      if (m_get(ECDSA, m_choice[ECDSA], impl))
+        br_ssl_engine_set_ecdsa(eng, impl.ecdsa);
+
+      br_x509_minimal_set_ecdsa(xc, br_ssl_engine_get_ec(eng), br_ssl_engine_get_ecdsa(eng));
+
+      // the variable-time ones only with the opt-in, also when the choices come from deserialize()
+      if (m_candidate(AES_CTR, m_choice[AES_CTR]) && m_get(AES_CTR, m_choice[AES_CTR], impl))
+        br_ssl_engine_set_aes_ctr(eng, impl.ctr);
+
+      if (m_candidate(AES_CBC, m_choice[AES_CBC]) && m_get(AES_CBC, m_choice[AES_CBC], impl))
+        br_ssl_engine_set_aes_cbc(eng, impl.cbc.enc, impl.cbc.dec);
+
+      if (m_candidate(GHASH, m_choice[GHASH]) && m_get(GHASH, m_choice[GHASH], impl))
+        br_ssl_engine_set_ghash(eng, impl.ghash);
+
+      if (m_get(CHACHA20, m_choice[CHACHA20], impl))
+        br_ssl_engine_set_chacha20(eng, impl.chacha20);
+
+      if (m_get(POLY1305, m_choice[POLY1305], impl))
+        br_ssl_engine_set_poly1305(eng, impl.poly1305);
+    }
+
+    /** @brief The chosen implementation of a primitive, DEFAULT_IMPL if it wasn't calibrated */
+    uint8_t choice(const Primitive p) const
+    {
+      return m_choice[p];
+    }
+
+    /** @brief The name of the chosen implementation of a primitive, e.g. "i31" or "ct64" */
+    const char* name(const Primitive p) const
+    {
+      return m_name(p, m_choice[p]);
+    }
+
+    /** @brief Time of one test operation with the chosen implementation, in ns, 0 if not calibrated in this boot */
+    unsigned long cost(const Primitive p) const
+    {
+      return m_ns[p];
+    }
+
+    /** @brief Number of bytes written by serialize() */
+    size_t serializedSize() const
+    {
+      return HEADER_SZ + NUM_PRIMITIVES + FLAGS_SZ + CHECKSUM_SZ;
+    }
+
+    /**
+       @brief Write the choices to buf, to be restored at boot instead of calibrating again
+
+       The format is versioned and checksummed, deserialize() rejects data of another
+       version or which was corrupted.
+
+       @returns The number of bytes written, 0 if len is smaller than serializedSize()
+    */
+    size_t serialize(uint8_t* buf, const size_t len) const
+    {
+      if (buf == nullptr || len < serializedSize())
+        return 0;
+
+      size_t pos = 0;
+
+      buf[pos++] = MAGIC_0;
+      buf[pos++] = MAGIC_1;
+      buf[pos++] = FORMAT_VERSION;
+      buf[pos++] = NUM_PRIMITIVES;
+
+      for (size_t p = 0; p < NUM_PRIMITIVES; p++)
+        buf[pos++] = m_choice[p];
+
+      buf[pos++] = m_variable_time ? FLAG_VARIABLE_TIME : 0;
+
+      const uint32_t sum = m_fnv(buf, pos);
+
+      for (int i = 0; i < 4; i++)
+        buf[pos++] = (sum >> (8 * i)) & 0xFF;
+
+      return pos;
+    }
+
+    /**
+       @brief Restore the choices written by serialize()
+
+       A choice which isn't available in this firmware, e.g. after a change of the BearSSL
+       configuration, is ignored by apply().
+
+       @returns false if the data is invalid, the choices are then unchanged
+    */
+    bool deserialize(const uint8_t* buf, const size_t len)
+    {
+      if (buf == nullptr || len < serializedSize() || buf[0] != MAGIC_0 || buf[1] != MAGIC_1
+          || buf[2] != FORMAT_VERSION || buf[3] != NUM_PRIMITIVES)
+        return false;
+
+      const size_t pos = HEADER_SZ + NUM_PRIMITIVES + FLAGS_SZ;
+      uint32_t sum = 0;
+
+      for (int i = 0; i < 4; i++)
+        sum |= (uint32_t) buf[pos + i] << (8 * i);
+
+      if (sum != m_fnv(buf, pos))
+        return false;
+
+      for (size_t p = 0; p < NUM_PRIMITIVES; p++)
+      {
+        m_choice[p] = buf[HEADER_SZ + p];
+        m_ns[p]     = 0;
+      }
+
+      m_variable_time = (buf[HEADER_SZ + NUM_PRIMITIVES] & FLAG_VARIABLE_TIME) != 0;
+
+      return true;
+    }
+
+  private:
+
+    static const uint8_t  MAGIC_0         = 'C';
+    static const uint8_t  MAGIC_1         = 'P';
+    static const uint8_t  FORMAT_VERSION  = 2;
+    static const size_t   HEADER_SZ       = 4;
+    static const size_t   FLAGS_SZ        = 1;
+    // the variable-time implementations were allowed, see allowVariableTime()
+    static const uint8_t  FLAG_VARIABLE_TIME = 0x01;
+    static const size_t   CHECKSUM_SZ     = 4;
+    // test input of the block ciphers and MACs, and largest result kept for comparison (the RSA one)
+    static const size_t   DATA_SZ         = 256;
+    static const size_t   REF_SZ   = 256;
+    // indexes of the implementations which aren't constant-time, after the other ones
+    static const uint8_t  AES_BIG         = 4;
+    static const uint8_t  GHASH_SHOUP4    = 5;
+
+    struct Impl
+    {
+      struct
+      {
+        br_rsa_public       pub;
+        br_rsa_pkcs1_vrfy   vrfy;
+      } rsa;
+
+      const br_ec_impl*     ec;
+      br_ecdsa_vrfy         ecdsa;
+      const br_block_ctr_class* ctr;
+
+      struct
+      {
+        const br_block_cbcenc_class*  enc;
+        const br_block_cbcdec_class*  dec;
+      } cbc;
+
+      br_ghash              ghash;
+      br_chacha20_run       chacha20;
+      br_poly1305_run       poly1305;
+    };
+
+    // br_ec_all_m31 with the 62 or 64-bit P-256 and Curve25519 implementations (m64 needs a 64x64->128 bit
+    // multiply), get() returns NULL where they aren't available, like the AES-NI and POWER8 ones
+    template <bool M64>
+    struct EcWide
+    {
+      static const br_ec_impl* part(const int curve)
+      {
+        switch (curve)
+        {
+          case BR_EC_secp256r1:   return M64 ? br_ec_p256_m64_get() : br_ec_p256_m62_get();
+          case BR_EC_curve25519:  return M64 ? br_ec_c25519_m64_get() : br_ec_c25519_m62_get();
+          default:                return &br_ec_prime_i31;
+        }
+      }
+
+      static const unsigned char* generator(int curve, size_t* len)
+      {
+        return part(curve)->generator(curve, len);
+      }
+
+      static const unsigned char* order(int curve, size_t* len)
+      {
+        return part(curve)->order(curve, len);
+      }
+
+      static size_t xoff(int curve, size_t* len)
+      {
+        return part(curve)->xoff(curve, len);
+      }
+
+      static uint32_t mul(unsigned char* G, size_t Glen, const unsigned char* x, size_t xlen, int curve)
+      {
+        return part(curve)->mul(G, Glen, x, xlen, curve);
+      }
+
+      static size_t mulgen(unsigned char* R, const unsigned char* x, size_t xlen, int curve)
+      {
+        return part(curve)->mulgen(R, x, xlen, curve);
+      }
+
+      static uint32_t muladd(unsigned char* A, const unsigned char* B, size_t len, const unsigned char* x,
+                             size_t xlen, const unsigned char* y, size_t ylen, int curve)
+      {
+        return part(curve)->muladd(A, B, len, x, xlen, y, ylen, curve);
+      }
+
+      static const br_ec_impl* get()
+      {
+        static const br_ec_impl impl =
+        {
+          br_ec_all_m31.supported_curves, &generator, &order, &xoff, &mul, &mulgen, &muladd
+        };
+
+        return (part(BR_EC_secp256r1) && part(BR_EC_curve25519)) ? &impl : nullptr;
+      }
+    };
+
+    static uint8_t m_num_impls(const Primitive p)
+    {
+      static const uint8_t counts[NUM_PRIMITIVES] = { 4, 4, 2, 5, 5, 6, 2, 4 };
+
+      return counts[p];
+    }
+
+    static const char* m_name(const Primitive p, const uint8_t index)
+    {
+      static const char* const names[NUM_PRIMITIVES][6] =
+      {
+        { "i15", "i31", "i32", "i62" },
+        { "m15", "m31", "m62", "m64" },
+        { "i15", "i31" },
+        { "ct", "ct64", "x86ni", "pwr8", "big" },
+        { "ct", "ct64", "x86ni", "pwr8", "big" },
+        { "ctmul", "ctmul32", "ctmul64", "pclmul", "pwr8", "shoup4" },
+        { "ct", "sse2" },
+        { "ctmul", "ctmul32", "ctmulq", "i15" }
+      };
+
+      return (index < m_num_impls(p)) ? names[p][index] : "default";
+    }
+
+    // the implementation number index of a primitive, false if it isn't available on this CPU or in this build
+    static bool m_get(const Primitive p, const uint8_t index, Impl& impl)
+    {
+      switch (p)
+      {
+        case RSA:
+          switch (index)
+          {
+            case 0: impl.rsa.pub = &br_rsa_i15_public;  impl.rsa.vrfy = &br_rsa_i15_pkcs1_vrfy;   return true;
+            case 1: impl.rsa.pub = &br_rsa_i31_public;  impl.rsa.vrfy = &br_rsa_i31_pkcs1_vrfy;   return true;
+            case 2: impl.rsa.pub = &br_rsa_i32_public;  impl.rsa.vrfy = &br_rsa_i32_pkcs1_vrfy;   return true;
+            case 3: impl.rsa.pub = br_rsa_i62_public_get();  impl.rsa.vrfy = br_rsa_i62_pkcs1_vrfy_get();
+              return impl.rsa.pub && impl.rsa.vrfy;
+          }
+          break;
+
+        case EC:
+          switch (index)
+          {
+            case 0: impl.ec = &br_ec_all_m15;   return true;
+            case 1: impl.ec = &br_ec_all_m31;   return true;
+            case 2: impl.ec = EcWide<false>::get();   return impl.ec != nullptr;
+            case 3: impl.ec = EcWide<true>::get();    return impl.ec != nullptr;
+          }
+          break;
+
+        case ECDSA:
+          switch (index)
+          {
+            case 0: impl.ecdsa = &br_ecdsa_i15_vrfy_asn1;   return true;
+            case 1: impl.ecdsa = &br_ecdsa_i31_vrfy_asn1;   return true;
+          }
+          break;
+
+        case AES_CTR:
+          switch (index)
+          {
+            case 0: impl.ctr = &br_aes_ct_ctr_vtable;           return true;
+            case 1: impl.ctr = &br_aes_ct64_ctr_vtable;         return true;
+            case 2: impl.ctr = br_aes_x86ni_ctr_get_vtable();   return impl.ctr != nullptr;
+            case 3: impl.ctr = br_aes_pwr8_ctr_get_vtable();    return impl.ctr != nullptr;
+            case 4: impl.ctr = &br_aes_big_ctr_vtable;          return true;
+          }
+          break;
+
+        case AES_CBC:
+          switch (index)
+          {
+            case 0: impl.cbc.enc = &br_aes_ct_cbcenc_vtable;    impl.cbc.dec = &br_aes_ct_cbcdec_vtable;    return true;
+            case 1: impl.cbc.enc = &br_aes_ct64_cbcenc_vtable;  impl.cbc.dec = &br_aes_ct64_cbcdec_vtable;  return true;
+            case 2: impl.cbc.enc = br_aes_x86ni_cbcenc_get_vtable();  impl.cbc.dec = br_aes_x86ni_cbcdec_get_vtable();
+              return impl.cbc.enc && impl.cbc.dec;
+            case 3: impl.cbc.enc = br_aes_pwr8_cbcenc_get_vtable();   impl.cbc.dec = br_aes_pwr8_cbcdec_get_vtable();
+              return impl.cbc.enc && impl.cbc.dec;
+            case 4: impl.cbc.enc = &br_aes_big_cbcenc_vtable;   impl.cbc.dec = &br_aes_big_cbcdec_vtable;   return true;
+          }
+          break;
+
+        case GHASH:
+          switch (index)
+          {
+            case 0: impl.ghash = &br_ghash_ctmul;           return true;
+            case 1: impl.ghash = &br_ghash_ctmul32;         return true;
+            case 2: impl.ghash = &br_ghash_ctmul64;         return true;
+            case 3: impl.ghash = br_ghash_pclmul_get();     return impl.ghash != 0;
+            case 4: impl.ghash = br_ghash_pwr8_get();       return impl.ghash != 0;
+            case 5: impl.ghash = &br_ghash_shoup4;          return true;
+          }
+          break;
+
+        case CHACHA20:
+          switch (index)
+          {
+            case 0: impl.chacha20 = &br_chacha20_ct_run;      return true;
+            case 1: impl.chacha20 = br_chacha20_sse2_get();   return impl.chacha20 != 0;
+          }
+          break;
+
+        case POLY1305:
+          switch (index)
+          {
+            case 0: impl.poly1305 = &br_poly1305_ctmul_run;     return true;
+            case 1: impl.poly1305 = &br_poly1305_ctmul32_run;   return true;
+            case 2: impl.poly1305 = br_poly1305_ctmulq_get();   return impl.poly1305 != 0;
+            case 3: impl.poly1305 = &br_poly1305_i15_run;       return true;
+          }
+          break;
+
+        default:
+          break;
+      }
+
+      return false;
+    }
+
+    // false for the implementations which aren't constant-time, unless allowVariableTime()
+    bool m_candidate(const Primitive p, const uint8_t index) const
+    {
+      if (m_variable_time)
+        return true;
+
+      return !(((p == AES_CTR || p == AES_CBC) && index == AES_BIG) || (p == GHASH && index == GHASH_SHOUP4));
+    }
+
+    // deterministic test data, the values don't matter
+    static void m_fill(uint8_t* buf, const size_t len, uint32_t seed)
+    {
+      for (size_t i = 0; i < len; i++)
+      {
+        seed = seed * 1103515245UL + 12345;
+        buf[i] = (uint8_t) (seed >> 16);
+      }
+    }
+
+    /*
+       Run the implementation number index of p on a test input for about slice_us, at least once, and
+       set ns to the time of one run. The result of the first implementation which runs is kept in
+       reference, the others must give the same one. Returns false if the implementation isn't available
+       or fails.
+    */
+    bool m_time(const Primitive p, const uint8_t index, const unsigned long slice_us,
+                uint8_t* reference, bool& has_reference, unsigned long& ns) const
+    {
+      Impl impl;
+
+      if (!m_get(p, index, impl))
+        return false;
+
+      uint8_t key[32], iv[16], data[DATA_SZ], out[DATA_SZ];
+      size_t out_len = 0;
+      bool ok = true;
+
+      m_fill(key, sizeof key, 1);
+      m_fill(iv, sizeof iv, 2);
+      m_fill(data, sizeof data, 3);
+
+      // state of the operation, set up once
+      static unsigned char rsa_e[] = { 0x01, 0x00, 0x01 };
+      br_rsa_public_key rsa_pk;
+      br_ec_private_key ec_sk;
+      br_ec_public_key ec_pk;
+      uint8_t ec_pub[BR_EC_KBUF_PUB_MAX_SIZE], sig[80];
+      size_t sig_len = 0;
+      const br_ec_impl* iec = nullptr;
+      br_aes_gen_ctr_keys ctr;
+      br_aes_gen_cbcenc_keys cbcenc;
+      br_aes_gen_cbcdec_keys cbcdec;
+
+      switch (p)
+      {
+        case RSA:
+          // any odd modulus does for timing, the result is compared between implementations
+          m_fill(data, sizeof data, 4);
+          data[0] |= 0x80;
+          data[sizeof data - 1] |= 0x01;
+          rsa_pk.n    = data;
+          rsa_pk.nlen = sizeof data;
+          rsa_pk.e    = rsa_e;
+          rsa_pk.elen = 3;
+          out_len     = sizeof data;
+          break;
+
+        case EC:
+          out_len = 65;
+          break;
+
+        case ECDSA:
+        {
+          Impl ec;
+
+          iec = m_get(EC, m_choice[EC], ec) ? ec.ec : br_ec_get_default();
+
+          // sign the test hash with a test key, the verification must succeed
+          ec_sk.curve = BR_EC_secp256r1;
+          ec_sk.x     = key;
+          ec_sk.xlen  = sizeof key;
+
+          if (br_ec_compute_pub(iec, &ec_pk, ec_pub, &ec_sk) == 0)
+            return false;
+
+          sig_len = br_ecdsa_i31_sign_raw(iec, &br_sha256_vtable, data, &ec_sk, sig);
+          sig_len = br_ecdsa_raw_to_asn1(sig, sig_len);
+
+          if (sig_len == 0)
+            return false;
+
+          break;
+        }
+
+        case AES_CTR:
+          impl.ctr->init(&ctr.vtable, key, 16);
+          out_len = sizeof out;
+          break;
+
+        case AES_CBC:
+          impl.cbc.enc->init(&cbcenc.vtable, key, 16);
+          impl.cbc.dec->init(&cbcdec.vtable, key, 16);
+          out_len = sizeof out;
+          break;
+
+        case GHASH:
+        case POLY1305:
+          out_len = 16;
+          break;
+
+        case CHACHA20:
+          out_len = sizeof out;
+          break;
+
+        default:
+          return false;
+      }
+
+      unsigned long runs = 0;
+      const unsigned long start = micros();
+
+      do
+      {
+        switch (p)
+        {
+          case RSA:
+            m_fill(out, sizeof data, 5);
+            out[0] &= 0x7F;
+            ok = impl.rsa.pub(out, sizeof data, &rsa_pk) != 0;
+            break;
+
+          case EC:
+          {
+            size_t glen;
+            // glen is set by generator(), before the copy
+            const unsigned char* g = impl.ec->generator(BR_EC_secp256r1, &glen);
+
+            memcpy(out, g, glen);
+            ok = impl.ec->mul(out, glen, key, sizeof key, BR_EC_secp256r1) != 0;
+            break;
+          }
+
+          case ECDSA:
+            ok = impl.ecdsa(iec, data, 32, &ec_pk, sig, sig_len) == 1;
+            break;
+
+          case AES_CTR:
+            memcpy(out, data, sizeof data);
+            impl.ctr->run(&ctr.vtable, iv, 1, out, sizeof out);
+            break;
+
+          case AES_CBC:
+          {
+            uint8_t civ[16];
+
+            memcpy(out, data, sizeof data);
+            memcpy(civ, iv, sizeof civ);
+            impl.cbc.enc->run(&cbcenc.vtable, civ, out, sizeof out);
+            memcpy(civ, iv, sizeof civ);
+            impl.cbc.dec->run(&cbcdec.vtable, civ, out, sizeof out);
+            ok = memcmp(out, data, sizeof data) == 0;
+            // compare the decryption, and the last block of the encryption through its chaining
+            memcpy(out, civ, sizeof civ);
+            break;
+          }
+
+          case GHASH:
+            memset(out, 0, 16);
+            impl.ghash(out, key, data, sizeof data);
+            break;
+
+          case CHACHA20:
+            memcpy(out, data, sizeof data);
+            impl.chacha20(key, iv, 1, out, sizeof out);
+            break;
+
+          case POLY1305:
+          {
+            uint8_t buf[DATA_SZ];
+
+            memcpy(buf, data, sizeof buf);
+            impl.poly1305(key, iv, buf, sizeof buf, iv, 13, out, &br_chacha20_ct_run, 1);
+            break;
+          }
+
+          default:
+            break;
+        }
+
+        if (!ok)
+          return false;
+
+        if (runs++ == 0 && out_len > 0)
+        {
+          if (!has_reference)
+          {
+            memcpy(reference, out, out_len);
+            has_reference = true;
+          }
+          else if (memcmp(reference, out, out_len) != 0)
+            return false;
+        }
+      } while (micros() - start < slice_us);
+
+      // in ns, the fast primitives take less than a microsecond on some cores
+      ns = (unsigned long) (((uint64_t) (micros() - start) * 1000) / runs);
+
+      return true;
+    }
+
+    static uint32_t m_fnv(const uint8_t* data, const size_t len)
+    {
+      uint32_t hash = 2166136261UL;
+
+      for (size_t i = 0; i < len; i++)
+      {
+        hash ^= data[i];
+        hash *= 16777619UL;
+      }
+
+      return hash;
+    }
+
+    uint8_t         m_choice[NUM_PRIMITIVES];
+    unsigned long   m_ns[NUM_PRIMITIVES];
+    bool            m_variable_time;
+};
@@ -0,0 +1,335 @@
+/**
+   SSLKeyPool.h
+
+   This file contains a pool of ECDHE key pairs, generated in idle time and
+   used by the handshakes of EthernetSSLClient instead of generating one inline.
+*/
+
+#pragma once
+
+#include "SSLClient/bearssl.h"
+#include "Arduino.h"
+
+// Permit redefinition of SSLCLIENT_KEY_POOL_SIZE in sketch. Number of key pairs kept per curve
+// by SSLKeyPool, each takes about 100 bytes
+#ifndef SSLCLIENT_KEY_POOL_SIZE
+  #define SSLCLIENT_KEY_POOL_SIZE     2
+#elif (SSLCLIENT_KEY_POOL_SIZE < 1)
+  #undef SSLCLIENT_KEY_POOL_SIZE
+  #define SSLCLIENT_KEY_POOL_SIZE     1
+
+  #warning SSLCLIENT_KEY_POOL_SIZE reset to min 1 key pair
+#endif
+
+/**
+   \brief Key pairs for the ECDHE key exchange, computed ahead of the handshakes which use them.
+
+   With an ECDHE cipher suite, the client generates a private key and computes its public point,
+   one multiplication of the curve generator, then multiplies the point of the server. The first
+   multiplication doesn't depend on the server, so SSLKeyPool does it in idle time: call refill()
+   from loop() with a time budget, and give the pool to the clients with EthernetSSLClient::setKeyPool().
+   A handshake takes a key pair for the curve chosen by the server, or generates one as before when
+   the pool has none left.
+
+   Key pairs are for P-256 (secp256r1) and X25519 (curve25519). A key pair is given to a single
+   handshake, and the copy in the pool is wiped when it is taken.
+
+   The private keys are drawn from an HMAC_DRBG of the pool, seeded from micros() as the
+   engine of EthernetSSLClient is. Use seed() to add entropy from a better source.
+*/
+class SSLKeyPool
+{
+  public:
+
+    /** @brief Bit of a curve in the curves given to the constructor */
+    static const uint32_t P256    = (uint32_t) 1 << BR_EC_secp256r1;
+    static const uint32_t X25519  = (uint32_t) 1 << BR_EC_curve25519;
+
+    /**
+       @param curves The curves to generate key pairs for, P256 and/or X25519
+       @param iec The EC implementation, the default one if nullptr
+    */
+    explicit SSLKeyPool(const uint32_t curves = P256 | X25519, const br_ec_impl* iec = nullptr)
+      : m_vtable(&m_class)
+      , m_iec(iec ? iec : br_ec_get_default())
+      , m_curves(curves & m_iec->supported_curves & (P256 | X25519))
+      , m_seeded(false)
+      , m_key_us(0)
+      , m_generated(0)
+      , m_hits(0)
+      , m_misses(0)
+    {
+      memset(m_slots, 0, sizeof m_slots);
+
+      m_class.take = m_take;
+    }
+
+    ~SSLKeyPool()
+    {
+      clear();
+    }
+
+    SSLKeyPool(const SSLKeyPool&) = delete;
+    SSLKeyPool& operator=(const SSLKeyPool&) = delete;
+
+    /** @brief The context to give to br_ssl_client_set_ecdhe_source() */
+    const br_ssl_client_ecdhe_source_class** source()
+    {
+      return &m_vtable;
+    }
+
+    /** @brief Add entropy to the generator of the private keys, e.g. from a hardware RNG */
+    void seed(const void* data, const size_t len)
+    {
+      m_seed();
+      br_hmac_drbg_update(&m_rng, data, len);
+    }
+
+    /**
+       @brief Generate key pairs until the pool is full or the time budget is spent.
+
+       A key pair can't be computed in pieces: one is only started if the time the last one took
+       fits in what's left of the budget, so a call returns within about budget_us. The first call
+       generates one key pair to measure that time.
+
+       @param budget_us The time budget, in microseconds
+       @returns The number of key pairs generated
+    */
+    size_t refill(const unsigned long budget_us)
+    {
+      const unsigned long start = micros();
+      size_t count = 0;
+
+      while (Slot* slot = m_next_empty())
+      {
+        const unsigned long elapsed = micros() - start;
+
+        if (m_key_us != 0 && elapsed + m_key_us > budget_us)
+          break;
+
+        const unsigned long key_start = micros();
+
+        m_generate(*slot);
+
+        m_key_us = micros() - key_start;
+
+        if (m_key_us == 0)
+          m_key_us = 1;
+
+        count++;
+      }
+
+      m_generated += count;
+
+      return count;
+    }
+
+    /** @brief Wipe the key pairs of the pool */
+    void clear()
+    {
+      m_wipe(m_slots, sizeof m_slots);
+    }
+
+    /** @brief true when the pool has SSLCLIENT_KEY_POOL_SIZE key pairs for each curve */
+    bool full()
+    {
+      return m_next_empty() == nullptr;
+    }
+
+    /** @brief Number of key pairs available for a curve, BR_EC_secp256r1 or BR_EC_curve25519 */
+    size_t available(const int curve) const
+    {
+      const int index = m_index(curve);
+      size_t count = 0;
+
+      if (index < 0)
+        return 0;
+
+      for (size_t i = 0; i < SSLCLIENT_KEY_POOL_SIZE; i++)
+      {
+        if (m_slots[index][i].ready)
+          count++;
+      }
+
+      return count;
+    }
+
+    /** @brief Time taken by the last key pair, in microseconds, 0 before the first one */
+    unsigned long keyMicros() const
+    {
+      return m_key_us;
+    }
+
+    /** @brief Number of key pairs generated by refill() */
+    unsigned long generated() const
+    {
+      return m_generated;
+    }
+
+    /** @brief Number of handshakes which used a key pair of the pool */
+    unsigned long hits() const
+    {
+      return m_hits;
+    }
+
+    /** @brief Number of handshakes which found no key pair for their curve, and generated one */
+    unsigned long misses() const
+    {
+      return m_misses;
+    }
+
+  private:
+
+    // P-256 points are uncompressed (65 bytes), X25519 ones are 32 bytes
+    static const size_t KEY_LEN   = 32;
+    static const size_t POINT_LEN = 65;
+    static const size_t NUM_CURVES = 2;
+
+    struct Slot
+    {
+      unsigned char key[KEY_LEN];
+      unsigned char point[POINT_LEN];
+      bool ready;
+    };
+
+    static int m_index(const int curve)
+    {
+      return (curve == BR_EC_secp256r1) ? 0 : (curve == BR_EC_curve25519) ? 1 : -1;
+    }
+
+    static int m_curve(const int index)
+    {
+      return index == 0 ? BR_EC_secp256r1 : BR_EC_curve25519;
+    }
+
+    static void m_wipe(void* dst, size_t len)
+    {
+      volatile unsigned char* p = (volatile unsigned char*) dst;
+
+      while (len-- > 0)
+        *p++ = 0;
+    }
+
+    static int m_take(const br_ssl_client_ecdhe_source_class** ctx, int curve,
+                      unsigned char* key, size_t key_len, unsigned char* point, size_t point_len)
+    {
+      SSLKeyPool* pool = (SSLKeyPool*) (void*) ctx;
+      const int index = m_index(curve);
+
+      if (index >= 0 && (pool->m_curves & ((uint32_t) 1 << curve)))
+      {
+        size_t olen, glen;
+
+        pool->m_iec->order(curve, &olen);
+        pool->m_iec->generator(curve, &glen);
+
+        for (size_t i = 0; olen == key_len && glen == point_len && i < SSLCLIENT_KEY_POOL_SIZE; i++)
+        {
+          Slot& slot = pool->m_slots[index][i];
+
+          if (!slot.ready)
+            continue;
+
+          memcpy(key, slot.key, key_len);
+          memcpy(point, slot.point, point_len);
+          m_wipe(&slot, sizeof slot);
+          pool->m_hits++;
+
+          return 1;
+        }
+      }
+
+      pool->m_misses++;
+
+      return 0;
+    }
+
+    void m_seed()
+    {
+      if (m_seeded)
+        return;
+
+      // as EthernetSSLClient does for its engine
+      uint8_t rng_seeds[16];
+
+      for (uint8_t i = 0; i < sizeof rng_seeds; i++)
+        rng_seeds[i] = static_cast<uint8_t>((uint16_t) micros() * (uint16_t) (micros() >> 8));
+
+      br_hmac_drbg_init(&m_rng, &br_sha256_vtable, rng_seeds, sizeof rng_seeds);
+      m_seeded = true;
+    }
+
+    // the empty slot of the curve with the fewest key pairs, so that every curve gets one first
+    Slot* m_next_empty()
+    {
+      Slot* best = nullptr;
+      size_t best_count = SSLCLIENT_KEY_POOL_SIZE;
+
+      for (size_t c = 0; c < NUM_CURVES; c++)
+      {
+        if (!(m_curves & ((uint32_t) 1 << m_curve(c))))
+          continue;
+
+        const size_t count = available(m_curve(c));
+
+        if (count >= best_count)
+          continue;
+
+        for (size_t i = 0; i < SSLCLIENT_KEY_POOL_SIZE; i++)
+        {
+          if (!m_slots[c][i].ready)
+          {
+            best = &m_slots[c][i];
+            best_count = count;
+
+            break;
+          }
+        }
+      }
+
+      return best;
+    }
+
+    // same key generation as the handshake (ssl_hs_client.c): a random value below the
+    // curve order, with the top bits cleared and the bottom bit set
+    void m_generate(Slot& slot)
+    {
+      const int curve = m_curve((&slot - &m_slots[0][0]) / SSLCLIENT_KEY_POOL_SIZE);
+      size_t olen, glen;
+      const unsigned char* order = m_iec->order(curve, &olen);
+      const unsigned char* gen = m_iec->generator(curve, &glen);
+      unsigned char mask = 0xFF;
+
+      while (mask >= order[0])
+        mask >>= 1;
+
+      m_seed();
+
+      // a little more entropy each time, the timing of the loop varies
+      const unsigned long now = micros();
+      br_hmac_drbg_update(&m_rng, &now, sizeof now);
+
+      br_hmac_drbg_generate(&m_rng, slot.key, olen);
+      slot.key[0] &= mask;
+      slot.key[olen - 1] |= 0x01;
+
+      memcpy(slot.point, gen, glen);
+      slot.ready = m_iec->mulgen(slot.point, slot.key, olen, curve) == glen;
+
+      if (!slot.ready)
+        m_wipe(&slot, sizeof slot);
+    }
+
+    // first member, the engine calls take() with a pointer to it
+    const br_ssl_client_ecdhe_source_class*  m_vtable;
+    br_ssl_client_ecdhe_source_class         m_class;
+    const br_ec_impl*                        m_iec;
+    uint32_t                                 m_curves;
+    br_hmac_drbg_context                     m_rng;
+    bool                                     m_seeded;
+    unsigned long                            m_key_us;
+    unsigned long                            m_generated;
+    unsigned long                            m_hits;
+    unsigned long                            m_misses;
+    Slot                                     m_slots[NUM_CURVES][SSLCLIENT_KEY_POOL_SIZE];
+};
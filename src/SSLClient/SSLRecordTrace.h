@@ -0,0 +1,153 @@
+/**
+   SSLRecordTrace.h
+
+   This file contains a parser of the TLS record stream in one direction, which
+   counts the records and reports the handshake messages sent in clear, for the
+   statistics of EthernetSSLClient (SSLCLIENT_STATS).
+*/
+
+#pragma once
+
+#include "Arduino.h"
+
+/**
+   \brief Follows the records of one direction of a TLS connection, as written to or read from the socket.
+
+   The 5 bytes header of each record is in clear, so every record is counted. Until the ChangeCipherSpec
+   of that direction, the handshake messages are in clear too: process() reports those which were
+   completed by the bytes given, e.g. the ServerHello and the Certificate of the server, or the
+   ClientKeyExchange of the client. The contents are skipped, not copied, and nothing is checked:
+   BearSSL validates the stream, this only observes it.
+*/
+class SSLRecordTrace
+{
+  public:
+
+    /** @brief Bit of process() for a handshake message type, e.g. message(2) for the ServerHello */
+    static constexpr uint32_t message(const uint8_t type)
+    {
+      return type < 31 ? (uint32_t) 1 << type : 0;
+    }
+
+    /** @brief Bit of process() for the ChangeCipherSpec record, after which the handshake is encrypted */
+    static const uint32_t CHANGE_CIPHER_SPEC = (uint32_t) 1 << 31;
+
+    SSLRecordTrace()
+    {
+      reset();
+    }
+
+    /** @brief Start over, for a new connection */
+    void reset()
+    {
+      m_hdr_len     = 0;
+      m_rec_left    = 0;
+      m_msg_len     = 0;
+      m_msg_left    = 0;
+      m_encrypted   = false;
+      m_records     = 0;
+    }
+
+    /**
+       @brief Follow the next len bytes of the stream.
+       @returns The message() bits of the handshake messages completed by these bytes, and CHANGE_CIPHER_SPEC
+    */
+    uint32_t process(const unsigned char* buf, size_t len)
+    {
+      uint32_t done = 0;
+
+      while (len > 0)
+      {
+        if (m_rec_left == 0)
+        {
+          m_hdr[m_hdr_len++] = *buf++;
+          len--;
+
+          if (m_hdr_len < sizeof m_hdr)
+            continue;
+
+          m_hdr_len  = 0;
+          m_rec_left = ((size_t) m_hdr[3] << 8) | m_hdr[4];
+          m_records++;
+
+          if (m_hdr[0] == CONTENT_CHANGE_CIPHER_SPEC)
+          {
+            m_encrypted = true;
+            done |= CHANGE_CIPHER_SPEC;
+          }
+
+          continue;
+        }
+
+        const size_t n = len < m_rec_left ? len : m_rec_left;
+
+        if (m_hdr[0] == CONTENT_HANDSHAKE && !m_encrypted)
+          done |= m_handshake(buf, n);
+
+        buf        += n;
+        len        -= n;
+        m_rec_left -= n;
+      }
+
+      return done;
+    }
+
+    /** @brief Number of records, complete or started */
+    unsigned long records() const
+    {
+      return m_records;
+    }
+
+  private:
+
+    static const uint8_t CONTENT_CHANGE_CIPHER_SPEC = 20;
+    static const uint8_t CONTENT_HANDSHAKE          = 22;
+
+    // the handshake messages are a stream of their own, which can span records
+    uint32_t m_handshake(const unsigned char* buf, size_t len)
+    {
+      uint32_t done = 0;
+
+      while (len > 0)
+      {
+        if (m_msg_len < sizeof m_msg)
+        {
+          m_msg[m_msg_len++] = *buf++;
+          len--;
+
+          if (m_msg_len < sizeof m_msg)
+            continue;
+
+          m_msg_left = ((uint32_t) m_msg[1] << 16) | ((uint32_t) m_msg[2] << 8) | m_msg[3];
+        }
+        else
+        {
+          const size_t n = len < m_msg_left ? len : m_msg_left;
+
+          buf        += n;
+          len        -= n;
+          m_msg_left -= n;
+        }
+
+        // empty messages, e.g. ServerHelloDone, are complete with their header
+        if (m_msg_left == 0)
+        {
+          done |= message(m_msg[0]);
+          m_msg_len = 0;
+        }
+      }
+
+      return done;
+    }
+
+    // header of the current record, and bytes of it not yet seen
+    uint8_t         m_hdr[5];
+    uint8_t         m_hdr_len;
+    size_t          m_rec_left;
+    // header of the current handshake message, and bytes of it not yet seen
+    uint8_t         m_msg[4];
+    uint8_t         m_msg_len;
+    uint32_t        m_msg_left;
+    bool            m_encrypted;
+    unsigned long   m_records;
+};
@@ -57,7 +57,9 @@ class SSLSession : public br_ssl_session_parameters
        Sets all parameters to zero, and invalidates the session
     */
     SSLSession(const char* hostname) : m_hostname(hostname)
-    {}
+    {
+      memset(to_br_session(), 0, sizeof(br_ssl_session_parameters));
+    }
 
     /**
        @brief Get the hostname string associated with this session
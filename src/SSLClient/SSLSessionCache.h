@@ -0,0 +1,490 @@
+/**
+   SSLSessionCache.h
+
+   This file contains a fixed-size store of SSLSession objects, shared by all
+   EthernetSSLClient instances, which can be saved to and restored from flash.
+*/
+
+#pragma once
+
+#include "SSLClient/SSLSession.h"
+
+// Permit redefinition of SSLCLIENT_SESSION_CACHE_SIZE in sketch. Number of sessions kept by
+// SSLSessionCache::shared(), each takes about 120 bytes of heap, twice as many slots are allocated
+#ifndef SSLCLIENT_SESSION_CACHE_SIZE
+  #define SSLCLIENT_SESSION_CACHE_SIZE    4
+#elif (SSLCLIENT_SESSION_CACHE_SIZE < 1)
+  #undef SSLCLIENT_SESSION_CACHE_SIZE
+  #define SSLCLIENT_SESSION_CACHE_SIZE    1
+
+  #warning SSLCLIENT_SESSION_CACHE_SIZE reset to min 1 session
+#endif
+
+/**
+   \brief A session store keyed by hostname and port, or by IP address, port and optional SNI name,
+   with least recently used eviction.
+
+   Sessions are kept in an open-addressing hash table (linear probing) with twice as many
+   slots as sessions, so a lookup is a hash and usually a single hostname comparison.
+   When the cache is full, the least recently used session is replaced.
+
+   SSLSessionCache::shared() is used by every EthernetSSLClient unless another cache is
+   set with EthernetSSLClient::setSessionCache(), so a session negotiated by one client
+   can be resumed by another. serialize() and deserialize() save the sessions to flash,
+   EEPROM or backup SRAM and restore them at boot, so that the first connection after a reset
+   is resumed instead of running a full handshake.
+
+   The serialized sessions contain the master secrets, anyone who can read them can decrypt
+   the recorded traffic of these sessions. Store them where the firmware is stored.
+*/
+class SSLSessionCache
+{
+  public:
+
+    /**
+       @brief Create a cache holding up to capacity sessions
+
+       @param capacity The maximum number of sessions, from 1 to 255
+    */
+    explicit SSLSessionCache(const size_t capacity)
+      : m_capacity(capacity ? (capacity > 255 ? 255 : capacity) : 1)
+      , m_mask(0)
+      , m_size(0)
+      , m_clock(0)
+    {
+      size_t slots = 2;
+
+      while (slots < 2 * m_capacity)
+        slots <<= 1;
+
+      m_slots = new Slot[slots];
+      m_mask  = m_slots ? slots - 1 : 0;
+    }
+
+    ~SSLSessionCache()
+    {
+      if (m_slots)
+        delete [] m_slots;
+    }
+
+    SSLSessionCache(const SSLSessionCache&) = delete;
+    SSLSessionCache& operator=(const SSLSessionCache&) = delete;
+
+    /** @brief The cache used by all EthernetSSLClient instances by default, holding SSLCLIENT_SESSION_CACHE_SIZE sessions */
+    static SSLSessionCache& shared()
+    {
+      static SSLSessionCache cache(SSLCLIENT_SESSION_CACHE_SIZE);
+
+      return cache;
+    }
+
+    /**
+       @brief Find the session of a host, and mark it as the most recently used
+
+       @returns A pointer to the session, or nullptr if there is none. The pointer is only valid
+       until the next insert(), remove() or deserialize().
+    */
+    SSLSession* find(const char* host, const uint16_t port)
+    {
+      return m_lookup(host, 0, port);
+    }
+
+    /**
+       @brief Find the session of a server connected to by IP address
+
+       @param sni The server name sent and verified for the connection, or nullptr if none
+    */
+    SSLSession* find(const IPAddress& ip, const uint16_t port, const char* sni = nullptr)
+    {
+      return m_lookup(sni ? sni : "", m_ip(ip), port);
+    }
+
+    /**
+       @brief Get the session of a host, creating an empty one if there is none
+
+       If the cache is full, the least recently used session is replaced.
+
+       @returns A pointer to the session, or nullptr if host is nullptr, empty or longer than 255
+       characters. The pointer is only valid until the next insert(), remove() or deserialize().
+    */
+    SSLSession* insert(const char* host, const uint16_t port)
+    {
+      if (host == nullptr || host[0] == '\0')
+        return nullptr;
+
+      return m_insert(host, 0, port);
+    }
+
+    /** @brief Get the session of a server connected to by IP address, creating an empty one if there is none */
+    SSLSession* insert(const IPAddress& ip, const uint16_t port, const char* sni = nullptr)
+    {
+      const uint32_t addr = m_ip(ip);
+
+      if (addr == 0)
+        return nullptr;
+
+      return m_insert(sni ? sni : "", addr, port);
+    }
+
+    /**
+       @brief Remove the session of a host
+
+       @returns true if there was one
+    */
+    bool remove(const char* host, const uint16_t port)
+    {
+      return m_remove(host, 0, port);
+    }
+
+    /** @brief Remove the session of a server connected to by IP address */
+    bool remove(const IPAddress& ip, const uint16_t port, const char* sni = nullptr)
+    {
+      return m_remove(sni ? sni : "", m_ip(ip), port);
+    }
+
+    /** @brief Remove all the sessions */
+    void clear()
+    {
+      for (size_t i = 0; i <= m_mask && m_slots; i++)
+        m_slots[i] = Slot();
+
+      m_size = 0;
+    }
+
+    /** @brief Number of sessions stored */
+    size_t size() const
+    {
+      return m_size;
+    }
+
+    /** @brief Maximum number of sessions */
+    size_t capacity() const
+    {
+      return m_capacity;
+    }
+
+    /** @brief Number of bytes serialize() needs for the current sessions */
+    size_t serializedSize() const
+    {
+      size_t len = HEADER_SZ + CHECKSUM_SZ;
+
+      for (size_t i = 0; i <= m_mask && m_slots; i++)
+      {
+        if (m_slots[i].used)
+          len += ENTRY_SZ + m_slots[i].session.get_hostname().length();
+      }
+
+      return len;
+    }
+
+    /**
+       @brief Write the sessions to buf, from the least to the most recently used
+
+       The format is versioned and checksummed, deserialize() rejects data of another
+       version or which was corrupted.
+
+       @returns The number of bytes written, 0 if len is smaller than serializedSize()
+    */
+    size_t serialize(uint8_t* buf, const size_t len) const
+    {
+      if (buf == nullptr || len < serializedSize())
+        return 0;
+
+      size_t pos = 0;
+
+      buf[pos++] = MAGIC_0;
+      buf[pos++] = MAGIC_1;
+      buf[pos++] = FORMAT_VERSION;
+      buf[pos++] = (uint8_t) m_size;
+
+      uint32_t last = 0;
+
+      for (size_t n = 0; n < m_size; n++)
+      {
+        // next session in LRU order
+        int index = -1;
+
+        for (size_t i = 0; i <= m_mask; i++)
+        {
+          if (m_slots[i].used && m_slots[i].stamp > last && (index < 0 || m_slots[i].stamp < m_slots[index].stamp))
+            index = i;
+        }
+
+        if (index < 0)
+          break;
+
+        last = m_slots[index].stamp;
+
+        const Slot& slot = m_slots[index];
+        const String& host = slot.session.get_hostname();
+
+        for (int i = 0; i < 4; i++)
+          buf[pos++] = (slot.ip >> (8 * i)) & 0xFF;
+
+        buf[pos++] = slot.port & 0xFF;
+        buf[pos++] = slot.port >> 8;
+        buf[pos++] = (uint8_t) host.length();
+        memcpy(buf + pos, host.c_str(), host.length());
+        pos += host.length();
+
+        buf[pos++] = slot.session.session_id_len;
+        memcpy(buf + pos, slot.session.session_id, sizeof(slot.session.session_id));
+        pos += sizeof(slot.session.session_id);
+        buf[pos++] = slot.session.version & 0xFF;
+        buf[pos++] = slot.session.version >> 8;
+        buf[pos++] = slot.session.cipher_suite & 0xFF;
+        buf[pos++] = slot.session.cipher_suite >> 8;
+        memcpy(buf + pos, slot.session.master_secret, sizeof(slot.session.master_secret));
+        pos += sizeof(slot.session.master_secret);
+      }
+
+      const uint32_t sum = m_fnv(buf, pos, FNV_BASIS);
+
+      for (int i = 0; i < 4; i++)
+        buf[pos++] = (sum >> (8 * i)) & 0xFF;
+
+      return pos;
+    }
+
+    /**
+       @brief Restore sessions written by serialize(), adding them to the ones in the cache
+
+       If there are more sessions than the capacity, the least recently used ones are dropped.
+
+       @returns The number of sessions restored, 0 if the data is invalid
+    */
+    size_t deserialize(const uint8_t* buf, const size_t len)
+    {
+      if (buf == nullptr || len < HEADER_SZ + CHECKSUM_SZ || buf[0] != MAGIC_0 || buf[1] != MAGIC_1 || buf[2] != FORMAT_VERSION)
+        return 0;
+
+      // the checksum covers everything before it, find the end first
+      const size_t count = buf[3];
+      size_t pos = HEADER_SZ;
+
+      for (size_t n = 0; n < count; n++)
+      {
+        if (pos + ENTRY_SZ > len)
+          return 0;
+
+        pos += ENTRY_SZ + buf[pos + 6];
+      }
+
+      if (pos + CHECKSUM_SZ > len)
+        return 0;
+
+      uint32_t sum = 0;
+
+      for (int i = 0; i < 4; i++)
+        sum |= (uint32_t) buf[pos + i] << (8 * i);
+
+      if (sum != m_fnv(buf, pos, FNV_BASIS))
+        return 0;
+
+      pos = HEADER_SZ;
+
+      for (size_t n = 0; n < count; n++)
+      {
+        uint32_t ip = 0;
+
+        for (int i = 0; i < 4; i++)
+          ip |= (uint32_t) buf[pos++] << (8 * i);
+
+        const uint16_t port     = buf[pos] | (buf[pos + 1] << 8);
+        const size_t   host_len = buf[pos + 2];
+        char host[256];
+
+        memcpy(host, buf + pos + 3, host_len);
+        host[host_len] = '\0';
+        pos += 3 + host_len;
+
+        SSLSession* session = m_insert(host, ip, port);
+
+        if (session == nullptr)
+          return n;
+
+        session->session_id_len = buf[pos++];
+        memcpy(session->session_id, buf + pos, sizeof(session->session_id));
+        pos += sizeof(session->session_id);
+        session->version = buf[pos] | (buf[pos + 1] << 8);
+        pos += 2;
+        session->cipher_suite = buf[pos] | (buf[pos + 1] << 8);
+        pos += 2;
+        memcpy(session->master_secret, buf + pos, sizeof(session->master_secret));
+        pos += sizeof(session->master_secret);
+      }
+
+      return count;
+    }
+
+  private:
+
+    struct Slot
+    {
+      Slot() : session(""), hash(0), ip(0), stamp(0), port(0), used(false) {}
+
+      // hostname, or SNI name for an IP address
+      SSLSession  session;
+      uint32_t    hash;
+      // 0 for a hostname
+      uint32_t    ip;
+      // value of m_clock when last used
+      uint32_t    stamp;
+      uint16_t    port;
+      bool        used;
+    };
+
+    static const uint8_t  MAGIC_0         = 'S';
+    static const uint8_t  MAGIC_1         = 'C';
+    static const uint8_t  FORMAT_VERSION  = 2;
+    static const size_t   HEADER_SZ       = 4;
+    static const size_t   CHECKSUM_SZ     = 4;
+    // IP address, port, hostname length, session id length, session id, version, cipher suite, master secret
+    static const size_t   ENTRY_SZ        = 4 + 2 + 1 + 1 + 32 + 2 + 2 + 48;
+    static const uint32_t FNV_BASIS       = 2166136261UL;
+
+    static uint32_t m_fnv(const uint8_t* data, const size_t len, uint32_t hash)
+    {
+      for (size_t i = 0; i < len; i++)
+      {
+        hash ^= data[i];
+        hash *= 16777619UL;
+      }
+
+      return hash;
+    }
+
+    static uint32_t m_ip(const IPAddress& ip)
+    {
+      return (uint32_t) ip[0] | ((uint32_t) ip[1] << 8) | ((uint32_t) ip[2] << 16) | ((uint32_t) ip[3] << 24);
+    }
+
+    static uint32_t m_hash(const char* host, const uint32_t ip, const uint16_t port)
+    {
+      const uint8_t key[6] = { (uint8_t) ip, (uint8_t) (ip >> 8), (uint8_t) (ip >> 16), (uint8_t) (ip >> 24),
+                               (uint8_t) port, (uint8_t) (port >> 8)
+                             };
+
+      return m_fnv(key, sizeof(key), m_fnv((const uint8_t*) host, strlen(host), FNV_BASIS));
+    }
+
+    int m_find(const char* host, const uint32_t ip, const uint16_t port, const uint32_t hash) const
+    {
+      if (!m_slots)
+        return -1;
+
+      for (size_t index = hash & m_mask; m_slots[index].used; index = (index + 1) & m_mask)
+      {
+        const Slot& slot = m_slots[index];
+
+        if (slot.hash == hash && slot.ip == ip && slot.port == port && slot.session.get_hostname().equals(host))
+          return index;
+      }
+
+      return -1;
+    }
+
+    SSLSession* m_lookup(const char* host, const uint32_t ip, const uint16_t port)
+    {
+      if (host == nullptr)
+        return nullptr;
+
+      const int index = m_find(host, ip, port, m_hash(host, ip, port));
+
+      if (index < 0)
+        return nullptr;
+
+      m_slots[index].stamp = ++m_clock;
+
+      return &m_slots[index].session;
+    }
+
+    SSLSession* m_insert(const char* host, const uint32_t ip, const uint16_t port)
+    {
+      if (!m_slots || strlen(host) > 255 || (host[0] == '\0' && ip == 0))
+        return nullptr;
+
+      const uint32_t hash = m_hash(host, ip, port);
+      int index = m_find(host, ip, port, hash);
+
+      if (index < 0)
+      {
+        if (m_size >= m_capacity)
+          m_erase(m_oldest());
+
+        index = hash & m_mask;
+
+        while (m_slots[index].used)
+          index = (index + 1) & m_mask;
+
+        m_slots[index].session  = SSLSession(host);
+        m_slots[index].ip       = ip;
+        m_slots[index].port     = port;
+        m_slots[index].hash     = hash;
+        m_slots[index].used     = true;
+        m_size++;
+      }
+
+      m_slots[index].stamp = ++m_clock;
+
+      return &m_slots[index].session;
+    }
+
+    bool m_remove(const char* host, const uint32_t ip, const uint16_t port)
+    {
+      if (host == nullptr)
+        return false;
+
+      const int index = m_find(host, ip, port, m_hash(host, ip, port));
+
+      if (index < 0)
+        return false;
+
+      m_erase(index);
+
+      return true;
+    }
+
+    int m_oldest() const
+    {
+      int oldest = -1;
+
+      for (size_t i = 0; i <= m_mask; i++)
+      {
+        if (m_slots[i].used && (oldest < 0 || m_slots[i].stamp < m_slots[oldest].stamp))
+          oldest = i;
+      }
+
+      return oldest;
+    }
+
+    // remove a slot, moving back the entries of its probe sequence so that lookups don't stop early
+    void m_erase(int index)
+    {
+      if (index < 0)
+        return;
+
+      size_t hole = index;
+
+      for (size_t next = (hole + 1) & m_mask; m_slots[next].used; next = (next + 1) & m_mask)
+      {
+        const size_t home = m_slots[next].hash & m_mask;
+
+        // the entry can fill the hole if its home slot isn't between the hole and where it is
+        if (((next - home) & m_mask) >= ((next - hole) & m_mask))
+        {
+          m_slots[hole] = m_slots[next];
+          hole = next;
+        }
+      }
+
+      m_slots[hole] = Slot();
+      m_size--;
+    }
+
+    Slot*     m_slots;
+    size_t    m_capacity;
+    size_t    m_mask;
+    size_t    m_size;
+    uint32_t  m_clock;
+};
@@ -1902,141 +1902,4003 @@ p256_mul(p256_jacobian *P, const unsigned char *x, size_t xlen)
 }
 
 /*
-   Precomputed window: k*G points, where G is the curve generator, and k
-   is an integer from 1 to 15 (inclusive). The X and Y coordinates of
-   the point are encoded as 20 words of 13 bits each (little-endian
-   order); 13-bit words are then grouped 2-by-2 into 32-bit words
-   (little-endian order within each word).
+   Fixed-base comb for the multiplication of the generator G. With a
+   comb of BR_P256_COMB teeth, the 256-bit multiplier is cut into
+   BR_P256_COMB pieces of COMB_SPACING bits. Bit j of every piece is
+   processed in the same step, so a multiplication is COMB_SPACING
+   doublings and additions, instead of 256 doublings and 64 additions
+   with a 4-bit window.
+
+   Gcomb[v-1] is the sum of 2^(i*COMB_SPACING)*G for each bit i set in
+   v, for v from 1 to 2^BR_P256_COMB-1. The table is 80 bytes per point:
+
+     BR_P256_COMB   points   table size   steps
+          4            15       1200         64
+          5            31       2480         52
+          6            63       5040         43
+          7           127      10160         37
+          8           255      20400         32
+
+   The X and Y coordinates of the point are encoded as 20 words of 13
+   bits each (little-endian order); 13-bit words are then grouped 2-by-2
+   into 32-bit words (little-endian order within each word).
 */
-static const uint32_t Gwin[15][20] =
+#ifndef BR_P256_COMB
+#define BR_P256_COMB   6
+#endif
+
+#if BR_P256_COMB < 4 || BR_P256_COMB > 8
+#error BR_P256_COMB must be between 4 and 8
+#endif
+
+#define COMB_SPACING   ((256 + BR_P256_COMB - 1) / BR_P256_COMB)
+#define COMB_POINTS    ((1 << BR_P256_COMB) - 1)
+
+#if BR_P256_COMB == 4
+
+static const uint32_t Gcomb[15][20] =
+{
+
+  {
+    0x04C60296, 0x02721176, 0x19D00F4A, 0x102517AC,
+    0x13B8037D, 0x0748103C, 0x1E730E56, 0x08481FE2,
+    0x0F97012C, 0x00D605F4, 0x1DFA11F5, 0x0C801A0D,
+    0x0F670CBB, 0x0AED0CC5, 0x115E0E33, 0x181F0785,
+    0x13F514A7, 0x0FF30E3B, 0x17171E1A, 0x009F18D0
+  },
+
+  {
+    0x10A61B63, 0x0EB90D23, 0x0FBF090E, 0x15551594,
+    0x114A093B, 0x04DC0977, 0x092C12E3, 0x15541612,
+    0x15E10811, 0x001F0A08, 0x1A310EE7, 0x02481517,
+    0x017A1E41, 0x0A0A03FA, 0x19A511A6, 0x07BE0622,
+    0x056A0BCB, 0x150115BD, 0x174715DB, 0x017F1D12
+  },
+
+  {
+    0x0BCC12AF, 0x12391882, 0x18FD0933, 0x1FA114D7,
+    0x0F4B0C98, 0x0BC009E2, 0x0BE00DE9, 0x0E4D1EC9,
+    0x1DE409D6, 0x00600292, 0x040907A0, 0x09450470,
+    0x03521AA5, 0x15B50760, 0x1ADD11EE, 0x1E3C0F1B,
+    0x0EED125F, 0x08C811FC, 0x1F06109B, 0x00E50AB1
+  },
+
+  {
+    0x1C4D1D85, 0x109F1275, 0x1561157C, 0x0FB80A5F,
+    0x17E115FF, 0x118C1D9B, 0x0C171D58, 0x0BCC1FEE,
+    0x1CDF0EDB, 0x00881F5C, 0x17121B32, 0x1C67125C,
+    0x128000C7, 0x12B41FEB, 0x19E9149B, 0x14950BFD,
+    0x174E1953, 0x063D1B84, 0x0D5C0341, 0x005A1209
+  },
+
+  {
+    0x10E9167F, 0x093904CA, 0x08DB1139, 0x05630828,
+    0x077B1FBD, 0x123B1F18, 0x030308BB, 0x0E5F1F77,
+    0x09940A9C, 0x01DF0546, 0x1BB618A8, 0x006B09DC,
+    0x0BA00196, 0x01121728, 0x0118183B, 0x04580867,
+    0x174C0070, 0x05930F07, 0x1E1B1DBB, 0x00C207A7
+  },
+
+  {
+    0x1ABF14BC, 0x05630482, 0x1E1B0CAE, 0x0BD81B26,
+    0x194916DF, 0x02240E2F, 0x1532082E, 0x1EBB01F7,
+    0x1BCB1B51, 0x00AA0198, 0x0454164C, 0x1FC4058D,
+    0x1DF0144F, 0x0EDB0F7B, 0x0CFD13D5, 0x1B3A1439,
+    0x1D200018, 0x170A042B, 0x04240AEC, 0x002A1C59
+  },
+
+  {
+    0x02E61E01, 0x1D951FFF, 0x0F930E48, 0x1CE115C5,
+    0x0BE60D84, 0x087C10E4, 0x147A083F, 0x083D0A8B,
+    0x1A2D1211, 0x01D6175D, 0x18D11479, 0x122F189C,
+    0x1B221CAC, 0x1FC50112, 0x142F122C, 0x10001B3B,
+    0x08730A15, 0x182F0C26, 0x175E1BEC, 0x01D51F5C
+  },
+
+  {
+    0x09B908BE, 0x041F1ECC, 0x1CA506CF, 0x12340F1A,
+    0x0CB20395, 0x086217F1, 0x1B7F1834, 0x124E189C,
+    0x13BD0784, 0x014D14E5, 0x1ABF15F4, 0x15700CF0,
+    0x02CD1F2B, 0x01840A10, 0x1C120A92, 0x1A4F1B37,
+    0x1C5D0BD2, 0x1102199A, 0x03A41B0B, 0x00CE13E1
+  },
+
+  {
+    0x1BE40A3E, 0x09180119, 0x12B512DF, 0x0100080E,
+    0x1BA7002F, 0x118F1FB6, 0x02AF17DB, 0x1BB514C6,
+    0x13B312C9, 0x009C1DA7, 0x01251BB0, 0x06C2196E,
+    0x11521A4C, 0x0DE70E44, 0x0FDC1AE1, 0x0D281CA0,
+    0x00021720, 0x00CC0C7B, 0x04161E83, 0x00850E64
+  },
+
+  {
+    0x0D4308B9, 0x12A21437, 0x109816EF, 0x0F331033,
+    0x068F189E, 0x1143111E, 0x0E0E0A00, 0x1C0915FF,
+    0x17B01C6C, 0x00F101E3, 0x1F061976, 0x05720487,
+    0x06A719C6, 0x01D71782, 0x1B560E57, 0x0461077B,
+    0x098A02C1, 0x18640779, 0x1AEB1B72, 0x016D12CF
+  },
+
+  {
+    0x18D11573, 0x123D14B0, 0x1A4B07F9, 0x0B7A153E,
+    0x12DC02DD, 0x025F1F2B, 0x0E290208, 0x02501D65,
+    0x026B116B, 0x0019022F, 0x1A450CA8, 0x0F7E18D7,
+    0x127913A5, 0x1E9B1C95, 0x13E40181, 0x180919AA,
+    0x08DA1B39, 0x03B81863, 0x151F1390, 0x01BA1777
+  },
+
+  {
+    0x13950D0C, 0x14F31ECF, 0x1C971E96, 0x11880AE9,
+    0x1A1D00A2, 0x107C127C, 0x10520230, 0x0E8C1BBF,
+    0x057B0B31, 0x00D11CD1, 0x1D920D4A, 0x1C2F16CF,
+    0x03130CDF, 0x044E07D7, 0x1B340BFC, 0x09AC1FFC,
+    0x076C13C2, 0x01440181, 0x002F1854, 0x00630E71
+  },
+
+  {
+    0x12C10E7F, 0x168F0268, 0x0E140D36, 0x02891B0E,
+    0x00681A10, 0x1B7515E8, 0x1E310C3E, 0x03B70598,
+    0x1A5B0F46, 0x008014AF, 0x046905EB, 0x144F10C6,
+    0x062D1235, 0x073306FF, 0x073904F3, 0x03AE0332,
+    0x15F30BD7, 0x1F8C0618, 0x0A8C10B0, 0x01FD13D3
+  },
+
+  {
+    0x0EA60FAC, 0x08D80428, 0x13D20743, 0x1810149A,
+    0x157E1F5C, 0x0C571FDE, 0x19010A8F, 0x1C830848,
+    0x17160802, 0x003D176E, 0x101F1844, 0x015E0B75,
+    0x0C8B18FA, 0x0FC911C0, 0x01B7006B, 0x07B60CE8,
+    0x02FA0527, 0x179F1031, 0x0C32160E, 0x00860413
+  },
+
+  {
+    0x08EB18E5, 0x0B6A0443, 0x1A251961, 0x06441711,
+    0x133510DE, 0x155E0D8E, 0x05230FB6, 0x14431029,
+    0x15A404F7, 0x01690389, 0x0D001B2D, 0x17611D88,
+    0x07CC006E, 0x00910DEC, 0x060004E4, 0x1DAD1D9A,
+    0x098D1CDF, 0x07B50D90, 0x0A020D4D, 0x01F51005
+  }
+};
+
+#elif BR_P256_COMB == 5
+
+static const uint32_t Gcomb[31][20] =
+{
+
+  {
+    0x04C60296, 0x02721176, 0x19D00F4A, 0x102517AC,
+    0x13B8037D, 0x0748103C, 0x1E730E56, 0x08481FE2,
+    0x0F97012C, 0x00D605F4, 0x1DFA11F5, 0x0C801A0D,
+    0x0F670CBB, 0x0AED0CC5, 0x115E0E33, 0x181F0785,
+    0x13F514A7, 0x0FF30E3B, 0x17171E1A, 0x009F18D0
+  },
+
+  {
+    0x18F21C83, 0x0D790481, 0x105F0EEA, 0x0330150A,
+    0x0C5E127F, 0x14B1196C, 0x14221B72, 0x1AE71C82,
+    0x0A0A1026, 0x00A91332, 0x004816A1, 0x011D1DC5,
+    0x124B0CFD, 0x198B163B, 0x14941E0B, 0x15A50FC8,
+    0x07C3115D, 0x08A608EA, 0x1A2D1451, 0x003810CF
+  },
+
+  {
+    0x05D60870, 0x04970DC1, 0x03551F7D, 0x1407088F,
+    0x0AC91A09, 0x12990747, 0x0611158F, 0x1DA00B7F,
+    0x1C39097B, 0x00791E83, 0x07930940, 0x114602D0,
+    0x14571CE9, 0x01A00922, 0x1B10121C, 0x06130BE6,
+    0x0C550808, 0x02581A9D, 0x14A310BE, 0x01C918DD
+  },
+
+  {
+    0x166507E0, 0x134B1A8F, 0x199F0C73, 0x11EC1D0C,
+    0x053E12C9, 0x049B050A, 0x17B11352, 0x0541103F,
+    0x11E21C79, 0x00FD1CBB, 0x09560094, 0x16451755,
+    0x1E900302, 0x0A1B1EF4, 0x1C0D1214, 0x0BCC0276,
+    0x1B3F151D, 0x18020693, 0x113910AC, 0x015F0DA1
+  },
+
+  {
+    0x177B1D7D, 0x0FC71FE1, 0x036D1DD3, 0x04E1022E,
+    0x0FB6177C, 0x0A981524, 0x1F4D04F2, 0x1FAB18A3,
+    0x19BB0DF0, 0x01AC1A40, 0x0ED61596, 0x009304AB,
+    0x19FC19FF, 0x15F3190D, 0x1F9E11A7, 0x1E0E1059,
+    0x1F4A178D, 0x07A40A84, 0x09E706D1, 0x004118A9
+  },
+
+  {
+    0x043C1605, 0x10D51BAC, 0x19321D7B, 0x05B718F1,
+    0x152104EC, 0x05E007A7, 0x11011C21, 0x08DD049D,
+    0x162D177E, 0x016C19BE, 0x1F86052D, 0x0376068E,
+    0x0C5B0F43, 0x094E09B3, 0x0F7A06A4, 0x1C7B196A,
+    0x0D5E019E, 0x0D2013AD, 0x1C041024, 0x00710AA8
+  },
+
+  {
+    0x12EB0ABF, 0x1FAE0D54, 0x112D0AEB, 0x1E921AFA,
+    0x061802F8, 0x08920829, 0x01591EA5, 0x1B651B6E,
+    0x0E8802EA, 0x00C4071D, 0x17A405F0, 0x13B81327,
+    0x16B11893, 0x1B0A1F11, 0x01121D03, 0x045A1FDC,
+    0x0D6416F5, 0x0C93153F, 0x07F514FA, 0x01AF1129
+  },
+
+  {
+    0x01F4032A, 0x0C5D1C65, 0x0FB809C7, 0x16021E1B,
+    0x103F050A, 0x0B131C63, 0x1AB91A82, 0x14A30A43,
+    0x145D07C2, 0x001A0AFC, 0x1906137C, 0x0C751C56,
+    0x0A230482, 0x172C0154, 0x093F0C9D, 0x096919FB,
+    0x03D010A9, 0x001511C2, 0x1A1813BD, 0x00190B0F
+  },
+
+  {
+    0x05C9172A, 0x0CB30AB0, 0x0C1F18BC, 0x0B1D1765,
+    0x07BB0599, 0x184C1F62, 0x02FC14A8, 0x0E73167C,
+    0x173E099A, 0x00011711, 0x1AAE10F2, 0x0A140037,
+    0x1FB504AF, 0x05B0055A, 0x0DAF0B20, 0x04511044,
+    0x08F11AB5, 0x06841103, 0x0ABA0579, 0x000604A9
+  },
+
+  {
+    0x132406E0, 0x019B0A27, 0x116009D9, 0x17A311D4,
+    0x1E450820, 0x11B915EA, 0x1E2A1800, 0x0F120A19,
+    0x0714082A, 0x00781443, 0x036A14C6, 0x10660D19,
+    0x102300E2, 0x0EDD1693, 0x01991927, 0x175305EC,
+    0x13FE0085, 0x00A71F0E, 0x107A1ACF, 0x01A61798
+  },
+
+  {
+    0x15C60FEE, 0x0D251DDF, 0x009E18D9, 0x04611630,
+    0x082F03F2, 0x09C60B96, 0x1A3D0528, 0x143C15D8,
+    0x148015B0, 0x007814F8, 0x173C18D4, 0x16FB097E,
+    0x1AC81538, 0x1A200348, 0x18DC1F1B, 0x14101A4F,
+    0x14F80729, 0x1FD60C46, 0x06D0140E, 0x01A6039F
+  },
+
+  {
+    0x0EB60004, 0x1D920993, 0x086A181D, 0x1FDB0B48,
+    0x0DFF0D14, 0x12D70644, 0x1CFF169B, 0x004914E7,
+    0x1B9909C2, 0x00051F5E, 0x0AE909FC, 0x1F9D0E1C,
+    0x1188150C, 0x1321108D, 0x0DB402B9, 0x0EF21E0C,
+    0x19A50DDC, 0x0FBE0C03, 0x1E5A1992, 0x00851AF4
+  },
+
+  {
+    0x07471683, 0x19EF01FE, 0x1F4806DF, 0x0F471DFE,
+    0x189E172B, 0x1BE40CB3, 0x01361942, 0x135517F5,
+    0x1A121FE3, 0x01DB012E, 0x194C15FC, 0x1CCF085C,
+    0x18711023, 0x11C61550, 0x1B3E1D0A, 0x0F4315C0,
+    0x1C1D1619, 0x067E0833, 0x02AA183C, 0x014608CD
+  },
+
+  {
+    0x00A10904, 0x02950D1A, 0x130B1270, 0x1040033E,
+    0x07DA1008, 0x00130E56, 0x02FF1877, 0x0485159D,
+    0x0DE61449, 0x013D0622, 0x1AB016C8, 0x16C20ED5,
+    0x0CF10035, 0x0AC20E3A, 0x00040551, 0x125C1AA8,
+    0x006904B2, 0x16740A53, 0x1B431E79, 0x01B30E96
+  },
+
+  {
+    0x18B21D99, 0x17781ED7, 0x17301CEB, 0x1831093B,
+    0x1A860C51, 0x169A0347, 0x0E911531, 0x055B0ACC,
+    0x02930638, 0x012B1861, 0x141C1B5B, 0x1A9F0042,
+    0x1F871ACA, 0x0DC8050B, 0x1D0502A9, 0x1E9F084B,
+    0x15410891, 0x171E0CFA, 0x047B0B0F, 0x00D115A3
+  },
+
+  {
+    0x1CDD185F, 0x1E1310E0, 0x13160320, 0x00D40143,
+    0x000801FB, 0x15AA0D16, 0x1AC10C99, 0x08650D55,
+    0x0C681666, 0x00AB154E, 0x1F6C136F, 0x0C620613,
+    0x0CF01F7F, 0x0FE300CF, 0x16C80D6A, 0x1D7509CA,
+    0x0E3509E8, 0x11C51416, 0x148209FF, 0x00AE1B88
+  },
+
+  {
+    0x0DDD13F1, 0x03441A54, 0x07B21931, 0x17B1143D,
+    0x0F400F26, 0x17D912EE, 0x1EE11346, 0x0BBC1274,
+    0x06A8101E, 0x00A91891, 0x0D8C1E28, 0x1A981BBC,
+    0x11DB1B3A, 0x180B030B, 0x0A1914FB, 0x0BBF0709,
+    0x1EA01073, 0x0DD61866, 0x00770C10, 0x01AD0EFB
+  },
+
+  {
+    0x08230DC5, 0x04A311F9, 0x193D1788, 0x12BE05E4,
+    0x1094039B, 0x15190D1B, 0x002E1984, 0x0E6D0FC7,
+    0x1E691C00, 0x00880DCD, 0x166C0FE5, 0x01481584,
+    0x1EEC1A76, 0x1BC1005E, 0x03CB1489, 0x085808FA,
+    0x175C00AF, 0x0F5E1715, 0x0EBF06FE, 0x01061C67
+  },
+
+  {
+    0x1F7E0FC8, 0x103500CF, 0x14851E88, 0x1C1706D4,
+    0x057503C9, 0x0E3C11A2, 0x19BF0CD7, 0x04361842,
+    0x151E14D0, 0x01DC0205, 0x1D460AA1, 0x12530FEC,
+    0x196818E9, 0x19F80417, 0x1A44115D, 0x16920067,
+    0x0FEF182D, 0x00DC04E9, 0x071D0D90, 0x0189090E
+  },
+
+  {
+    0x1EF20B29, 0x12C403E1, 0x059705DB, 0x031B047B,
+    0x0EBA020C, 0x05591C41, 0x0DD01B23, 0x15261CC0,
+    0x18631853, 0x01B705AE, 0x1ACD0C34, 0x17FD1DB0,
+    0x150E1D84, 0x1E0C1214, 0x1D5C00CE, 0x13B405C5,
+    0x1F720D3B, 0x044510FE, 0x1A731A13, 0x01660941
+  },
+
+  {
+    0x01D612C9, 0x1B8A00FA, 0x1ADF05D6, 0x03B51B40,
+    0x1E541F7A, 0x17A4078C, 0x13C40ACC, 0x173E0154,
+    0x098F009C, 0x010D0677, 0x14DF1961, 0x1083058C,
+    0x0D7C1385, 0x12D700A9, 0x0A65120E, 0x0E581E30,
+    0x0CCC108C, 0x0B361C90, 0x04270928, 0x002D1995
+  },
+
+  {
+    0x097E1E29, 0x003812C1, 0x0DDA06A2, 0x046000C7,
+    0x13640971, 0x0D8316A5, 0x1ACC1821, 0x0E421129,
+    0x0BA90CC6, 0x01DD102E, 0x0964064E, 0x11731C60,
+    0x1B5D0B90, 0x0D5010E7, 0x09B31FB6, 0x12CD1CCA,
+    0x0EB304BF, 0x1A500DE2, 0x1B8717F1, 0x01C00ABD
+  },
+
+  {
+    0x198118DD, 0x14581C36, 0x0E3E0A20, 0x1ABD0675,
+    0x1AF80B46, 0x16C002E0, 0x1CBE1374, 0x048B1B26,
+    0x1BC91DF3, 0x00301B1F, 0x18E7057F, 0x0E481813,
+    0x0C7612AF, 0x0FF2078B, 0x1C920989, 0x1A5D09E5,
+    0x1CD916A8, 0x11220E04, 0x0DC41AB5, 0x013810A3
+  },
+
+  {
+    0x038D0AA0, 0x032D1ED9, 0x0B980B4A, 0x0A030DAE,
+    0x16E51AB6, 0x12B615F4, 0x1E6608A2, 0x14CB15EB,
+    0x07A20E33, 0x01DC08A0, 0x087E0D12, 0x141000E2,
+    0x07B51C47, 0x11B00981, 0x127418A9, 0x1ABF0EF4,
+    0x0CC7106E, 0x1D701035, 0x048D06A1, 0x019C11BB
+  },
+
+  {
+    0x1F32058D, 0x1C9E0FD2, 0x12A311F1, 0x044B0579,
+    0x0AFB12CC, 0x0E3504FC, 0x029A01E2, 0x1E4C0D6F,
+    0x0AE218A5, 0x018C0B85, 0x05D31FF4, 0x1F081696,
+    0x135615F6, 0x1B8F18DA, 0x033F01F7, 0x1D541341,
+    0x1D3B057E, 0x0FC91B4C, 0x19101826, 0x01FF07C8
+  },
+
+  {
+    0x129B189F, 0x13E207D2, 0x1A1B1D36, 0x16C61A5A,
+    0x163C076F, 0x175708A6, 0x14780A70, 0x1CA21283,
+    0x12F912F6, 0x01400C62, 0x0BBA1A08, 0x14871444,
+    0x15D815C4, 0x0F8618BB, 0x120C0C50, 0x1346096A,
+    0x044803F0, 0x17670BF4, 0x07E710EE, 0x01E6082E
+  },
+
+  {
+    0x1B220C1D, 0x1E041571, 0x016C0E33, 0x18770E40,
+    0x1A0110EC, 0x08C81BE7, 0x0434116F, 0x089F0A91,
+    0x0864159C, 0x00BC19DF, 0x045C1144, 0x0FAF1436,
+    0x1C8F1E2E, 0x0DEC0923, 0x12EC13A8, 0x05320EBA,
+    0x1E851D50, 0x1A631B8C, 0x07311100, 0x008907C3
+  },
+
+  {
+    0x1E790678, 0x1B24169C, 0x17E313FC, 0x07741B42,
+    0x19A60A92, 0x00CE1E47, 0x088411D3, 0x083C1240,
+    0x03A21A79, 0x011815A2, 0x019C1800, 0x06E3003F,
+    0x08FA034D, 0x0D6B0571, 0x03BA0431, 0x11181908,
+    0x0EDB093E, 0x029A0BCB, 0x058A1BAD, 0x01F60E92
+  },
+
+  {
+    0x0D551256, 0x1E2B023F, 0x1AA6052D, 0x0886049C,
+    0x1B4600CD, 0x0B231E14, 0x024A071A, 0x197208AA,
+    0x074C13D0, 0x01C916A2, 0x11CE0624, 0x1D461745,
+    0x03DD06D1, 0x06C418DC, 0x0B071E2A, 0x01E70F14,
+    0x1E280DED, 0x05D0025F, 0x08A81006, 0x01EF1E93
+  },
+
+  {
+    0x1260168D, 0x134204C0, 0x11390C42, 0x1F671FAA,
+    0x0DB60935, 0x0C731B02, 0x0530071E, 0x07BC1ED6,
+    0x09D719C1, 0x00961649, 0x1FDC0955, 0x1AD11CBE,
+    0x1FF106D2, 0x024A01C8, 0x0F80064C, 0x03E3017D,
+    0x0EBC0200, 0x13920FA1, 0x1DFB1FA7, 0x015400C1
+  },
+
+  {
+    0x1B4B0527, 0x0B441996, 0x0B4E02E7, 0x160B0800,
+    0x10D10530, 0x050D1ED0, 0x02601804, 0x03AB0DDB,
+    0x0CA40E83, 0x010417C0, 0x1B811739, 0x014207FB,
+    0x08350DBF, 0x1899196C, 0x00830F9B, 0x08220454,
+    0x1CA604F2, 0x07421D85, 0x17F51C72, 0x0086161C
+  }
+};
+
+#elif BR_P256_COMB == 6
+
+static const uint32_t Gcomb[63][20] =
 {
 
   {
-    0x04C60296, 0x02721176, 0x19D00F4A, 0x102517AC,
-    0x13B8037D, 0x0748103C, 0x1E730E56, 0x08481FE2,
-    0x0F97012C, 0x00D605F4, 0x1DFA11F5, 0x0C801A0D,
-    0x0F670CBB, 0x0AED0CC5, 0x115E0E33, 0x181F0785,
-    0x13F514A7, 0x0FF30E3B, 0x17171E1A, 0x009F18D0
+    0x04C60296, 0x02721176, 0x19D00F4A, 0x102517AC,
+    0x13B8037D, 0x0748103C, 0x1E730E56, 0x08481FE2,
+    0x0F97012C, 0x00D605F4, 0x1DFA11F5, 0x0C801A0D,
+    0x0F670CBB, 0x0AED0CC5, 0x115E0E33, 0x181F0785,
+    0x13F514A7, 0x0FF30E3B, 0x17171E1A, 0x009F18D0
+  },
+
+  {
+    0x024F07CD, 0x027F022C, 0x0E000CD0, 0x0F5C15FF,
+    0x0F471925, 0x187504C0, 0x138C169F, 0x1F261CEF,
+    0x0B6A18CF, 0x01301FC9, 0x17D115D6, 0x0A970F1B,
+    0x1FED1B72, 0x0A401EAB, 0x123D1460, 0x000F18E7,
+    0x10751D60, 0x0A0B13A1, 0x0AB414EC, 0x011D049A
+  },
+
+  {
+    0x10E11FB1, 0x162C1F16, 0x0759059D, 0x05571CC6,
+    0x14C513CE, 0x05780BE9, 0x18E201ED, 0x16551CB7,
+    0x021B0ED1, 0x01DF130B, 0x1D921513, 0x1C0F1C65,
+    0x12C4117F, 0x06661CD2, 0x1A340245, 0x1A691D50,
+    0x1C25077E, 0x070C0E94, 0x1CE40D9F, 0x01E61A13
+  },
+
+  {
+    0x1BC00C2C, 0x0E7D00EF, 0x140B1FDC, 0x12851599,
+    0x1FFE1C67, 0x04861A24, 0x05B30DD0, 0x0CA11305,
+    0x0B380D54, 0x00DD1B25, 0x0DFE0D32, 0x1D83087B,
+    0x1FC41089, 0x02A7081F, 0x0BCD0B66, 0x0BD40041,
+    0x140E1E06, 0x06580BF0, 0x1A841977, 0x00290ED4
+  },
+
+  {
+    0x18C0188E, 0x1204191C, 0x184C1AEC, 0x05190859,
+    0x1A080BEC, 0x1338080A, 0x132612F0, 0x0C4B12FD,
+    0x11A215FA, 0x00271332, 0x0A101C0C, 0x09840C41,
+    0x06B81AA8, 0x042D136C, 0x135B0475, 0x16421A97,
+    0x02230B1F, 0x112717A4, 0x0D2D0F46, 0x009616E9
+  },
+
+  {
+    0x031605DB, 0x05F40212, 0x1FC50ACA, 0x045405C5,
+    0x16EF1FC2, 0x09C107F4, 0x01CD014E, 0x061E16AE,
+    0x03C41803, 0x01F01AA4, 0x0EEB1DCC, 0x01E41330,
+    0x1ECC0689, 0x1F5D09BB, 0x1FBA1DCC, 0x1F34024E,
+    0x13090B8F, 0x0CA712E8, 0x08610568, 0x00400D1F
+  },
+
+  {
+    0x1ED81C78, 0x04500272, 0x06D20D3B, 0x1D6603DB,
+    0x1AAC11C8, 0x1FD003E2, 0x1143140B, 0x1CFC1EDB,
+    0x015200E7, 0x001E1D0D, 0x08E211F2, 0x0D1D01CD,
+    0x1DAF0D29, 0x103E1785, 0x132E05C5, 0x1B32138B,
+    0x0C7802A9, 0x1D801DBD, 0x180715C1, 0x00A60702
+  },
+
+  {
+    0x135B065E, 0x08420846, 0x001D0EB0, 0x13D41FDA,
+    0x1C010F77, 0x18100130, 0x080F12A3, 0x143A111D,
+    0x0CDA0945, 0x014418E4, 0x05E61CFB, 0x0808000C,
+    0x17F109EE, 0x1BE91003, 0x0D611F83, 0x0C1A1831,
+    0x0E9E09DE, 0x041F10BA, 0x05E90AED, 0x010E0C80
+  },
+
+  {
+    0x190D0A51, 0x05881F62, 0x038612B5, 0x052B09FA,
+    0x187A1036, 0x11681449, 0x14940148, 0x1C0A02EA,
+    0x08F60402, 0x004F1591, 0x0B3A032D, 0x0DD80515,
+    0x086315C9, 0x05211D05, 0x166F0B98, 0x1BDD1D59,
+    0x08BA00CC, 0x1CB00D76, 0x12F01BE9, 0x0054163E
+  },
+
+  {
+    0x1C4600F6, 0x085B1FD5, 0x0F121D81, 0x052411FF,
+    0x1C4D1F52, 0x09C40A03, 0x0B8E1DB1, 0x09C71D72,
+    0x14880990, 0x00F016DF, 0x13F30F0B, 0x1C8A064B,
+    0x09EE1445, 0x01C9138A, 0x043C0944, 0x0F2F0F8C,
+    0x1C27157C, 0x1465165A, 0x0CEF1A3E, 0x00D61101
+  },
+
+  {
+    0x0CAD0979, 0x0F8A1408, 0x0C09173B, 0x0E970375,
+    0x016B1ED4, 0x02091A6B, 0x1CF60D2E, 0x01DB0302,
+    0x0BAD02BD, 0x01B90436, 0x0EB70B2E, 0x0AA400D3,
+    0x1EF409FB, 0x17780077, 0x02861554, 0x012E1E8C,
+    0x1E99077F, 0x0E981133, 0x11940153, 0x01901F38
+  },
+
+  {
+    0x1CD11CA9, 0x0A830DB3, 0x0D971E4B, 0x10E102D2,
+    0x10E30505, 0x0AA41907, 0x0FC81B3F, 0x024E1EE5,
+    0x1D621C30, 0x017B1708, 0x06D51A43, 0x1A0E0001,
+    0x07D10519, 0x18701143, 0x160003DC, 0x1C911BF7,
+    0x10E40F54, 0x1EEC05CE, 0x0A121B04, 0x00FA032A
+  },
+
+  {
+    0x181A006D, 0x1B8616C5, 0x02A60CB4, 0x192E176B,
+    0x027E13AF, 0x13E00A1E, 0x11901EB2, 0x044B1C44,
+    0x097D0D6B, 0x015F0C63, 0x0BBB0A67, 0x0B041CFC,
+    0x16171DDF, 0x0ABE1AE5, 0x1CB40897, 0x044103FE,
+    0x146B0632, 0x090E1CC6, 0x00871CCA, 0x00BD1607
+  },
+
+  {
+    0x01A503C4, 0x1C3E0D3A, 0x191B0FF0, 0x15C3112A,
+    0x186A19B6, 0x02B40846, 0x158C14A0, 0x1BB81443,
+    0x1F011892, 0x01DA1B84, 0x19FB078D, 0x11BE013E,
+    0x13541AC8, 0x088A1100, 0x13780FBF, 0x03391B2E,
+    0x146617A6, 0x15191337, 0x172C00D9, 0x00051CC8
+  },
+
+  {
+    0x1B550F40, 0x0C3C06CC, 0x1ADB12DC, 0x17A80947,
+    0x044B1E87, 0x0A230CDC, 0x19900236, 0x1E9304BE,
+    0x0E790341, 0x008C03EA, 0x1D7801A7, 0x0C761E72,
+    0x1A1A003E, 0x07E81055, 0x149B1E12, 0x013C1286,
+    0x0C9106E8, 0x0BCC0A75, 0x11D20177, 0x003115BD
+  },
+
+  {
+    0x0D5212DF, 0x0BE9192A, 0x113F13CD, 0x163610A9,
+    0x10C60452, 0x13231B39, 0x1E20189D, 0x117E1DB6,
+    0x0E4B1F60, 0x008B0944, 0x12F6016C, 0x057A0484,
+    0x0AE707B5, 0x04FA08A5, 0x12D4119B, 0x16C416B4,
+    0x119917FC, 0x136D14FF, 0x163B13EA, 0x00E70F83
+  },
+
+  {
+    0x0B2316EA, 0x096D1400, 0x12880C6E, 0x1CBA13B0,
+    0x138D19A7, 0x17C90434, 0x1ADB11EC, 0x19A41465,
+    0x197D152A, 0x01BE1AD1, 0x020215EB, 0x070E059E,
+    0x1CCF0F17, 0x167701F4, 0x0E6607B0, 0x176A0446,
+    0x0D091371, 0x1AB20CF2, 0x0F0D088F, 0x0168098E
+  },
+
+  {
+    0x10CE020B, 0x071A1530, 0x0399186A, 0x19561429,
+    0x057E0DD2, 0x0412198E, 0x07C31977, 0x01D213D3,
+    0x151104CE, 0x01B21272, 0x17CD0E13, 0x0CC90BA5,
+    0x0F230678, 0x15390613, 0x18070F5B, 0x1AA90559,
+    0x155E07F8, 0x12491588, 0x080217DB, 0x00CE0FB5
+  },
+
+  {
+    0x05A61697, 0x12840188, 0x06FC141E, 0x1B2507E8,
+    0x05080FD0, 0x0C040B0E, 0x0F580A77, 0x038C0FC4,
+    0x0EE50562, 0x01FF12DF, 0x093C165A, 0x06F606C2,
+    0x0CCF024E, 0x005714B0, 0x0C6C1FC1, 0x00FE0FE1,
+    0x16F315E9, 0x0EF11A18, 0x094A1A9C, 0x01A70614
+  },
+
+  {
+    0x0B5E0451, 0x0C6E122D, 0x0205048D, 0x103504E5,
+    0x002A04DE, 0x0C9D1067, 0x127510B6, 0x057E1B68,
+    0x0B1201F4, 0x009F0DB9, 0x15DA1D6B, 0x05900399,
+    0x0A0D121B, 0x049A096F, 0x05201239, 0x19C51506,
+    0x0AFA1F2B, 0x123B01BE, 0x1BB20D6D, 0x015208C9
+  },
+
+  {
+    0x08CD18CC, 0x141119FC, 0x14B50546, 0x04710BF1,
+    0x001D17D5, 0x0B3E1C2D, 0x04B01324, 0x1222182A,
+    0x12BD086A, 0x00AF0918, 0x198A0C65, 0x0ADF1BEE,
+    0x0E361FAA, 0x080E11E5, 0x17A7061F, 0x06F01435,
+    0x1E2B0524, 0x1D820468, 0x13EB0621, 0x00F812C4
+  },
+
+  {
+    0x01E71A35, 0x04BC09BA, 0x1EEE06DD, 0x14031FCE,
+    0x130F044D, 0x042E0CFE, 0x1B3D1021, 0x13190ADE,
+    0x106F1CD7, 0x00F8123D, 0x087A1154, 0x1A461282,
+    0x19DD1244, 0x1F7112B8, 0x149D17F2, 0x04DA0545,
+    0x05F90F64, 0x1D0D1856, 0x1D450801, 0x01510A51
+  },
+
+  {
+    0x1644015E, 0x1C0601D5, 0x11781F41, 0x1C6F14DE,
+    0x0DD71647, 0x1DF51EFD, 0x08F5136F, 0x1EC019DE,
+    0x17D915B7, 0x002B0098, 0x16E709E5, 0x0644154C,
+    0x03C00F6C, 0x19C6186D, 0x1B631CD4, 0x1F0A0A23,
+    0x1F2F0703, 0x0C490B96, 0x151E098E, 0x00980A06
+  },
+
+  {
+    0x1EAC0AE5, 0x1EE9079F, 0x0BD109D7, 0x0C661FA9,
+    0x1E3C0BA2, 0x1EB50D6D, 0x00281274, 0x0C870ED7,
+    0x0A6A1F2D, 0x00DF14FD, 0x08B518CE, 0x11C60448,
+    0x04C31342, 0x048E06CA, 0x1E290D1D, 0x05321087,
+    0x1B851E98, 0x12F3021F, 0x04C304F4, 0x001417F4
+  },
+
+  {
+    0x0B511DEF, 0x12231753, 0x047815B2, 0x0F970580,
+    0x025F0DD0, 0x06DC1F59, 0x1A4506FE, 0x0B9E13B9,
+    0x09A20BBF, 0x017F1126, 0x13A3150F, 0x0DEC0B63,
+    0x0C81055C, 0x10E90246, 0x1913039F, 0x0B140923,
+    0x00D50949, 0x154803E8, 0x14570D51, 0x004E10EB
+  },
+
+  {
+    0x1B660BC0, 0x14D312F9, 0x0F5B175E, 0x0A341D8B,
+    0x064B1360, 0x1E571FD3, 0x106A0C6A, 0x0DB70A9C,
+    0x18851E6D, 0x011C131E, 0x18940433, 0x181D1F8B,
+    0x02F60AF5, 0x03F407FA, 0x041A0CBF, 0x0D0B1C06,
+    0x10E21A62, 0x0A68034C, 0x07B3117A, 0x016B0C27
+  },
+
+  {
+    0x175B1815, 0x1B500861, 0x193219CD, 0x02591904,
+    0x0C600036, 0x036A1DFD, 0x070F1AB9, 0x0E61122F,
+    0x0FFA088F, 0x001E0FCA, 0x14B00D55, 0x010018F9,
+    0x1A331EBB, 0x1C551B2F, 0x18D41699, 0x19CA1D86,
+    0x0AB20A44, 0x053219AC, 0x152C0138, 0x00111C03
+  },
+
+  {
+    0x15FC0EA5, 0x019B14A5, 0x034716C1, 0x115D0336,
+    0x07140C48, 0x0C880B40, 0x09130C34, 0x10C90EEA,
+    0x176F1A1F, 0x01220972, 0x110D14AF, 0x17AC1B8B,
+    0x12C60F33, 0x06ED036F, 0x00961C55, 0x0A6A0C11,
+    0x1C28123E, 0x0D6C0366, 0x1EF007BC, 0x01E90496
+  },
+
+  {
+    0x028A0A21, 0x0FFE0E5C, 0x007700D1, 0x175B0B76,
+    0x069507B5, 0x024D1231, 0x0F191C38, 0x183B1A50,
+    0x16801D57, 0x01731855, 0x140805AD, 0x1AA0037A,
+    0x19D70220, 0x0C40080B, 0x13510AA4, 0x1B9218D5,
+    0x002B0AB3, 0x08580D14, 0x15520521, 0x00A01AAD
+  },
+
+  {
+    0x19061599, 0x16200A46, 0x1DD00E0C, 0x07A20297,
+    0x1BD81ED8, 0x08001DC4, 0x0FD912B0, 0x04C705F5,
+    0x0C8319C8, 0x01270EAD, 0x0DCB1D9D, 0x1F4B0992,
+    0x12A50977, 0x06661544, 0x1D1A1923, 0x13EF08FA,
+    0x13B9188A, 0x0DC5123C, 0x09AF0302, 0x006D0AEA
+  },
+
+  {
+    0x028911CD, 0x0EE616F0, 0x1AB31F19, 0x0D040AFA,
+    0x182B0507, 0x0FEA16C7, 0x1958189F, 0x04C2136F,
+    0x0410132C, 0x01540513, 0x1C110251, 0x197C052C,
+    0x17DF0F41, 0x165F1F42, 0x158E0E72, 0x088E10FE,
+    0x10A61188, 0x07370006, 0x1F1C1237, 0x01831627
+  },
+
+  {
+    0x1BCC047D, 0x0CF31C42, 0x0DF30F0F, 0x16CD0EC6,
+    0x09B819A8, 0x18FE10F5, 0x0DB603DD, 0x105C08B7,
+    0x01D61A09, 0x00500001, 0x046C1EDA, 0x160100E4,
+    0x1D741FE5, 0x1B770144, 0x1D431058, 0x0949170E,
+    0x003C1658, 0x052106DB, 0x1A3307E8, 0x001F0645
+  },
+
+  {
+    0x19FA1B80, 0x02D41717, 0x12110124, 0x1B7B0948,
+    0x12C70903, 0x0523019F, 0x06400F14, 0x05850C63,
+    0x07C31A15, 0x016400D7, 0x0E400EDE, 0x04AD0465,
+    0x02D80711, 0x0D151E5F, 0x1DFF0025, 0x14291924,
+    0x1F0E1C58, 0x101B1980, 0x0CE31496, 0x01E20BCD
+  },
+
+  {
+    0x1515149D, 0x15610E9A, 0x028101CA, 0x0D0D1DFF,
+    0x1B5315A7, 0x0FD40483, 0x0F521A85, 0x1BF219A9,
+    0x0FCE1B6B, 0x01330335, 0x138C04A9, 0x0F741311,
+    0x1B911D2D, 0x0A841700, 0x1DF0178E, 0x187107BC,
+    0x1E0B107B, 0x13F60DAF, 0x05031B7D, 0x006415AA
+  },
+
+  {
+    0x153B1B0C, 0x053A06FF, 0x0D181404, 0x1B8B057A,
+    0x123211A4, 0x0E241A4E, 0x00550B1E, 0x0C251624,
+    0x1B3C04BF, 0x01211A9D, 0x081712B6, 0x02080943,
+    0x0CA71BDD, 0x199F0D35, 0x0FAA183B, 0x174F0DA8,
+    0x1AA20625, 0x10DE11D5, 0x0E98101E, 0x01A308C8
+  },
+
+  {
+    0x160513DB, 0x1E210C96, 0x049407A2, 0x141E02E6,
+    0x17361EFF, 0x0D610C06, 0x194919BE, 0x059502D2,
+    0x0A900A3F, 0x01400F87, 0x05F50D24, 0x0F2A0C4B,
+    0x11FC1FC7, 0x011A0C3E, 0x1F411629, 0x0476002E,
+    0x14EB0F4F, 0x05C109BC, 0x117F0BB8, 0x01D406B4
+  },
+
+  {
+    0x116D0069, 0x01641B39, 0x11321689, 0x032F1161,
+    0x1D2B1023, 0x0CAC1CAA, 0x070C1BF8, 0x13120F99,
+    0x1FAD007D, 0x014C1940, 0x0FF20743, 0x1D6F1008,
+    0x005F0E4D, 0x0FAF15C4, 0x09DD0E84, 0x02F6074A,
+    0x14FE0A7E, 0x1F8C005D, 0x0761120A, 0x015B0E98
+  },
+
+  {
+    0x0C030E19, 0x029C0722, 0x02EF0748, 0x11BF07B2,
+    0x1C8915FC, 0x135F1496, 0x13300A60, 0x1450103B,
+    0x1DBB0740, 0x01280F78, 0x111107D9, 0x00641FD8,
+    0x03740DBA, 0x1ADA1312, 0x152904C6, 0x02681606,
+    0x1FDB1797, 0x094F1885, 0x12FF0425, 0x015F08ED
+  },
+
+  {
+    0x07240158, 0x13AC0531, 0x02840A3C, 0x13151A3F,
+    0x05930B4A, 0x116D0386, 0x17C51E03, 0x03F91513,
+    0x0CB61B27, 0x017D073D, 0x137C15AD, 0x16CA0FA3,
+    0x06850737, 0x1FF30E79, 0x0B9E1BE6, 0x082707D6,
+    0x1B9508CA, 0x0FD1092D, 0x0F2B06C6, 0x01431CCD
+  },
+
+  {
+    0x0803115B, 0x1F471B8B, 0x1DA310AB, 0x183900A5,
+    0x0F9F165D, 0x00CD07A1, 0x0CDB0590, 0x12AC1D06,
+    0x1BF903C0, 0x00EB0237, 0x14691227, 0x1EC51EA1,
+    0x147E0ABD, 0x06900266, 0x1504044D, 0x17570F1C,
+    0x10DC1C03, 0x1E070CCD, 0x1D230D5B, 0x017600D5
+  },
+
+  {
+    0x1BE71152, 0x02C31EFD, 0x00211C0B, 0x1DB1138C,
+    0x19211C4F, 0x0A1C0837, 0x1A510D00, 0x13351AC6,
+    0x14360349, 0x00B41868, 0x010A0EB7, 0x175E1A1C,
+    0x10FF08C7, 0x0FBE0B09, 0x04BA1BCA, 0x1DB206BA,
+    0x036F1311, 0x01A7000F, 0x156D0138, 0x01D113EA
+  },
+
+  {
+    0x0B7B013C, 0x19901340, 0x072B0A6B, 0x07180BB1,
+    0x05721CE0, 0x117C1DAD, 0x0078035F, 0x05BA12B6,
+    0x02E40464, 0x0000115B, 0x11B208C8, 0x0E0F07F7,
+    0x10B800EF, 0x156D0342, 0x1BDF10B3, 0x0D8D0138,
+    0x0E4B0B85, 0x0B9102A1, 0x079411D6, 0x01FA0E6C
+  },
+
+  {
+    0x136908DD, 0x1C621E25, 0x11601C79, 0x10D107E2,
+    0x133D1A86, 0x159F0350, 0x0FCE06D4, 0x0FEF16BC,
+    0x139F0084, 0x005A0AD0, 0x08980CEC, 0x1C35041A,
+    0x13DA11D9, 0x1FB20E0F, 0x14AE0B10, 0x09981C6B,
+    0x01C50264, 0x1D4905CD, 0x18801EE4, 0x006F1ABA
+  },
+
+  {
+    0x1063167B, 0x0EB61518, 0x0CC702A6, 0x010B0B99,
+    0x1F89035F, 0x114617A6, 0x1B501CD4, 0x16BF00F3,
+    0x09F618A1, 0x01E20684, 0x1A150887, 0x03301745,
+    0x1ECD1A40, 0x00F61A9C, 0x19FC03BD, 0x04E61819,
+    0x19831A08, 0x1F7618F1, 0x13681F12, 0x00C90869
+  },
+
+  {
+    0x025117DE, 0x056B12F6, 0x150D01C1, 0x16981EC7,
+    0x12B6166D, 0x19C607A6, 0x15F20202, 0x15E90214,
+    0x016F040F, 0x002F0FA7, 0x06640797, 0x167912CE,
+    0x049F0735, 0x100612C4, 0x00FC0D9D, 0x0EB70070,
+    0x0637086E, 0x1CD21F63, 0x1CA11FDB, 0x00D2052F
+  },
+
+  {
+    0x06791981, 0x0C311243, 0x1C9B0422, 0x021116AC,
+    0x03FA1F96, 0x1C141A8A, 0x055B1508, 0x16260F29,
+    0x17F615BA, 0x010419B8, 0x1AA800F6, 0x0EA816EA,
+    0x06C30FAA, 0x1D6B1665, 0x0D481EDA, 0x0FF6118B,
+    0x0D8C14B6, 0x0F191829, 0x0B410871, 0x0011073F
+  },
+
+  {
+    0x058B0F35, 0x089A0CC0, 0x0B83154B, 0x1E6000B5,
+    0x02CC188E, 0x009213E5, 0x17F01EBD, 0x01BC1095,
+    0x0B4B1F71, 0x015D1E10, 0x1EA41604, 0x11F607E2,
+    0x18AE0CA3, 0x15D71E82, 0x0D7609DA, 0x08591DB7,
+    0x089B05E6, 0x11FF1C55, 0x07D0160E, 0x00EB0E2C
+  },
+
+  {
+    0x0FF70A35, 0x0CC009C0, 0x10F81B24, 0x100605F1,
+    0x1F5017F5, 0x10D50B3A, 0x18F50BA7, 0x0FB50E35,
+    0x0A501CC4, 0x00FB19D1, 0x18D81266, 0x0D3A18BF,
+    0x03CE010B, 0x137706AC, 0x0F110CC5, 0x05651510,
+    0x0BF203F4, 0x0BF01669, 0x1F6708C8, 0x00440D03
+  },
+
+  {
+    0x0D5C1CB9, 0x07A204FB, 0x02F70603, 0x147C1A75,
+    0x18EF187B, 0x09AC1680, 0x01B1036E, 0x14A1024D,
+    0x17C91F98, 0x00B104FD, 0x16AA0FAB, 0x065C056A,
+    0x1B2F0B38, 0x01AD0F1C, 0x019317FF, 0x001813EE,
+    0x18081182, 0x070917A0, 0x0DE614E9, 0x004D191C
+  },
+
+  {
+    0x06140F39, 0x1BB2069A, 0x14E501C1, 0x069E0D59,
+    0x1FD20943, 0x03570DD0, 0x1A050BD5, 0x074415DE,
+    0x05D70787, 0x01DC1D00, 0x091809D9, 0x1B371D7B,
+    0x1C2D0F15, 0x07E716A1, 0x0C5410D1, 0x17D10D9F,
+    0x07DC16C1, 0x1DB005F9, 0x1D260AE9, 0x00321B06
+  },
+
+  {
+    0x092107D8, 0x0D8B0931, 0x05B20327, 0x087E168D,
+    0x13341582, 0x06DC0364, 0x0B33198F, 0x1CC71C10,
+    0x093E06E9, 0x008718CE, 0x06540D2B, 0x15DA1DBC,
+    0x06EC0899, 0x1BC10BD4, 0x1A1D189C, 0x12A3184E,
+    0x0F5101E5, 0x06080E01, 0x15210841, 0x01C40436
+  },
+
+  {
+    0x050B14FC, 0x1EC41EE6, 0x142F0E17, 0x1FE917E8,
+    0x0AF51CE1, 0x098B1E49, 0x0FF103D5, 0x174F0325,
+    0x10491188, 0x00BD0966, 0x096C0163, 0x0B76150B,
+    0x1ECA1661, 0x03CB16C0, 0x11BD1E4A, 0x1F881DD8,
+    0x0DAB0924, 0x12631714, 0x12161142, 0x01730532
+  },
+
+  {
+    0x1AC0035B, 0x0D421941, 0x10641CE4, 0x15BC01C2,
+    0x0D991DF1, 0x10D20D32, 0x00FD1386, 0x0DDA02FC,
+    0x12BF10F1, 0x00390E98, 0x149A009C, 0x11530DBB,
+    0x1C6D0E53, 0x142909AC, 0x0EC10429, 0x0B84056C,
+    0x043B10DA, 0x0ECB0052, 0x1C74091D, 0x00951787
+  },
+
+  {
+    0x0D011105, 0x079B0A14, 0x19F61BF9, 0x0C0F0F90,
+    0x0D8A0F4A, 0x143905E8, 0x12620C3F, 0x0E4D182A,
+    0x1BAD1CED, 0x01FC0698, 0x004E0304, 0x0D0501C1,
+    0x1D7A04DB, 0x045D0FCD, 0x00471B96, 0x0D5717FD,
+    0x18011ECF, 0x19861D9D, 0x03911FB7, 0x01CD0CBA
+  },
+
+  {
+    0x1D6F063F, 0x005612C9, 0x139D0FE7, 0x06740415,
+    0x12EF111A, 0x06C50E73, 0x19E5180A, 0x16410434,
+    0x17AC055B, 0x014F0ED0, 0x0AFF0575, 0x18C105B2,
+    0x0F630FDC, 0x1AE40D47, 0x07F80E08, 0x16D416CA,
+    0x191F1F5B, 0x14550E8C, 0x0D7409F7, 0x00590A8B
+  },
+
+  {
+    0x0FFC09BB, 0x0ACD0D94, 0x1EEE0252, 0x07DB0E5C,
+    0x12291C33, 0x107E0B30, 0x06AD009D, 0x1B7A17EF,
+    0x07611121, 0x00301E06, 0x1A351949, 0x036817CE,
+    0x09F00AEA, 0x046A17DD, 0x12111146, 0x0133047E,
+    0x0D5800BB, 0x191A1F56, 0x08680AE0, 0x01DC0159
+  },
+
+  {
+    0x0D3F0B49, 0x0DAC1D8B, 0x0F201209, 0x11DF0DDD,
+    0x03700476, 0x1E491DDB, 0x1A4E03DA, 0x121E1B0C,
+    0x06561E0C, 0x01CD16DB, 0x00B71D87, 0x14031D69,
+    0x0213198A, 0x016F007B, 0x14260327, 0x04200D2C,
+    0x14071040, 0x1EE614DD, 0x11E3054B, 0x01D7043F
+  },
+
+  {
+    0x04BB0DD8, 0x0EC40F39, 0x085A0EAF, 0x035C0A6F,
+    0x1492128B, 0x08B91B0A, 0x0AC70CD6, 0x04BD05E0,
+    0x16C51113, 0x0064197A, 0x023C00B7, 0x04F51E30,
+    0x033E11CA, 0x08A41196, 0x00A70F08, 0x1FDD1F8E,
+    0x0E0C0872, 0x061D06D1, 0x15E21D87, 0x00F81365
+  },
+
+  {
+    0x1AB81976, 0x0B7E05AC, 0x127318E3, 0x0C6611A1,
+    0x1F170B0C, 0x1D361B1F, 0x1DAB1E07, 0x0B5300AD,
+    0x1B7B10B3, 0x006215F3, 0x16241EA5, 0x04980516,
+    0x19570FEC, 0x120D0C68, 0x0E100C56, 0x08BF08CD,
+    0x17BD14E3, 0x08EB1FAB, 0x0AEA0077, 0x01691259
+  },
+
+  {
+    0x01C513DA, 0x1B1906DB, 0x19F113C3, 0x004E1510,
+    0x14040183, 0x053C150A, 0x1455107E, 0x176513F9,
+    0x130E112C, 0x01030896, 0x1B421647, 0x129109E3,
+    0x12BA0559, 0x1ED00E95, 0x1F0A0EBC, 0x14EF16C3,
+    0x10330327, 0x19D20C69, 0x1C780892, 0x01E90760
+  },
+
+  {
+    0x07C306B9, 0x09C71FBF, 0x056A1F3F, 0x00FC062C,
+    0x18A90A08, 0x17360B9E, 0x02631061, 0x000D1CBB,
+    0x095E1ADD, 0x008315FA, 0x0A5B0EF7, 0x15141E47,
+    0x17A31FF0, 0x1FF60AA8, 0x0811144D, 0x0AF401A0,
+    0x136B1043, 0x10BE105C, 0x1BBE01BC, 0x009919AE
+  },
+
+  {
+    0x08B5000D, 0x1D7701A2, 0x08461651, 0x1520007A,
+    0x05D20D2D, 0x0D091F2C, 0x15B40E61, 0x0DDB1D7C,
+    0x0BA810AC, 0x01871FE3, 0x0E241A61, 0x0FC71ABD,
+    0x0E340699, 0x0E560693, 0x147A0FF3, 0x12B80B6C,
+    0x13E7004C, 0x1EEC06FA, 0x07A41D10, 0x0055132D
+  },
+
+  {
+    0x1E610BEF, 0x086F1D2B, 0x15A91B9E, 0x1AC70B68,
+    0x12781FB2, 0x16B00326, 0x007012DB, 0x0A8D179B,
+    0x19A113C7, 0x004A060D, 0x1EC90FB9, 0x05B203EF,
+    0x17230AB1, 0x16740616, 0x196519B9, 0x19CD1D27,
+    0x063D07E9, 0x043E08A8, 0x03FD148F, 0x00A607CC
+  }
+};
+
+#elif BR_P256_COMB == 7
+
+static const uint32_t Gcomb[127][20] =
+{
+
+  {
+    0x04C60296, 0x02721176, 0x19D00F4A, 0x102517AC,
+    0x13B8037D, 0x0748103C, 0x1E730E56, 0x08481FE2,
+    0x0F97012C, 0x00D605F4, 0x1DFA11F5, 0x0C801A0D,
+    0x0F670CBB, 0x0AED0CC5, 0x115E0E33, 0x181F0785,
+    0x13F514A7, 0x0FF30E3B, 0x17171E1A, 0x009F18D0
+  },
+
+  {
+    0x0F7110EE, 0x0B8111BB, 0x04F81037, 0x06CC1E46,
+    0x0A421263, 0x0308025C, 0x141A0FCB, 0x193E0E6E,
+    0x097C174A, 0x01370878, 0x1DA11C5E, 0x0D700ED9,
+    0x079C08A9, 0x177111F5, 0x1310067E, 0x0D501DEF,
+    0x1E1F0EA8, 0x1D4D109D, 0x0991111B, 0x000714BC
+  },
+
+  {
+    0x16A702BC, 0x1BF50399, 0x02C5158B, 0x0D330C7E,
+    0x047B17A5, 0x0DF6041C, 0x162C005B, 0x06A31FFB,
+    0x00F41D64, 0x003917DC, 0x1C1D1A45, 0x04E01089,
+    0x0D8C1BA4, 0x1C7E1D99, 0x12A5109C, 0x18CA1A18,
+    0x054A0AA8, 0x0D6E182F, 0x1B16043C, 0x01861F5F
+  },
+
+  {
+    0x13761BF5, 0x0CBC0222, 0x03B51E30, 0x0AD2198A,
+    0x19791352, 0x1B5B142B, 0x0C8E1A7F, 0x0EEE11A2,
+    0x095D03DD, 0x010E02B0, 0x017C0CE3, 0x0DA5173C,
+    0x14BF0190, 0x0045197C, 0x1E811C64, 0x13A01699,
+    0x13F71D76, 0x0ED30637, 0x145C199A, 0x00EA10DC
+  },
+
+  {
+    0x0BD00611, 0x0D12065C, 0x1B80149F, 0x12C503C5,
+    0x19CB16A2, 0x1BE712E0, 0x06F519D5, 0x08911C27,
+    0x0E660FB6, 0x00300F15, 0x077D1CE8, 0x1A360FDC,
+    0x111401B6, 0x108219F9, 0x03CF1F44, 0x0C5202CD,
+    0x00E116FF, 0x0D6C17E9, 0x124F05B7, 0x01D51BC4
+  },
+
+  {
+    0x05DF0FED, 0x029A14CF, 0x04DF1AB8, 0x07321537,
+    0x1FC51E90, 0x1B1800A0, 0x11BB070C, 0x105407D2,
+    0x139F06BA, 0x005F076F, 0x0EB5070B, 0x0B331E34,
+    0x15191B81, 0x1C4D1C0F, 0x1CCC1F89, 0x0EC115A7,
+    0x01170406, 0x0AF8140F, 0x194D0DF7, 0x00431F3C
+  },
+
+  {
+    0x0BD511EC, 0x163A0B6A, 0x1D151B41, 0x10900F3A,
+    0x15BC1177, 0x1A501437, 0x1DF600D8, 0x0ED60517,
+    0x0FE91A63, 0x00F4082D, 0x02FC0D97, 0x042E089A,
+    0x10C20B2D, 0x1AC40BB8, 0x050313F8, 0x1E8D08DD,
+    0x06441513, 0x15B5165F, 0x0A08175F, 0x008E1FC7
+  },
+
+  {
+    0x15C80065, 0x11771B96, 0x1ADB1C82, 0x0EB70FE9,
+    0x11361DC4, 0x13E51A1D, 0x0EDC1395, 0x091C1226,
+    0x07A9052B, 0x00EF011A, 0x16BC1FF1, 0x0ED508BC,
+    0x0D571C8F, 0x1DE002B3, 0x093D1BCA, 0x1E0318BA,
+    0x128916A7, 0x139401BD, 0x15880EB3, 0x00860D06
+  },
+
+  {
+    0x03010827, 0x00B00CBF, 0x19B90163, 0x0F2A1706,
+    0x184700B3, 0x1547099E, 0x05AB1F72, 0x1E1309F7,
+    0x11EA0FB0, 0x00BF1C6D, 0x042A0F7F, 0x148C0D87,
+    0x1A2A1370, 0x14E500C3, 0x16C117F9, 0x05AB02B3,
+    0x06991F2A, 0x167E02A8, 0x1ABE0490, 0x00AC0B91
+  },
+
+  {
+    0x18991DA0, 0x028A1719, 0x14001D95, 0x1AAF1548,
+    0x1AE113D2, 0x0A44144E, 0x030D17E5, 0x1B640FAE,
+    0x093D09BD, 0x01BB0539, 0x0A97178D, 0x1D1006BB,
+    0x152509AA, 0x0FA6158D, 0x1DC30625, 0x1AB803B7,
+    0x0B5705E6, 0x00790D42, 0x004B16D9, 0x015718A7
+  },
+
+  {
+    0x08111D63, 0x0FFA1FDE, 0x13C51815, 0x17E015B7,
+    0x0BFC1603, 0x029B1E48, 0x08540892, 0x0B4308DE,
+    0x1C741A3A, 0x01440332, 0x1ABC07B1, 0x16B212FD,
+    0x0E0409BE, 0x09F01846, 0x06EC006F, 0x100E04D9,
+    0x1D281E8D, 0x087509B4, 0x10B0157A, 0x01F90A95
+  },
+
+  {
+    0x132B193A, 0x1D5C07D7, 0x097403ED, 0x03CE1434,
+    0x0FBA046D, 0x05621762, 0x1A3D1B23, 0x05421A44,
+    0x14560348, 0x00B3148E, 0x0C93138B, 0x0E8B1D6E,
+    0x07D605F5, 0x16AD1631, 0x1D7E0B7D, 0x0638136B,
+    0x0CB00071, 0x0DE70A02, 0x12B8073E, 0x01901607
+  },
+
+  {
+    0x1AE20AEB, 0x195815CD, 0x15E90517, 0x17891FC5,
+    0x01A90499, 0x01A4197A, 0x0D88032B, 0x09D410B0,
+    0x1B5F1417, 0x005B0CEC, 0x18AE01A4, 0x1904034C,
+    0x0E620626, 0x04DF0147, 0x060703CE, 0x1D3D193A,
+    0x078E1FC8, 0x13CD189D, 0x1A770603, 0x00600C39
+  },
+
+  {
+    0x0DAB1D43, 0x18B7127E, 0x1BFA1CF8, 0x165B1DE0,
+    0x00350AB1, 0x1CB211E6, 0x1979092D, 0x09011402,
+    0x156A12FD, 0x010A000A, 0x15141DC5, 0x129C0B71,
+    0x057F059B, 0x04791BC3, 0x0FC41086, 0x0DD11F0D,
+    0x1E6B148F, 0x1EB60D9D, 0x171F0FE8, 0x015719FB
+  },
+
+  {
+    0x0444085F, 0x161B058D, 0x1C7B0D7B, 0x1DFA1417,
+    0x05F0034B, 0x05591DB3, 0x06C716E3, 0x16A11D93,
+    0x12650B84, 0x012217E3, 0x0E481BD4, 0x055C0E0B,
+    0x164F0064, 0x13D50966, 0x0CB30C98, 0x1883115C,
+    0x0F561C1F, 0x08590CB5, 0x13CF0F9D, 0x00871E36
+  },
+
+  {
+    0x19AA0B7A, 0x138F19E1, 0x0E4B18ED, 0x0AD80E45,
+    0x08110ECA, 0x0A791787, 0x0BFA063E, 0x0109008E,
+    0x03A6177E, 0x010A1A15, 0x0B7004C6, 0x08800AF4,
+    0x1EDE1895, 0x1B831F5B, 0x18350891, 0x14DE1CA1,
+    0x1E4813B2, 0x10F61BBA, 0x15A80BF5, 0x00410D43
+  },
+
+  {
+    0x12F219AD, 0x19641B72, 0x0EF01276, 0x1F620C10,
+    0x1DB408AA, 0x087713DC, 0x1E910351, 0x1CEE10BD,
+    0x04BA1977, 0x0152071D, 0x1CE81AC9, 0x1BDF004B,
+    0x17731F60, 0x1D501B85, 0x086307D5, 0x0E611E34,
+    0x0E961D94, 0x1DF10A17, 0x0EB91B61, 0x01EB0697
+  },
+
+  {
+    0x079B0AD9, 0x13A80B63, 0x0AA81D3F, 0x09AF060A,
+    0x0DCB090B, 0x138112C5, 0x1C5507C6, 0x198409A3,
+    0x18BA0417, 0x00F40534, 0x14E00DEB, 0x1E8A19DD,
+    0x1A531762, 0x19C819B6, 0x120E083C, 0x1F02044A,
+    0x04B20003, 0x068D1098, 0x1B3D0FA5, 0x011A0FE4
+  },
+
+  {
+    0x0CAF0FCF, 0x091200DD, 0x07EA0ACC, 0x0E2D0A67,
+    0x02521B71, 0x1DB8015E, 0x1DFB1EDF, 0x04AD0E16,
+    0x113F15EC, 0x003B0D74, 0x1F220B30, 0x037C153F,
+    0x0D3A16ED, 0x040F1179, 0x15820D68, 0x15DE1476,
+    0x1D480CA2, 0x134C1AA3, 0x18E91023, 0x013E09B0
+  },
+
+  {
+    0x069909C4, 0x1E250F07, 0x1C591152, 0x14D2067E,
+    0x0BF609C9, 0x07961840, 0x119E1EBC, 0x0FDF0685,
+    0x07991F03, 0x00B41100, 0x156405AA, 0x09E007E8,
+    0x1FDF1A5A, 0x1863106D, 0x0432124E, 0x1F411681,
+    0x0E310AFE, 0x124F17BB, 0x07240C41, 0x00070248
+  },
+
+  {
+    0x050E03B9, 0x106C0620, 0x02361FBE, 0x15C21007,
+    0x1CFC15B0, 0x14ED0C3D, 0x15460D04, 0x137B0DB1,
+    0x194C1915, 0x00B6091A, 0x17F80D3D, 0x112E068E,
+    0x097C16E6, 0x00FF0EDB, 0x11580464, 0x07561E89,
+    0x071F1F47, 0x14251BB6, 0x111C1F05, 0x01631341
+  },
+
+  {
+    0x05E51681, 0x1F251256, 0x01211A38, 0x0A961009,
+    0x014E0BE3, 0x07020A2E, 0x0B460226, 0x00740CA2,
+    0x1D291FAC, 0x00260F64, 0x1ECA0915, 0x13D80265,
+    0x1B9D0F6C, 0x16D918D1, 0x08C6047A, 0x157203BD,
+    0x16811EF0, 0x0C0D0F11, 0x0D8708E5, 0x00301D16
+  },
+
+  {
+    0x020512B4, 0x1A1510D1, 0x137510F0, 0x18971091,
+    0x0B721BAB, 0x1D0F0B97, 0x0CCB1E56, 0x07B21DD7,
+    0x183E0A35, 0x00F60A8D, 0x17790F0D, 0x007319F4,
+    0x128A0428, 0x1ED91247, 0x0A461B0C, 0x0D0B0D7D,
+    0x0FD50E7A, 0x0A591385, 0x1CF50427, 0x00E2140E
+  },
+
+  {
+    0x1511070A, 0x15CC11FC, 0x0350128C, 0x0A3C069E,
+    0x07F91A86, 0x1C6D1032, 0x18200057, 0x08E50E7B,
+    0x15E10970, 0x00571274, 0x0C9D193C, 0x1A980E81,
+    0x02CE00EC, 0x199F0638, 0x0DE01125, 0x0AE40BD8,
+    0x15BA1688, 0x198C1781, 0x165B11F2, 0x01670AE7
+  },
+
+  {
+    0x19301AA1, 0x135F097E, 0x129602C6, 0x1FDA031E,
+    0x1F5617EB, 0x0C8D0A85, 0x152F18CB, 0x053F18F6,
+    0x1A8A17A7, 0x01A31C9A, 0x1A52195F, 0x18540D13,
+    0x1B5C12A8, 0x19D20DA7, 0x0C2E03E8, 0x09870CCF,
+    0x1884103D, 0x02840C7D, 0x0B9208FC, 0x00911D82
+  },
+
+  {
+    0x15820A4D, 0x00AA1823, 0x09DD1C69, 0x116E1BA9,
+    0x047119BC, 0x179C0C48, 0x10151C2F, 0x08301DDE,
+    0x13390213, 0x01040E35, 0x072C119C, 0x1D4909CA,
+    0x103D05BC, 0x0584000C, 0x1EE9011D, 0x122614BD,
+    0x1E4B066E, 0x0A0E11B0, 0x063B0A08, 0x017308ED
+  },
+
+  {
+    0x147C0357, 0x0CEA1368, 0x008E084A, 0x19B60797,
+    0x1D4408DB, 0x09780CC5, 0x1B6C1B11, 0x11051813,
+    0x1B7E1DF0, 0x00671DB8, 0x13F9195C, 0x095F0D6B,
+    0x062C051F, 0x0A4A09C8, 0x16100ECF, 0x1EFD0654,
+    0x188F04FD, 0x112E1F5C, 0x153E1F4F, 0x013C064E
+  },
+
+  {
+    0x1AC50E2E, 0x0BE60816, 0x0C7418D4, 0x199D1B64,
+    0x16A31253, 0x17010183, 0x045905D2, 0x1A891FF5,
+    0x1C6A0802, 0x01AA0060, 0x1B1E0DCC, 0x1645009A,
+    0x1B131885, 0x09250851, 0x026A01F8, 0x1FA81252,
+    0x0BBA0734, 0x0CE50F59, 0x049219E4, 0x01A71733
+  },
+
+  {
+    0x0DE61045, 0x18E2171F, 0x1F040CC5, 0x05ED0B16,
+    0x1E590A44, 0x146013F4, 0x019B1A41, 0x028005BF,
+    0x0EF61E39, 0x017C0ACC, 0x09E907A8, 0x08720353,
+    0x1A931520, 0x157119C2, 0x1FF71C9A, 0x0FBE1E77,
+    0x0DB9192C, 0x0F2E00FE, 0x0DF10C66, 0x01211AEA
+  },
+
+  {
+    0x1E1807E8, 0x0E361B66, 0x0A051784, 0x19F71E48,
+    0x03B41A1B, 0x060E0E39, 0x1B7115F0, 0x11B90D3F,
+    0x1B6D1891, 0x00600F3C, 0x08191335, 0x00A30768,
+    0x0384166E, 0x0C9007AA, 0x129C1DCD, 0x18681BEB,
+    0x07E11556, 0x05401708, 0x14D6085F, 0x010B1303
+  },
+
+  {
+    0x1B5012CC, 0x04EF1139, 0x064A128A, 0x10871B11,
+    0x129D1FED, 0x006B04A1, 0x16B40112, 0x002518AB,
+    0x052B152E, 0x0008074B, 0x0BA316E9, 0x0E470C9C,
+    0x1FF30881, 0x0DD41928, 0x0B0609EF, 0x05BA107A,
+    0x185106E6, 0x17EF05A7, 0x1465174F, 0x0033150B
+  },
+
+  {
+    0x090A17FF, 0x075A03E7, 0x18F70AE0, 0x026F141F,
+    0x174C017B, 0x09D703BB, 0x0D2018AE, 0x094105D4,
+    0x04321787, 0x01951EDB, 0x1E740988, 0x1D81005C,
+    0x0F07016C, 0x08B204EE, 0x04E30AB4, 0x156918B8,
+    0x10E51B99, 0x18CF0806, 0x18F615C5, 0x005516BE
+  },
+
+  {
+    0x06C210BD, 0x1B300AA8, 0x14751021, 0x062D013D,
+    0x0D6B0079, 0x1BED1F73, 0x0426069D, 0x08EB005F,
+    0x17CF0B3F, 0x00CA0F6B, 0x18A90B37, 0x154D0AFB,
+    0x16D513DE, 0x17DE1A6C, 0x0EF31FDA, 0x02EA13E9,
+    0x19030B04, 0x03011375, 0x0FC719E0, 0x005B125E
+  },
+
+  {
+    0x130916CA, 0x17F81976, 0x0A3E0510, 0x14160DBF,
+    0x1174045C, 0x13BA16ED, 0x0B8B0B93, 0x1B641300,
+    0x0B88074F, 0x00FC0E7F, 0x1B4F075B, 0x115415F0,
+    0x171400F6, 0x1FFE1204, 0x1794068E, 0x11780F44,
+    0x121E0F04, 0x1CA914A8, 0x0C171613, 0x01531820
+  },
+
+  {
+    0x0C7C0D22, 0x1260036E, 0x04760CAA, 0x0F76093E,
+    0x19701DD4, 0x0E540AA4, 0x0DFF150B, 0x0A4E067F,
+    0x06AA1D9D, 0x01121C3C, 0x02150345, 0x1E77131F,
+    0x19120268, 0x0F3B1E7D, 0x0F260C11, 0x0D571414,
+    0x0E540CA5, 0x0A6A0C26, 0x0CCC05B9, 0x005F0E79
+  },
+
+  {
+    0x031F1759, 0x0E720336, 0x18861C09, 0x0DCB00AE,
+    0x0F51011E, 0x0DDD0BCB, 0x13F3173A, 0x0FA71BDA,
+    0x1D4A196E, 0x00C01335, 0x164C034E, 0x1CBD07D6,
+    0x012F0511, 0x02A214B8, 0x03930AB2, 0x0E920EAE,
+    0x08D50B9C, 0x1D561EA3, 0x03FF1215, 0x016114C1
+  },
+
+  {
+    0x09C30B9A, 0x054A1A0C, 0x1A251743, 0x050D0C8B,
+    0x1AF50A5D, 0x19D8136F, 0x17D5049B, 0x05860BC4,
+    0x198413B6, 0x007A1E44, 0x05530385, 0x1980151F,
+    0x014A0211, 0x16980C51, 0x03F216D9, 0x1DAB1AEE,
+    0x1C970136, 0x00961419, 0x1B760A84, 0x00D20BF7
+  },
+
+  {
+    0x012E1BCA, 0x199E0F02, 0x108D05B6, 0x07CD10D1,
+    0x1D0D044D, 0x0F8F00C3, 0x086D0BAF, 0x015B13E1,
+    0x194019EE, 0x00AD1060, 0x1E6B078E, 0x1A25041D,
+    0x03FD0499, 0x02C20754, 0x0D3F084F, 0x16C61EA1,
+    0x0B3E0616, 0x00D91172, 0x1BA90418, 0x00FD033D
+  },
+
+  {
+    0x023F0C08, 0x154F0E30, 0x0724093F, 0x07850959,
+    0x13AE193A, 0x1C801E0F, 0x0D2C0508, 0x078705DD,
+    0x0A050572, 0x001D1A35, 0x082F1672, 0x158C03AB,
+    0x0D290D65, 0x00251CAB, 0x18B81484, 0x03261779,
+    0x063A14FA, 0x0F900BF5, 0x1EA8061A, 0x01FF0B12
+  },
+
+  {
+    0x06BB1718, 0x0C9202F5, 0x16AD18C7, 0x024311D7,
+    0x02151948, 0x053C0A38, 0x00871CFB, 0x045C10C8,
+    0x025F1F41, 0x00A9016D, 0x04C60910, 0x0DD50562,
+    0x1FEA1E3F, 0x1E12046C, 0x0F3E1089, 0x099B0510,
+    0x03DA10BF, 0x03CE137A, 0x107618A2, 0x012E05E2
+  },
+
+  {
+    0x137D11BE, 0x1B031006, 0x047113E9, 0x1DB0194F,
+    0x16CD0803, 0x1C931BEC, 0x033F05A8, 0x158A1463,
+    0x0FBD19F2, 0x01360F49, 0x15480E50, 0x17440F68,
+    0x085E0313, 0x0FD0041A, 0x10E009A3, 0x116C0FB6,
+    0x1F011451, 0x1E4D103E, 0x18430496, 0x006D1538
+  },
+
+  {
+    0x162C16CE, 0x01B30917, 0x1B3A06F1, 0x04F31F47,
+    0x1215008C, 0x087700E9, 0x1514067C, 0x02EA00FB,
+    0x07E217B7, 0x01420EB8, 0x1CEB14B9, 0x146F1BCA,
+    0x1C2B1E3C, 0x170811D4, 0x0D1B0378, 0x1DCF1E92,
+    0x136813B8, 0x0F1615AB, 0x13630BDB, 0x001405E7
+  },
+
+  {
+    0x0F5E03ED, 0x0BB10412, 0x0D3F0124, 0x12971F64,
+    0x09DC18C9, 0x09FF02CD, 0x0DC405E6, 0x1FFD13CD,
+    0x12471355, 0x012C1982, 0x0DDF1899, 0x153B0B94,
+    0x000D1247, 0x11691CD9, 0x00B51066, 0x18DA061F,
+    0x09E408BF, 0x0AA01EC8, 0x1F231D32, 0x00AA007C
+  },
+
+  {
+    0x186C04FA, 0x0BEA138A, 0x12DA1E1F, 0x00C71119,
+    0x099E08EC, 0x0F8907B3, 0x1D5F09AA, 0x0B801E35,
+    0x0DD1088B, 0x01FC1339, 0x07050C9D, 0x14BA0BE4,
+    0x10DB0917, 0x03E00CFE, 0x0FA11558, 0x0F901947,
+    0x162606DE, 0x0AE31697, 0x09EE0C70, 0x003B077A
+  },
+
+  {
+    0x1BEC0DD2, 0x09D603DE, 0x0FE80DDD, 0x17CA151F,
+    0x11FB18F6, 0x00981F0B, 0x16DA1416, 0x03A618E9,
+    0x137B0F2F, 0x002112A6, 0x1D7E0848, 0x1BC40D49,
+    0x0E6B1174, 0x09F017A2, 0x03EB1A04, 0x1AA60846,
+    0x00210B8E, 0x1F531CDE, 0x11C01F51, 0x003A0466
+  },
+
+  {
+    0x08080581, 0x09190E99, 0x078F05A0, 0x1D7505D9,
+    0x047501CD, 0x0B4E0CA9, 0x0E3E1AA7, 0x0F07172C,
+    0x0BDA0F0A, 0x01710CC2, 0x161C06A0, 0x02A613B4,
+    0x0C9B1C09, 0x07431C27, 0x1AD70F87, 0x05BB0DC8,
+    0x14AA0A4D, 0x17FE1896, 0x01B50491, 0x008C0D16
+  },
+
+  {
+    0x0A2E03F6, 0x0AF81E49, 0x086B0019, 0x17CB0732,
+    0x1A6E111B, 0x03580D8A, 0x09300776, 0x14E516B9,
+    0x062E0DC0, 0x001A0334, 0x124A07D7, 0x10831267,
+    0x1B43071C, 0x035C0169, 0x12ED17EA, 0x11771687,
+    0x0A8B1538, 0x0DAE0FCB, 0x0D50110C, 0x01BA036A
+  },
+
+  {
+    0x0D0A0396, 0x0ECF1448, 0x118815CF, 0x19781D9D,
+    0x045715FE, 0x1BE612C9, 0x0AC30E9A, 0x179A17A1,
+    0x1B88017C, 0x00B20ADD, 0x0BEE0AA5, 0x1E7D1D4F,
+    0x14A407BA, 0x1DEC0094, 0x04BA1ACA, 0x122C0584,
+    0x025D14A3, 0x09C405D2, 0x1EC1033D, 0x005D074F
+  },
+
+  {
+    0x1AEA0F2E, 0x1B251847, 0x1FF1124B, 0x07BD14E9,
+    0x119F0ED2, 0x12430F2A, 0x17990769, 0x00F00CC3,
+    0x19030A19, 0x01FC0785, 0x059C0FC1, 0x177F12B4,
+    0x029B1A74, 0x17A4188E, 0x0B56156F, 0x049B1383,
+    0x09E213FA, 0x027E0C51, 0x1C6A172E, 0x0171159B
+  },
+
+  {
+    0x00151536, 0x038F001E, 0x024117B1, 0x1E290A29,
+    0x1ABF0701, 0x0D5C0C7D, 0x0FC81FA7, 0x0B811217,
+    0x1F0100F8, 0x009E0EDD, 0x0894069F, 0x0208160B,
+    0x01970992, 0x0D5C19C8, 0x11E10708, 0x05A10005,
+    0x17D211BF, 0x0C5B0048, 0x1F780714, 0x00A90737
+  },
+
+  {
+    0x0EDD035B, 0x06BF0A5B, 0x1F5D0551, 0x18411267,
+    0x09E20793, 0x0B9A14D8, 0x0C261ED6, 0x009F1A9A,
+    0x1B9103F8, 0x01831A77, 0x03C10A6F, 0x0348134D,
+    0x071B1516, 0x12D11D60, 0x0E151442, 0x0EFE0917,
+    0x122B0CA6, 0x114E0EEC, 0x09FB0BCD, 0x01F11502
+  },
+
+  {
+    0x0FBA157B, 0x04401CBD, 0x0D8F1AD4, 0x074A0A34,
+    0x04AF02F6, 0x06800646, 0x05970312, 0x040F1105,
+    0x126D1978, 0x00F60787, 0x189B0CC8, 0x02A51A97,
+    0x0C4F00D3, 0x063E0264, 0x0A68020B, 0x1B410AB2,
+    0x15920A9B, 0x0F781478, 0x03891683, 0x00DD102A
+  },
+
+  {
+    0x063218C5, 0x0BE418A0, 0x022E0A9D, 0x0A1D169C,
+    0x1B8E0157, 0x125417FC, 0x1A1419BC, 0x077D0153,
+    0x001F07FE, 0x00C01F5F, 0x19AA0062, 0x03091FB8,
+    0x1CD811EA, 0x070C1968, 0x0BEB0762, 0x00C504AC,
+    0x14040437, 0x1AEF1D14, 0x100012DA, 0x01EB1EC0
+  },
+
+  {
+    0x0B3D16AF, 0x19CF1641, 0x183000A3, 0x19831FA6,
+    0x11AF1CE2, 0x0D8619B8, 0x06F1080D, 0x0B84125E,
+    0x055303A5, 0x006B120B, 0x1A91047F, 0x0EB6131B,
+    0x082D07E5, 0x0A0A0B03, 0x1AA11C72, 0x14981418,
+    0x12901072, 0x08FD0701, 0x070C121B, 0x00160C31
+  },
+
+  {
+    0x0D430757, 0x00371DDD, 0x00790E11, 0x0398161E,
+    0x11F914B0, 0x14C40C4B, 0x08400F88, 0x1968003F,
+    0x03F3093B, 0x016114F3, 0x081207BB, 0x17531066,
+    0x02901E63, 0x006D1C68, 0x084B1DD0, 0x1743137E,
+    0x07250484, 0x1E481EEA, 0x19331E38, 0x017118BA
+  },
+
+  {
+    0x1CAD0D3C, 0x153B07F8, 0x13301BA9, 0x01051A4E,
+    0x1C620139, 0x123D1C39, 0x097700EF, 0x04F80154,
+    0x10F4007D, 0x01440CE6, 0x13251317, 0x1AD217C3,
+    0x0A2E1D9B, 0x115900DB, 0x02FC0D0B, 0x1BD51C17,
+    0x027E15A5, 0x0C3500CC, 0x19370C8E, 0x00431B10
+  },
+
+  {
+    0x14941CA8, 0x195D01CF, 0x179119CF, 0x03FD02F4,
+    0x07961A27, 0x0C3A1F8C, 0x09CF1E39, 0x09251C11,
+    0x1DFB07D3, 0x00140839, 0x133217C2, 0x09D4092B,
+    0x079B1B61, 0x19F30886, 0x1CE60E0E, 0x08BF10C5,
+    0x04AC08D7, 0x1F8E0E95, 0x1B240F34, 0x01660D10
+  },
+
+  {
+    0x1BD106A6, 0x102607A0, 0x1B930E43, 0x186B0563,
+    0x12F416AE, 0x05FF0A9E, 0x037D0435, 0x02C3114E,
+    0x1D331218, 0x0047170A, 0x01070AD4, 0x12521234,
+    0x16F119D1, 0x043E137B, 0x199D18BC, 0x09A61621,
+    0x19AF039B, 0x15FC0497, 0x12601AAC, 0x016C1DB8
+  },
+
+  {
+    0x108C0BEC, 0x1767012B, 0x01B81CA0, 0x0F4515BB,
+    0x0BF21EFC, 0x063E1E9D, 0x051E1709, 0x05320CD7,
+    0x07601115, 0x012E0AC7, 0x131B0B50, 0x07C0053F,
+    0x1BBE1480, 0x197710E3, 0x0D0A119B, 0x17D5007B,
+    0x1AD40297, 0x01EC036D, 0x1F2E1A4B, 0x007E0810
+  },
+
+  {
+    0x0E7A0771, 0x12B4095A, 0x1FC40B0A, 0x1C34003D,
+    0x115B1227, 0x17F50232, 0x09AD0C56, 0x130C089C,
+    0x0FFB0456, 0x01C40F3A, 0x12E712E1, 0x1DA11B92,
+    0x103111B2, 0x1B7F05B9, 0x042A0C61, 0x0F4218E0,
+    0x02CD190F, 0x1FC80281, 0x07701524, 0x017C1C03
+  },
+
+  {
+    0x01030717, 0x07E50B4B, 0x08381C6B, 0x04CE16AF,
+    0x078B092C, 0x07291067, 0x08A91DE7, 0x0AE012F7,
+    0x09DC0928, 0x00881EF3, 0x03201E7F, 0x1406074D,
+    0x0168078D, 0x0775002F, 0x1C730AE1, 0x083210AE,
+    0x12420723, 0x09F105C9, 0x11F6178B, 0x00AF11F3
+  },
+
+  {
+    0x184A08E1, 0x14AF0D51, 0x1D4A0A6F, 0x0253112C,
+    0x1DAE1AF9, 0x0B560114, 0x1E0E02F9, 0x009E157D,
+    0x197F1432, 0x00DF126C, 0x09821932, 0x12C717A6,
+    0x06F719A6, 0x12710FA9, 0x038E0349, 0x0FAA0734,
+    0x027B079D, 0x1E641101, 0x1B481760, 0x00B717F9
+  },
+
+  {
+    0x0FE01B22, 0x14630936, 0x195A0C0B, 0x09820ECD,
+    0x0B0501AE, 0x18F30211, 0x1A6E176C, 0x0E6B15D0,
+    0x05F8038A, 0x014F18E2, 0x002D1C7D, 0x09C8138D,
+    0x00AE1112, 0x0BE70DE5, 0x1A1C06FE, 0x0A8A1138,
+    0x1EE30FFF, 0x0A700310, 0x1831110F, 0x00E7129E
+  },
+
+  {
+    0x02871080, 0x116C1CC0, 0x09C408EB, 0x1F290FC5,
+    0x1CAF15BB, 0x03A70B11, 0x01010737, 0x1D781C71,
+    0x13BA106A, 0x01CF1F86, 0x0F4F032B, 0x131316A6,
+    0x0B54048C, 0x06EC1D92, 0x07C70DFB, 0x0796160E,
+    0x128F0789, 0x0BB51C77, 0x036810E6, 0x00D501F1
+  },
+
+  {
+    0x00721465, 0x0490007D, 0x1CCF090A, 0x06CB1476,
+    0x197A1A55, 0x17AA1392, 0x1B520713, 0x11C00095,
+    0x18A612F7, 0x01D01F73, 0x16D71B79, 0x0F1A0F59,
+    0x04560312, 0x02520247, 0x1D4A02CF, 0x096B0C9E,
+    0x01690B38, 0x13FC0557, 0x17350B57, 0x00A51573
+  },
+
+  {
+    0x099B1260, 0x0E6F03B8, 0x1F630445, 0x12CF126E,
+    0x08770699, 0x157C007B, 0x02FB1FE1, 0x15A31C7E,
+    0x15910797, 0x000C080A, 0x1E2909A0, 0x0DAB0378,
+    0x15A413C8, 0x09E40B63, 0x1A6F148A, 0x07C51885,
+    0x079C053D, 0x0B3C1FEA, 0x055C0086, 0x01A1090B
+  },
+
+  {
+    0x0B2C05D1, 0x11FF151B, 0x10B90A1A, 0x05150EBE,
+    0x150A09E1, 0x11B21C4A, 0x0D9D0DE7, 0x0C590E3D,
+    0x13E00C28, 0x01381C05, 0x12C20AEC, 0x06D210B8,
+    0x071606D6, 0x12781775, 0x0E3D0A1F, 0x1A2E12D9,
+    0x1D431232, 0x12DC116F, 0x09B2122A, 0x00C9139B
+  },
+
+  {
+    0x15400ECF, 0x1B7708E2, 0x034119D5, 0x0BBE1E6F,
+    0x0F2E0E32, 0x0187011F, 0x196D16B0, 0x127E1C55,
+    0x12F404E1, 0x00021077, 0x1FEB0721, 0x1FE81C4D,
+    0x190E0489, 0x0D4114E8, 0x075915FA, 0x1BC80837,
+    0x10A81B35, 0x186C1CEA, 0x01AB13D2, 0x005A06AE
+  },
+
+  {
+    0x1C2D0729, 0x02AA0F34, 0x03650617, 0x14AA0593,
+    0x13D7192D, 0x08941716, 0x08720391, 0x0ED807EF,
+    0x13D10915, 0x012E113C, 0x0CAA1ED1, 0x18C60617,
+    0x15F30607, 0x0759188D, 0x0A9B1711, 0x19F20276,
+    0x0C9A08D2, 0x18311A6C, 0x06EA0F5E, 0x00E21483
+  },
+
+  {
+    0x07A41A02, 0x1204191A, 0x05D4095E, 0x0B820851,
+    0x19910FF2, 0x100D187F, 0x040313B7, 0x016D0DD0,
+    0x1B6314C5, 0x01D4021E, 0x08660B95, 0x109A0F8D,
+    0x0DBC0CF6, 0x1AFC16E1, 0x1E4C0AD7, 0x0F7600A2,
+    0x0B5705A7, 0x0E1C1559, 0x1E6F040B, 0x003813CC
+  },
+
+  {
+    0x0D9D1B5D, 0x0C3C1D74, 0x0F880452, 0x1FD1176F,
+    0x10D00627, 0x114A1F8C, 0x0CBD0C31, 0x0D990B1C,
+    0x16C10D32, 0x01F9198D, 0x15200061, 0x15820A8B,
+    0x0C631C54, 0x10A20BCC, 0x0D8F1AD8, 0x1EFA017E,
+    0x05D71EE4, 0x0B741BAA, 0x18A316CD, 0x01E80CED
+  },
+
+  {
+    0x1B5F1946, 0x097C13CD, 0x112715D0, 0x0D9712AB,
+    0x04660146, 0x00EE0CCE, 0x00421302, 0x0AE61435,
+    0x0E931144, 0x004A1479, 0x094C1C54, 0x16E80A18,
+    0x1C3214FA, 0x11CE101E, 0x1AF30874, 0x0CF2122B,
+    0x1B551100, 0x07FC1631, 0x032302C1, 0x00C41FAE
+  },
+
+  {
+    0x0B810E80, 0x1CB911DF, 0x01691EC5, 0x18B503BC,
+    0x19880EEF, 0x09E01ED6, 0x022A1AC6, 0x144A13F2,
+    0x01340C40, 0x00931876, 0x043C1D1E, 0x0ED518A8,
+    0x004C05C5, 0x1B54097B, 0x07620E52, 0x15B61BA0,
+    0x07691DD9, 0x011A0EEF, 0x1D1103C4, 0x017A1077
+  },
+
+  {
+    0x01170E92, 0x11B11D21, 0x00321147, 0x03B81727,
+    0x16CE0F46, 0x15F713DE, 0x13BD04BA, 0x06B211EC,
+    0x16821422, 0x00C0057D, 0x14470975, 0x00430067,
+    0x13E4195E, 0x00980BAC, 0x0B3C0F4C, 0x009212B5,
+    0x0D2F18D5, 0x12001B7A, 0x153901A2, 0x01BE020A
+  },
+
+  {
+    0x0783081B, 0x170E1ACC, 0x1AA114C8, 0x1D230DD8,
+    0x00DB035A, 0x024B104B, 0x1643005C, 0x1D4206CD,
+    0x03851CA1, 0x01211344, 0x120B1470, 0x1B9B0E0C,
+    0x13ED1BBA, 0x0B4C1FD4, 0x00661D18, 0x0B6A0015,
+    0x1CB90BFA, 0x03300807, 0x0C3A1BEE, 0x00C001BA
+  },
+
+  {
+    0x140903C6, 0x12340CA7, 0x16FD1F2C, 0x11D009E0,
+    0x063404BE, 0x0FBF0E23, 0x02E417A5, 0x000E00D7,
+    0x01361B16, 0x00A71EFA, 0x17D80C93, 0x168D0B46,
+    0x02C11774, 0x0BEE08DD, 0x0BF70484, 0x106C0D16,
+    0x0E550ABE, 0x006D0737, 0x081B1665, 0x01A001D9
+  },
+
+  {
+    0x058F1F29, 0x0D881B96, 0x0805192C, 0x112016C1,
+    0x0AE110D9, 0x1534009A, 0x065C02B3, 0x1BA1089A,
+    0x0EA00743, 0x0196083C, 0x0C7C1A55, 0x084412BC,
+    0x14C50C24, 0x17F81CAC, 0x101B0E32, 0x0D1303A3,
+    0x18190E25, 0x1C1608D6, 0x1EFD1BAE, 0x00D80F05
+  },
+
+  {
+    0x082016EA, 0x0DE418F6, 0x07911111, 0x0B8C0AE0,
+    0x08801B6D, 0x02291530, 0x016F05E6, 0x015A0BF0,
+    0x020C0140, 0x01FF1AD0, 0x1CE11B00, 0x05CE0E8C,
+    0x06631F70, 0x111C0D2D, 0x09B709B4, 0x169C0CA1,
+    0x07671D5A, 0x076205D3, 0x1DA803F2, 0x00D5180B
+  },
+
+  {
+    0x154C1D2C, 0x11F90B84, 0x17D10573, 0x08BF069B,
+    0x126E0BF6, 0x08A51C49, 0x1EEA0EBE, 0x1E220318,
+    0x06781BD2, 0x008C0B2E, 0x1C2E0BF6, 0x1B640577,
+    0x0CAC1CEF, 0x18BE0933, 0x1831037F, 0x0E41097D,
+    0x0AC71415, 0x0E1403F8, 0x07D31BA2, 0x018B11DA
+  },
+
+  {
+    0x00D301C5, 0x111F1C48, 0x14070BDA, 0x14220981,
+    0x013218A4, 0x10B0032C, 0x04D01A69, 0x12D41B7E,
+    0x1A3403C2, 0x00D61F89, 0x19C01A9E, 0x020D10DD,
+    0x0AE91ADA, 0x0A59164E, 0x18F0001A, 0x1B9F0845,
+    0x0899005B, 0x113D1D2B, 0x08DA03BF, 0x008612A8
+  },
+
+  {
+    0x1C630A16, 0x172711DF, 0x15CB1BE3, 0x038319FB,
+    0x1D081169, 0x10631050, 0x03310A7F, 0x0A9D0F08,
+    0x09420BAD, 0x0151156C, 0x174800B3, 0x03A91089,
+    0x1B5A0F9E, 0x05C008C6, 0x1C7A1848, 0x16780BE8,
+    0x17B917B0, 0x040F1BFD, 0x15D01AF5, 0x006B04B7
+  },
+
+  {
+    0x12CC17B7, 0x0F941F55, 0x1EFC0D1B, 0x1CF401AB,
+    0x0CD51FC1, 0x0D251B14, 0x106C154A, 0x02791709,
+    0x18871C73, 0x01591EA4, 0x11C202B1, 0x19E0081A,
+    0x03B11473, 0x03030287, 0x03060B0F, 0x0D9814F0,
+    0x04B603C8, 0x1E5A0707, 0x1EE316CA, 0x01EF1641
+  },
+
+  {
+    0x06300096, 0x14760552, 0x1B020929, 0x08A31B47,
+    0x19D21E28, 0x0D1107A9, 0x153813EF, 0x0F3F11F1,
+    0x02BF07B5, 0x00881510, 0x06E50524, 0x061F0313,
+    0x00271871, 0x0D950BA3, 0x120E11C9, 0x0C060F5F,
+    0x0FA015DA, 0x1B7A0CF0, 0x005A1AE7, 0x01F914A5
+  },
+
+  {
+    0x001D1697, 0x1E661A8E, 0x1B61018C, 0x04E80F7D,
+    0x01E8161F, 0x08CD1CD9, 0x01461021, 0x05A0140C,
+    0x110A049A, 0x00981220, 0x1BCE1D6E, 0x193D0F10,
+    0x152C1B0B, 0x1D7D0773, 0x10501AFC, 0x01C8145D,
+    0x1B251458, 0x1C150155, 0x137B1D58, 0x009B0D35
+  },
+
+  {
+    0x0D9B056A, 0x1E041D8D, 0x0D080D93, 0x18FC1AF2,
+    0x1BA3030C, 0x12650B6A, 0x11921C5B, 0x0E151FA0,
+    0x0ECA0207, 0x01B00BCC, 0x0F67008C, 0x09BE12E9,
+    0x1525030B, 0x03C60BCA, 0x150513B5, 0x0E49068A,
+    0x1D1A0081, 0x1FA800AC, 0x11D501E6, 0x000703C5
+  },
+
+  {
+    0x0B6703D5, 0x117518EC, 0x16EF18E6, 0x0108179A,
+    0x011B06E8, 0x1B040A7B, 0x0E3F151B, 0x13D912F7,
+    0x0FEF148B, 0x01F10C0F, 0x0CB100D2, 0x0D110753,
+    0x12BA00D9, 0x1B6201DC, 0x05DB1BD8, 0x1D020053,
+    0x1D0C06D5, 0x0F281C26, 0x0A4F0A03, 0x01840F49
+  },
+
+  {
+    0x10CA09B7, 0x03061A16, 0x162B0422, 0x11DF1EA0,
+    0x15FB14F7, 0x0A8B16FD, 0x0B1F1AE4, 0x1F36195F,
+    0x04930B0C, 0x01E313D6, 0x10431C01, 0x015A0D09,
+    0x07B40C2A, 0x1FC1124C, 0x07A704D1, 0x0EC60A0B,
+    0x1302172F, 0x0FED1DD7, 0x15D50366, 0x01270781
+  },
+
+  {
+    0x0BF81725, 0x1FD4035E, 0x0C0F12C6, 0x06700CA6,
+    0x02F402F2, 0x02F71F03, 0x0A390BE4, 0x01EB1382,
+    0x018E0840, 0x01E80014, 0x160902A8, 0x13D61E3D,
+    0x1FBA0ADB, 0x090D15A1, 0x1F2B01A9, 0x10451523,
+    0x15F91D2E, 0x11FC066D, 0x10950D29, 0x000B0724
+  },
+
+  {
+    0x06C00ECB, 0x1E39081E, 0x13F5195C, 0x0B3A0444,
+    0x113F0A1D, 0x126003F0, 0x044E05A9, 0x1AAB0A5B,
+    0x070002B3, 0x01530780, 0x073E0072, 0x0ECD1FA1,
+    0x15D0159E, 0x0CF71DCA, 0x0EDA1F4F, 0x1666025F,
+    0x148217DF, 0x10701758, 0x0F390458, 0x01BF1CDE
+  },
+
+  {
+    0x143A00ED, 0x17AF01D9, 0x18D00BD8, 0x189817A5,
+    0x003D1DD7, 0x06261B46, 0x09C21892, 0x14D41B9A,
+    0x1BEB11E7, 0x00A91A2A, 0x12F901DE, 0x1B1416A9,
+    0x1A4113FF, 0x11631568, 0x1A290BC4, 0x18C41776,
+    0x09640A21, 0x091F0FB6, 0x1F250916, 0x007E1644
+  },
+
+  {
+    0x051B10EF, 0x04C0102A, 0x0AAD0452, 0x1D8F0A2E,
+    0x0FB8104C, 0x0E24111E, 0x1A6715F9, 0x1A93056A,
+    0x14E313CF, 0x019C02D1, 0x019F007B, 0x00AD1239,
+    0x13390B51, 0x1394075B, 0x0E250637, 0x0B02077E,
+    0x10FE0EA4, 0x021C1664, 0x109F02DB, 0x0047065F
+  },
+
+  {
+    0x03830874, 0x14960912, 0x19930BE8, 0x145E19E8,
+    0x00D1025D, 0x177401B3, 0x1C710559, 0x082D1772,
+    0x13920DBE, 0x015312E2, 0x0A6E1EEF, 0x19AE099F,
+    0x0246083A, 0x0FB61CF1, 0x081C1DEC, 0x0DF51206,
+    0x10BD0705, 0x1C660193, 0x0A5D07C1, 0x01740FF8
+  },
+
+  {
+    0x1DBB1133, 0x110F1515, 0x1BA113C6, 0x18620C93,
+    0x0AFE0726, 0x08821AD2, 0x1015160B, 0x1A891D87,
+    0x07471451, 0x015B07B3, 0x0CD71768, 0x1AA50BD3,
+    0x124107D8, 0x09860D89, 0x08901B62, 0x1E0B09E9,
+    0x1D670131, 0x027E1AFE, 0x18F00815, 0x00990336
+  },
+
+  {
+    0x18D9173D, 0x15B00778, 0x102318D4, 0x13641520,
+    0x1BFE0698, 0x03B00E37, 0x101B18A0, 0x0DE40788,
+    0x1C1D1D0B, 0x003E0C28, 0x11C10CA6, 0x03BE191E,
+    0x15C71760, 0x0453002C, 0x1EEF06F5, 0x0D4C11C4,
+    0x0442063D, 0x0E9A12E8, 0x030A1BE2, 0x01DB0D13
+  },
+
+  {
+    0x1AF31018, 0x10B90252, 0x066D12C1, 0x1F000DB1,
+    0x1A0E156E, 0x13ED09BD, 0x1C780BDB, 0x03A616C9,
+    0x1F251F1E, 0x01020E53, 0x09E50827, 0x16C9020C,
+    0x0BFA039E, 0x0DB106CE, 0x1C2A0254, 0x19240B32,
+    0x05810AB0, 0x0CF80294, 0x1E530010, 0x008D1039
+  },
+
+  {
+    0x16980134, 0x100F0064, 0x100803B0, 0x15BD1425,
+    0x0F8C044E, 0x10BB1312, 0x158F0069, 0x14E509E8,
+    0x0AFC0D22, 0x00ED07BD, 0x18A00839, 0x0A1018A3,
+    0x0CFC0C2A, 0x14960FE6, 0x0C741FC3, 0x1A8601DF,
+    0x0D4701A2, 0x1C3A0202, 0x027A05C7, 0x01A60155
+  },
+
+  {
+    0x0D300665, 0x0F8702B5, 0x07530B01, 0x00AE17A2,
+    0x064A067B, 0x1EF01D7E, 0x198610F6, 0x04C00687,
+    0x143614D5, 0x00D81424, 0x197205F0, 0x0BF61F07,
+    0x0B9C1D1A, 0x0D620D00, 0x12FF149A, 0x0FF41A78,
+    0x06130BB8, 0x19930529, 0x065B0B6A, 0x004213AB
+  },
+
+  {
+    0x030F1DF3, 0x1A561ABE, 0x1C250C5C, 0x13AE0E9A,
+    0x17B71B9A, 0x036D0810, 0x02D51452, 0x15750BC0,
+    0x00570F92, 0x00C21545, 0x117809A8, 0x1A6C1B57,
+    0x1B0811AD, 0x16D41C77, 0x17670B92, 0x11480695,
+    0x090201EB, 0x1314037A, 0x0FBE11E8, 0x00E90B8A
+  },
+
+  {
+    0x12F81BCF, 0x004F01A4, 0x0CBF199C, 0x1E6B0F84,
+    0x02620F91, 0x0AC81D10, 0x05291776, 0x11651134,
+    0x1F71025A, 0x01E9045E, 0x0CBB07C2, 0x0AB41ADD,
+    0x04020FA7, 0x025A11BD, 0x03A71F78, 0x1BDD17F5,
+    0x08A00C7C, 0x1E381654, 0x0CC41380, 0x00DA0039
+  },
+
+  {
+    0x1D74023C, 0x0D8F00F5, 0x05901D1E, 0x0505086A,
+    0x12F50141, 0x0F1D05F3, 0x045C0B63, 0x03F41FEC,
+    0x03DC1597, 0x00390E44, 0x098B1866, 0x043A0294,
+    0x0E3A194D, 0x03D50CAE, 0x05D50394, 0x1BF41EE2,
+    0x15D11A8C, 0x01A31468, 0x12670B97, 0x00D600E5
+  },
+
+  {
+    0x1DBB0779, 0x01461C02, 0x1C7611A2, 0x1C2601A5,
+    0x00881CE0, 0x158008B1, 0x0A400974, 0x0B9601D6,
+    0x08DA0365, 0x016C117E, 0x166C12B0, 0x1EA707C4,
+    0x199C05BC, 0x06E709D5, 0x190917A9, 0x06D51A69,
+    0x0A301A2E, 0x0A611BAB, 0x0ED012CF, 0x01C30840
+  },
+
+  {
+    0x1C470860, 0x0D3A169B, 0x08DC0DB7, 0x059B0015,
+    0x152A0AA4, 0x1A720F06, 0x0E980477, 0x13EC075F,
+    0x09CD0744, 0x01C60815, 0x02B41ACF, 0x022919B8,
+    0x08651969, 0x1E6F13A1, 0x01FE043B, 0x0A45192B,
+    0x1AB71A7E, 0x19D00EDD, 0x1B6E1081, 0x01D90AE1
+  },
+
+  {
+    0x0A940B04, 0x1D7906B3, 0x12B41D5D, 0x17030DE1,
+    0x0B121F31, 0x1F480AD3, 0x18BC1679, 0x136114B4,
+    0x055D0EBC, 0x018F1771, 0x09E51C38, 0x123119ED,
+    0x0A870315, 0x1BB91349, 0x06AE0518, 0x0B541CCF,
+    0x1A3E0CBE, 0x02E318BB, 0x06F6028E, 0x01E60036
+  },
+
+  {
+    0x1D180F8D, 0x1D510ED4, 0x00E10EB7, 0x02A810C8,
+    0x0DBC048B, 0x0B6F0815, 0x13851AD6, 0x1E2C0BE5,
+    0x0F5C146E, 0x00101BD9, 0x10941E75, 0x0BA606D0,
+    0x0A121E77, 0x0EFC1204, 0x196E0D0B, 0x0CF31E6F,
+    0x175D04A6, 0x0F7C0EFD, 0x140F0338, 0x0165104D
+  },
+
+  {
+    0x0E4A1C8D, 0x180E1935, 0x0D011D65, 0x04221C87,
+    0x0F081F88, 0x12EC01E6, 0x0F66119B, 0x0A86053A,
+    0x16C2065E, 0x000D0E52, 0x1F5312E0, 0x0C9B17C6,
+    0x17701EE7, 0x1A360846, 0x11B2062B, 0x1E6D1ED3,
+    0x16BD0522, 0x0FE0010D, 0x1303052E, 0x01EE157D
+  },
+
+  {
+    0x19B41FE4, 0x05400EBC, 0x09311FBD, 0x059808A1,
+    0x04571298, 0x0A541321, 0x0A3902E3, 0x18AF0450,
+    0x06450BE7, 0x01670459, 0x0A420C63, 0x12601565,
+    0x006614E9, 0x01D804A8, 0x0EAD11D4, 0x1E1F09FA,
+    0x08BB1325, 0x15A20842, 0x176316F6, 0x010204AA
+  },
+
+  {
+    0x13B41094, 0x1AD815CB, 0x07DE051A, 0x11E502C8,
+    0x0A641063, 0x13730DA3, 0x0FDD0F58, 0x1EE70795,
+    0x1E0B1405, 0x00630ED3, 0x0378057E, 0x0AE8185A,
+    0x156F1AA1, 0x16A90B85, 0x19D810A8, 0x0EC017C6,
+    0x14C11B10, 0x0726030F, 0x10440D41, 0x01C70C4F
+  },
+
+  {
+    0x117E0ED0, 0x0D5213A9, 0x061F0616, 0x11160C81,
+    0x1756083D, 0x01790F22, 0x105B1DC8, 0x1F5300C3,
+    0x0A4E05EF, 0x005C0123, 0x02A209F2, 0x16821806,
+    0x099E0328, 0x1DE4044D, 0x166E152B, 0x02E60BF2,
+    0x09591455, 0x0D59152F, 0x0EC21883, 0x003A07E2
+  },
+
+  {
+    0x16CA02A8, 0x06EC1228, 0x1F280858, 0x07F408AA,
+    0x042700FA, 0x1F121C4C, 0x195417B3, 0x0305116E,
+    0x1E360763, 0x00D71EC1, 0x0B430C8F, 0x112B11AC,
+    0x185A0605, 0x0D8A09E7, 0x0B001432, 0x00A31128,
+    0x13A81417, 0x0A0409DB, 0x11B013F2, 0x01CD0722
+  },
+
+  {
+    0x14F417A1, 0x1ADA0C22, 0x0B860EC0, 0x0C1B1CC3,
+    0x1B1A1137, 0x06D10DE8, 0x06291217, 0x09F81CA1,
+    0x1F320809, 0x011D0208, 0x063D0F80, 0x1B0D0FBD,
+    0x0CDE1A5C, 0x015411DE, 0x0B3C1420, 0x00420209,
+    0x0FFD0668, 0x146D0B77, 0x1836043B, 0x0107146B
+  },
+
+  {
+    0x00291678, 0x17C90C06, 0x1BC3098B, 0x021E109B,
+    0x1E59097C, 0x11D407BC, 0x020F1A23, 0x08040AD6,
+    0x05A20BB3, 0x015806DB, 0x10C70123, 0x13E107D1,
+    0x18C91605, 0x125419AF, 0x0B121751, 0x15ED15D7,
+    0x14E71799, 0x0CDF0F14, 0x0F681A4B, 0x01950E06
+  },
+
+  {
+    0x06540BF0, 0x18631ABC, 0x17681741, 0x1D8C0BFD,
+    0x1F0E197D, 0x18F71583, 0x01961222, 0x08C51E92,
+    0x10CA152A, 0x00A8068D, 0x1DBA084C, 0x0F580D36,
+    0x123C1444, 0x074C18AE, 0x10D901FD, 0x15C009F4,
+    0x16291C2C, 0x04CD0A40, 0x04C516C3, 0x00900CF5
+  },
+
+  {
+    0x0D0D11D6, 0x11160B87, 0x0F3E0CBD, 0x097809EC,
+    0x0BDC07D2, 0x187602C7, 0x1BA11980, 0x0EE604F5,
+    0x0057186A, 0x00D20434, 0x0C5210AC, 0x05810F37,
+    0x1C590AB2, 0x02301B56, 0x0D381116, 0x19F6110B,
+    0x070B0B2C, 0x14EE0A66, 0x11E01F29, 0x008B191A
+  },
+
+  {
+    0x16241B3C, 0x0DB31F4B, 0x1BAB0685, 0x16E20467,
+    0x149D1E0E, 0x1BF31BCC, 0x19790A26, 0x1E021F5A,
+    0x1CCD1A03, 0x008E0ABB, 0x097F0EAC, 0x0D2D01A6,
+    0x062A0F94, 0x111B14B7, 0x1EBF0919, 0x1E880FD9,
+    0x0A861B95, 0x0C620713, 0x1C640BD3, 0x004B0279
+  },
+
+  {
+    0x08B51CB7, 0x1048034B, 0x037817A5, 0x186E0D50,
+    0x00F4119F, 0x0DE80B6A, 0x1CFC0FE6, 0x17BB069F,
+    0x19341A32, 0x01170E77, 0x172B101E, 0x1D660B8B,
+    0x1532166C, 0x1F8719B4, 0x10581C63, 0x10820452,
+    0x0D5F17BA, 0x018C0E46, 0x190205B2, 0x003F1058
+  },
+
+  {
+    0x09510401, 0x1A9A048A, 0x1D7C1E1C, 0x0DEC05E5,
+    0x018B0F7E, 0x1C401E17, 0x11210AB9, 0x0B8A0149,
+    0x00971D70, 0x006D18F5, 0x15A319E2, 0x013208C4,
+    0x11F01B73, 0x12FE0939, 0x08110F73, 0x065E1ADE,
+    0x12CD1DC7, 0x0C9A014B, 0x14C712D1, 0x019B1DE0
+  },
+
+  {
+    0x056E081C, 0x0413001C, 0x12C21D1D, 0x14F21829,
+    0x164512DD, 0x1CF61370, 0x0C1E0832, 0x09910374,
+    0x027D0466, 0x01EC1585, 0x14C9042B, 0x1B1B0193,
+    0x0EA3066D, 0x13AF0383, 0x1CE41DEE, 0x0CEC001C,
+    0x13CA0366, 0x071918B2, 0x05C100D6, 0x01D21F8E
+  },
+
+  {
+    0x02871D77, 0x0B75151D, 0x138A03E6, 0x113E0D2B,
+    0x1AAC0FD9, 0x1B0D1920, 0x0C4909F6, 0x1A420791,
+    0x0AE1161E, 0x00800F86, 0x0C160B9D, 0x01E11E7E,
+    0x1B811BEE, 0x171707CE, 0x19880626, 0x07E30C55,
+    0x062F0825, 0x112510DA, 0x17650863, 0x006A1C89
+  },
+
+  {
+    0x17D8151A, 0x061803B1, 0x1CDB177D, 0x09121C6A,
+    0x1A241F5E, 0x107A08B8, 0x1A42005E, 0x144E1731,
+    0x1BCD124C, 0x012218AC, 0x18CF1D36, 0x0E620E52,
+    0x15001D22, 0x16D716A0, 0x10380CC4, 0x12E81EDF,
+    0x0FF519AC, 0x1238019A, 0x0B3D0B9F, 0x00E40E9A
+  },
+
+  {
+    0x080108E3, 0x062C0873, 0x045A19B7, 0x1C34158D,
+    0x0FB8077D, 0x12C40508, 0x1BAA01D9, 0x0CFA0D4F,
+    0x0B39117B, 0x0020034C, 0x1C8912D2, 0x096D0DFD,
+    0x077D1E2A, 0x09531FD3, 0x1D260BA2, 0x19BE18B0,
+    0x02E20507, 0x1D4915BD, 0x133A01BE, 0x005E0320
+  },
+
+  {
+    0x19E71553, 0x19F01F6C, 0x013E0AE2, 0x1B541AD3,
+    0x06280CAD, 0x12BC037B, 0x1A5C087E, 0x19D81F14,
+    0x0ABD1D82, 0x014401D0, 0x123D17FA, 0x12DA0938,
+    0x05970F3C, 0x0C9F15F7, 0x143F14FB, 0x1A501BB0,
+    0x1D1D03E7, 0x032B0CFE, 0x0F9411A9, 0x005409E3
+  },
+
+  {
+    0x1B571E4C, 0x1E420E90, 0x12B314C6, 0x008B00AA,
+    0x0EE01E42, 0x09190F85, 0x0D931922, 0x0F941ED3,
+    0x00ED0231, 0x007A03B9, 0x1C510278, 0x1F8204D3,
+    0x102C1E97, 0x184C0957, 0x0F7E07B9, 0x00540704,
+    0x068B1685, 0x09CC040A, 0x1F0D06F9, 0x00761D89
+  },
+
+  {
+    0x192E1403, 0x06810A26, 0x19B706AC, 0x1EC011CB,
+    0x07210FCE, 0x19F51A81, 0x031B1CDD, 0x02E30A9C,
+    0x14BB1912, 0x014601FF, 0x1E69196F, 0x0EB41CCB,
+    0x0CBC1B99, 0x0CF50406, 0x143A1E16, 0x1CE61AA4,
+    0x14241940, 0x113F09EF, 0x089C06C9, 0x01AB0B20
+  },
+
+  {
+    0x126B1506, 0x008D1189, 0x023D079C, 0x16AD1948,
+    0x14551146, 0x07090FFE, 0x1C801579, 0x1CC40534,
+    0x10FB1251, 0x01381520, 0x19291875, 0x031F16B8,
+    0x0CB41CF1, 0x0F010E0D, 0x04B81591, 0x0FE10F93,
+    0x13430D3C, 0x0F7213E8, 0x10CE18C5, 0x010C1E30
+  },
+
+  {
+    0x0EF30E6F, 0x15CB132A, 0x00151E94, 0x061C00B0,
+    0x154009C5, 0x017E033D, 0x109D085D, 0x00AD0BE1,
+    0x1D0209B5, 0x000F0EEC, 0x06060289, 0x10971707,
+    0x124A02F3, 0x15AA05DD, 0x0F831E08, 0x0F3803D4,
+    0x025A1989, 0x120E1A15, 0x0120122D, 0x00401010
+  },
+
+  {
+    0x08081809, 0x1D820F29, 0x09671529, 0x09571C01,
+    0x0130056B, 0x00D10443, 0x18E60AAA, 0x17661E03,
+    0x10DA18EF, 0x011F0F33, 0x0D900C19, 0x1E1D0D7C,
+    0x1C080BFD, 0x10260370, 0x0BC205FD, 0x099E17E8,
+    0x1A3015C5, 0x1C22100B, 0x0B19159A, 0x01330E14
+  },
+
+  {
+    0x181E09A3, 0x1DE41F7C, 0x07301D32, 0x07BA1D49,
+    0x03D011C2, 0x183D0612, 0x01670C26, 0x07F61178,
+    0x08FB0045, 0x01A00C8A, 0x1B1306D9, 0x05BC1562,
+    0x078701BE, 0x046B14AF, 0x01B71BE4, 0x0F321DB5,
+    0x0107129A, 0x010103DA, 0x0CF716E3, 0x013D1684
+  }
+};
+
+#elif BR_P256_COMB == 8
+
+static const uint32_t Gcomb[255][20] =
+{
+
+  {
+    0x04C60296, 0x02721176, 0x19D00F4A, 0x102517AC,
+    0x13B8037D, 0x0748103C, 0x1E730E56, 0x08481FE2,
+    0x0F97012C, 0x00D605F4, 0x1DFA11F5, 0x0C801A0D,
+    0x0F670CBB, 0x0AED0CC5, 0x115E0E33, 0x181F0785,
+    0x13F514A7, 0x0FF30E3B, 0x17171E1A, 0x009F18D0
+  },
+
+  {
+    0x02D21943, 0x153C0886, 0x0FDB03A5, 0x06CB1197,
+    0x10D51919, 0x0C581C76, 0x12B51322, 0x15F10485,
+    0x1A050F22, 0x00FF18DA, 0x0CE50101, 0x1A2A0B1A,
+    0x19090D50, 0x10CF0E2B, 0x0BA513D5, 0x0FB909BC,
+    0x04FA0040, 0x06C4127C, 0x02C105B6, 0x01CD05F5
+  },
+
+  {
+    0x080F06E4, 0x18A31FE0, 0x1D61016F, 0x1C9F1330,
+    0x1C180895, 0x154E0D63, 0x02A40C24, 0x18050982,
+    0x01100CED, 0x01C615E6, 0x161C12C3, 0x05730614,
+    0x13771AAD, 0x1DB8148F, 0x0F82170B, 0x0D140CA6,
+    0x12591967, 0x074517CF, 0x04701F43, 0x00E003E5
+  },
+
+  {
+    0x10A61B63, 0x0EB90D23, 0x0FBF090E, 0x15551594,
+    0x114A093B, 0x04DC0977, 0x092C12E3, 0x15541612,
+    0x15E10811, 0x001F0A08, 0x1A310EE7, 0x02481517,
+    0x017A1E41, 0x0A0A03FA, 0x19A511A6, 0x07BE0622,
+    0x056A0BCB, 0x150115BD, 0x174715DB, 0x017F1D12
+  },
+
+  {
+    0x0BCC12AF, 0x12391882, 0x18FD0933, 0x1FA114D7,
+    0x0F4B0C98, 0x0BC009E2, 0x0BE00DE9, 0x0E4D1EC9,
+    0x1DE409D6, 0x00600292, 0x040907A0, 0x09450470,
+    0x03521AA5, 0x15B50760, 0x1ADD11EE, 0x1E3C0F1B,
+    0x0EED125F, 0x08C811FC, 0x1F06109B, 0x00E50AB1
+  },
+
+  {
+    0x120119A0, 0x04C11E3B, 0x02B81D6E, 0x066D1089,
+    0x170613EB, 0x10141F6A, 0x056913B6, 0x094C0AA7,
+    0x1493006A, 0x002912D5, 0x0C1D1C01, 0x07A60567,
+    0x093E0FE9, 0x11B000E6, 0x1A9005EF, 0x12F5068E,
+    0x02431ED9, 0x08CC0E1E, 0x07D11E1E, 0x00A60263
+  },
+
+  {
+    0x0A28111E, 0x0D190DB6, 0x16A10303, 0x0FDE1712,
+    0x0AC21A13, 0x1FD405F0, 0x16240C5F, 0x02C10308,
+    0x1084158F, 0x014B0AE7, 0x02DA0ED9, 0x148F0E1E,
+    0x07BB1C34, 0x03890684, 0x02370D77, 0x1A0C123D,
+    0x0F0B1EBA, 0x1413098A, 0x108C0B1A, 0x01A71AF1
+  },
+
+  {
+    0x0891018E, 0x15520E5D, 0x00A01A84, 0x160E1328,
+    0x174D0521, 0x11451A40, 0x040513A1, 0x0EF4195E,
+    0x033012A6, 0x009416D4, 0x02791840, 0x15B41E93,
+    0x16CE10BE, 0x0A830789, 0x03130DB1, 0x02C41F50,
+    0x13020FBE, 0x113E0710, 0x10E70AC0, 0x01D604D1
+  },
+
+  {
+    0x00241786, 0x03831FB3, 0x00961C76, 0x10EB1A63,
+    0x1A4719C1, 0x1A41037E, 0x08D00A5F, 0x04321C03,
+    0x06F50064, 0x0083035A, 0x0DA80759, 0x1DDE1554,
+    0x15680481, 0x0A1805B2, 0x00BA029C, 0x1DF114C8,
+    0x0B1C1622, 0x0DBA110D, 0x17B505BA, 0x00BA1EC9
+  },
+
+  {
+    0x1D211281, 0x15DA0249, 0x165E0F9F, 0x0288040F,
+    0x1AF212C4, 0x102B1215, 0x014B07AA, 0x04410B0D,
+    0x01481C6A, 0x000F006E, 0x162A1F80, 0x068713BA,
+    0x02F115A8, 0x1DDC1528, 0x0447180E, 0x0522190D,
+    0x195014F1, 0x02B20E5E, 0x146F1015, 0x00D20337
+  },
+
+  {
+    0x1C711820, 0x180112B8, 0x0DF60C52, 0x14DB1558,
+    0x14161789, 0x08C81FAF, 0x107F0527, 0x1A9F0D52,
+    0x176507B5, 0x00AF1D8B, 0x07C01460, 0x00EB0752,
+    0x16E70AA6, 0x129D10D5, 0x00691005, 0x1FD503D2,
+    0x14E0067E, 0x1C551583, 0x05FC09BF, 0x00BC17FE
+  },
+
+  {
+    0x119409D5, 0x01AF0C3E, 0x021C1592, 0x1B250265,
+    0x1AA615DA, 0x0F9509D1, 0x01AE1262, 0x1087109C,
+    0x0EA408E9, 0x01231208, 0x15450566, 0x01BD0B66,
+    0x15D61E13, 0x1D401023, 0x03DB1DF6, 0x0927036B,
+    0x0D6E0373, 0x13E81246, 0x063C0F87, 0x01B61EBB
+  },
+
+  {
+    0x17D706D7, 0x133D19F1, 0x1C970BC4, 0x0D8F1871,
+    0x0F6E1F9C, 0x17EE030D, 0x037A1415, 0x05B00727,
+    0x1EDC1042, 0x000D1C2B, 0x0DE3147A, 0x1E151413,
+    0x130B1214, 0x03551DEB, 0x120D07CF, 0x1BCC1191,
+    0x15C4155D, 0x009811EE, 0x07B91F98, 0x00EF1E7A
+  },
+
+  {
+    0x0B4800D8, 0x034E1972, 0x04B215D0, 0x1EEB193B,
+    0x1F83098F, 0x19BE1959, 0x0296144B, 0x0D800A48,
+    0x1C161653, 0x017801EE, 0x1BB10C71, 0x0B1913E0,
+    0x1D3915FE, 0x01D80B9E, 0x131A1F21, 0x0F630687,
+    0x1DF909FC, 0x12050A85, 0x1CE01D90, 0x01D60597
+  },
+
+  {
+    0x10AC1928, 0x0E56117C, 0x020F0AF9, 0x19081D83,
+    0x1EC30848, 0x168F055E, 0x0C211F16, 0x148D109A,
+    0x15110086, 0x01C0062A, 0x0B4C0420, 0x006608A6,
+    0x1DDC121A, 0x16691FB5, 0x1E9B0D88, 0x141B0F20,
+    0x1F44063B, 0x1DCA03CB, 0x0D831F10, 0x00700FD3
+  },
+
+  {
+    0x1C4D1D85, 0x109F1275, 0x1561157C, 0x0FB80A5F,
+    0x17E115FF, 0x118C1D9B, 0x0C171D58, 0x0BCC1FEE,
+    0x1CDF0EDB, 0x00881F5C, 0x17121B32, 0x1C67125C,
+    0x128000C7, 0x12B41FEB, 0x19E9149B, 0x14950BFD,
+    0x174E1953, 0x063D1B84, 0x0D5C0341, 0x005A1209
+  },
+
+  {
+    0x10E9167F, 0x093904CA, 0x08DB1139, 0x05630828,
+    0x077B1FBD, 0x123B1F18, 0x030308BB, 0x0E5F1F77,
+    0x09940A9C, 0x01DF0546, 0x1BB618A8, 0x006B09DC,
+    0x0BA00196, 0x01121728, 0x0118183B, 0x04580867,
+    0x174C0070, 0x05930F07, 0x1E1B1DBB, 0x00C207A7
+  },
+
+  {
+    0x17A20892, 0x14071842, 0x1F8F09DD, 0x033F1E9D,
+    0x16EB18A2, 0x15DC1B2E, 0x152312A8, 0x150A199E,
+    0x0A150822, 0x01C80B0C, 0x106D1957, 0x068D1FBC,
+    0x19B21BEE, 0x10DA003D, 0x15EA0641, 0x065813E3,
+    0x1BA70510, 0x102F0885, 0x06860011, 0x0115140D
+  },
+
+  {
+    0x0A581A05, 0x0D241DB6, 0x121801F9, 0x0A9517E7,
+    0x1E541B11, 0x16791DFE, 0x186F0364, 0x02250E24,
+    0x05DD19A7, 0x009D18A6, 0x15D01C4A, 0x0A3E1672,
+    0x14B10C75, 0x109F0E5C, 0x03CD086B, 0x071418A3,
+    0x1E450C6B, 0x0D491391, 0x19C2063A, 0x00590EFC
+  },
+
+  {
+    0x1ABF14BC, 0x05630482, 0x1E1B0CAE, 0x0BD81B26,
+    0x194916DF, 0x02240E2F, 0x1532082E, 0x1EBB01F7,
+    0x1BCB1B51, 0x00AA0198, 0x0454164C, 0x1FC4058D,
+    0x1DF0144F, 0x0EDB0F7B, 0x0CFD13D5, 0x1B3A1439,
+    0x1D200018, 0x170A042B, 0x04240AEC, 0x002A1C59
+  },
+
+  {
+    0x02E61E01, 0x1D951FFF, 0x0F930E48, 0x1CE115C5,
+    0x0BE60D84, 0x087C10E4, 0x147A083F, 0x083D0A8B,
+    0x1A2D1211, 0x01D6175D, 0x18D11479, 0x122F189C,
+    0x1B221CAC, 0x1FC50112, 0x142F122C, 0x10001B3B,
+    0x08730A15, 0x182F0C26, 0x175E1BEC, 0x01D51F5C
+  },
+
+  {
+    0x1EEF009F, 0x0B4B0AE9, 0x129109F9, 0x0E64086A,
+    0x160F0708, 0x049502C2, 0x1A1A13A7, 0x13BF18DD,
+    0x19FF10FE, 0x017210AC, 0x07E31653, 0x003510CD,
+    0x15130E96, 0x10180AFA, 0x0D711E08, 0x1F561AB9,
+    0x02970034, 0x0A3D1F5B, 0x139D061E, 0x00170424
+  },
+
+  {
+    0x13C00592, 0x144B0D46, 0x099B191B, 0x0E821403,
+    0x077219A5, 0x0511191D, 0x178E0449, 0x0DAC178D,
+    0x1666185F, 0x01A71A26, 0x04381D87, 0x0B211B36,
+    0x1A3D00F5, 0x19520B8B, 0x1AB21C81, 0x083F0C01,
+    0x0A111078, 0x022C0D56, 0x1A0505DC, 0x01491C4A
+  },
+
+  {
+    0x18DE1072, 0x15B31051, 0x19BA1298, 0x167E1B52,
+    0x0D9406A3, 0x14BF02AF, 0x05E908CD, 0x152D02DB,
+    0x0583100B, 0x00A50770, 0x1462014A, 0x0E5218EA,
+    0x04ED0446, 0x139710C2, 0x14CB085E, 0x1C731F39,
+    0x1A641831, 0x18D41E6A, 0x163E049B, 0x01361509
+  },
+
+  {
+    0x18611E88, 0x06DF1F2A, 0x01E901FE, 0x10D70A0C,
+    0x161513B3, 0x1B8E15F2, 0x155F16EA, 0x0E020DCA,
+    0x17EA1EEC, 0x0024102D, 0x149810A3, 0x06110A06,
+    0x14190106, 0x1105104D, 0x1DCF14AB, 0x087911A3,
+    0x1240000F, 0x0E1B0522, 0x1539014B, 0x01CA13C5
+  },
+
+  {
+    0x1F7006C8, 0x0BCB1203, 0x1F9C1D9D, 0x02E80744,
+    0x1C5F1298, 0x1B540AD7, 0x12DF181F, 0x11771DFC,
+    0x02E21EC6, 0x00141C3E, 0x0F261954, 0x1F9208B5,
+    0x0D9E1F2C, 0x0A300D08, 0x1AEA0040, 0x014518CB,
+    0x1F0105C2, 0x1E4704E0, 0x0ACC048E, 0x00C608A3
+  },
+
+  {
+    0x17FE0EF3, 0x0FA601D4, 0x051F0BAF, 0x03131BB2,
+    0x1A35157E, 0x0FD40EF6, 0x148E171F, 0x0D5E1DDE,
+    0x0BA90BC7, 0x00EE07D1, 0x072E08B5, 0x1168093F,
+    0x0FC71D91, 0x0A2A0F7D, 0x077B0A28, 0x0C2B09B4,
+    0x1ADA0342, 0x034D1B0D, 0x0A4A0216, 0x00651904
+  },
+
+  {
+    0x0A1F133F, 0x0D171055, 0x14310FA2, 0x1ECF0687,
+    0x082B1848, 0x0EF11175, 0x064F080E, 0x1F6B10AB,
+    0x19081F24, 0x010313D9, 0x1CA51CE2, 0x0ADC0D43,
+    0x1DBF0876, 0x19130146, 0x1CB210C9, 0x05D01714,
+    0x00CA14D9, 0x14E30835, 0x02D205B0, 0x01DE1541
+  },
+
+  {
+    0x1787109E, 0x1ACA0767, 0x06E31EA5, 0x12990B5D,
+    0x117F06A9, 0x000708DF, 0x02251758, 0x06AF0A9B,
+    0x038C0579, 0x01B61495, 0x168710B1, 0x054718CB,
+    0x0B231873, 0x0AB602ED, 0x1DF1007A, 0x05A91B3A,
+    0x1AFE1E23, 0x15A7190C, 0x131B12C4, 0x01230D9F
+  },
+
+  {
+    0x180C0C7E, 0x1B96036A, 0x17030CDE, 0x10551633,
+    0x07941E7E, 0x082F0D85, 0x11AA1B7C, 0x1EFD0DF3,
+    0x02D718BF, 0x019A0805, 0x0A2B1EB3, 0x0D4400B9,
+    0x0FCC0AEC, 0x12AE1516, 0x177C134B, 0x001E1577,
+    0x03AE1F1C, 0x01810441, 0x18AE0B51, 0x01A81867
+  },
+
+  {
+    0x095C1A0E, 0x0ABF1105, 0x03AE17FF, 0x039011CE,
+    0x11FB08C7, 0x0F0C0955, 0x159F1505, 0x098D1B94,
+    0x085417B1, 0x01C7176C, 0x06DD09F2, 0x0B0A1D1A,
+    0x0F431367, 0x1BBA09A7, 0x168E14F5, 0x038717BC,
+    0x1C941174, 0x0C2E1D5C, 0x0DFB1283, 0x01A70C3C
+  },
+
+  {
+    0x1FC10F2A, 0x138E177D, 0x1A1D0AEE, 0x10E90BF7,
+    0x14F20C35, 0x0E6E04C9, 0x11161F43, 0x06C21FD5,
+    0x1AB30EC7, 0x011414D7, 0x118414B7, 0x13410B08,
+    0x1B341C5F, 0x10C91231, 0x1E6F0533, 0x10B504AF,
+    0x10140190, 0x117A1CDF, 0x042308B0, 0x00081570
+  },
+
+  {
+    0x1A720457, 0x0932020D, 0x1B8119BF, 0x096B1BB2,
+    0x0A051F98, 0x11E31DBC, 0x17CC17E6, 0x0B41126D,
+    0x18241D56, 0x008F0D52, 0x0C800111, 0x060310DA,
+    0x045D1241, 0x146E1DBD, 0x0A710A6E, 0x1FD60730,
+    0x1B470750, 0x14FB1DDC, 0x114815A4, 0x01CF0BFA
+  },
+
+  {
+    0x03BD15D9, 0x14DC0B25, 0x022200C0, 0x0C501DB7,
+    0x0FCD04BF, 0x0D9B109E, 0x0854149B, 0x104E1941,
+    0x13D5177F, 0x000D0EB6, 0x12461AC9, 0x095D147A,
+    0x03871C8B, 0x096F1A84, 0x06F51D8A, 0x06CD1ADC,
+    0x1EA41101, 0x16310909, 0x0FE80E6C, 0x00B611DB
+  },
+
+  {
+    0x0B0E1446, 0x041F0E36, 0x02EB1032, 0x1C80189B,
+    0x00BB0324, 0x04480973, 0x1D970BC7, 0x191F0350,
+    0x1A7406DB, 0x00531589, 0x046B13DB, 0x10B41130,
+    0x0F521581, 0x17FC048E, 0x0CE40C1C, 0x158C11CC,
+    0x0E7F087B, 0x0D2900AC, 0x03950581, 0x00D805AD
+  },
+
+  {
+    0x1D401FFB, 0x0A790C48, 0x0F900E27, 0x14B700AA,
+    0x1111078F, 0x013812F8, 0x0193145F, 0x1FA40D2C,
+    0x01B0059F, 0x00BE1A32, 0x0DFC0F8D, 0x15C61A47,
+    0x06B30BF3, 0x059F07EE, 0x1D951155, 0x092414D9,
+    0x025F1B33, 0x135E1C32, 0x0BF41E10, 0x000C0E79
+  },
+
+  {
+    0x10620684, 0x03101171, 0x10CF0D82, 0x08E10166,
+    0x13350664, 0x1DAD17F2, 0x0C4911E3, 0x00C10678,
+    0x1F330FEA, 0x007616C0, 0x0EBF0DBB, 0x18330D6A,
+    0x1C3B1D8B, 0x024C111D, 0x1CAF1FD1, 0x06B90098,
+    0x08E5007F, 0x09BB10B3, 0x064118E1, 0x00ED1C78
+  },
+
+  {
+    0x08E81A41, 0x04200DD8, 0x131F1A3D, 0x14290C45,
+    0x13151730, 0x1BE11C8B, 0x1ECF1A2E, 0x1D4B0A7A,
+    0x19B60B79, 0x00580688, 0x029D1363, 0x16AC1D6B,
+    0x1BFF0294, 0x17CE0A72, 0x09610988, 0x0B0F10BA,
+    0x122A0FFB, 0x065C1C51, 0x1B801DFC, 0x005C0711
+  },
+
+  {
+    0x1A141E4D, 0x04CB0319, 0x1A8F0872, 0x15401587,
+    0x15F41522, 0x13AB07D1, 0x1110057D, 0x0D3408F5,
+    0x1A3409EF, 0x00ED1A5A, 0x1CBF1AED, 0x140C142D,
+    0x04C9116A, 0x044217FE, 0x03AD178E, 0x0FF31EE2,
+    0x1AE00CB2, 0x1C630455, 0x0ACF1705, 0x019E0862
+  },
+
+  {
+    0x1C61140A, 0x187C1109, 0x179D17C5, 0x0D020B59,
+    0x026A1460, 0x1C471176, 0x13A81B1A, 0x192100A6,
+    0x12740A2E, 0x007C0A61, 0x16DD1850, 0x1A541989,
+    0x0BC00142, 0x188E196F, 0x0D681744, 0x0645147B,
+    0x0A87068E, 0x03CF187C, 0x07511DC3, 0x004706E4
+  },
+
+  {
+    0x1B0B1F0E, 0x0BB90721, 0x0A251CF1, 0x1DCD0163,
+    0x142D140D, 0x04280877, 0x164F04B1, 0x0B8B0AA5,
+    0x19D005D4, 0x003207AC, 0x0CE7143B, 0x02DC0406,
+    0x17010C9C, 0x0F6503B9, 0x1F9205C5, 0x0BD21953,
+    0x15C00DD4, 0x105407CF, 0x0FFA1922, 0x011504D9
+  },
+
+  {
+    0x1299122A, 0x082C149E, 0x17C7078C, 0x0CE105DD,
+    0x01821DDE, 0x110C0BB5, 0x055B159F, 0x05FE1F6F,
+    0x0ECA09F7, 0x010403D3, 0x1AEF0BD4, 0x0A89098A,
+    0x066206CC, 0x126F0D3A, 0x1BAD1E5D, 0x02B80534,
+    0x040D11B2, 0x00BD106D, 0x1763183A, 0x00280101
+  },
+
+  {
+    0x10711190, 0x0CBE141F, 0x080D044F, 0x05FD08FD,
+    0x009B10D1, 0x18CC056C, 0x11AF19A8, 0x03811EE1,
+    0x007D13CD, 0x01FE0A77, 0x1C0814F6, 0x1142175C,
+    0x1171107F, 0x157D1B31, 0x10A61EF0, 0x137119AD,
+    0x0EB21950, 0x14840893, 0x0F991439, 0x01880E0C
+  },
+
+  {
+    0x1A801899, 0x127917E4, 0x11721422, 0x01831307,
+    0x1F3F1039, 0x17E50094, 0x17B912AC, 0x0D6F0787,
+    0x0F981F2B, 0x01C407C5, 0x1113019A, 0x01F21F35,
+    0x0D040CFC, 0x128E09AD, 0x1E0216B4, 0x1A491BA5,
+    0x04A60B14, 0x05A810E3, 0x11E51C05, 0x00940FF0
+  },
+
+  {
+    0x06AA0267, 0x126B1DD8, 0x166A1A30, 0x174C14BD,
+    0x0AE21093, 0x170A136A, 0x10681960, 0x1B0D121C,
+    0x18310C10, 0x01E61875, 0x11DC19E4, 0x147A09DC,
+    0x00640D11, 0x09651DF5, 0x0C5018CE, 0x07A6145B,
+    0x1ED90FAC, 0x079F0D12, 0x0DDB0B18, 0x00590643
+  },
+
+  {
+    0x12400CA6, 0x007E1325, 0x05C30ED3, 0x0B391880,
+    0x1F161BE5, 0x19D70568, 0x18270324, 0x0391161D,
+    0x151101CD, 0x00B30476, 0x0E020EE0, 0x097B0B5D,
+    0x1B2C120A, 0x0FBA0EAC, 0x04FF05ED, 0x1BA809FA,
+    0x1DA51EA1, 0x0863083B, 0x04B40CE1, 0x01BC1756
+  },
+
+  {
+    0x091A02B3, 0x03B30269, 0x18CA0AF3, 0x169800FA,
+    0x0C8C0E1F, 0x16D90DEE, 0x1F1A1F06, 0x151808C0,
+    0x09270062, 0x00671FBD, 0x09721BC0, 0x149F0F94,
+    0x163A0692, 0x01BE1458, 0x10331CFB, 0x010B06F4,
+    0x0D6B0FF2, 0x17A91946, 0x0556184D, 0x001416D3
+  },
+
+  {
+    0x1DBF112D, 0x06C802FE, 0x01F91419, 0x10BB1F5B,
+    0x077C0BF2, 0x020E0A6B, 0x1F3A0420, 0x099B048F,
+    0x0AD10C21, 0x01FE097D, 0x18780FC8, 0x17E8047C,
+    0x15BA0D77, 0x18E50AE0, 0x18D008EB, 0x094B035D,
+    0x00AD1A77, 0x0A200003, 0x069C0A40, 0x01291C45
+  },
+
+  {
+    0x05310B2C, 0x00F50DF4, 0x140C11FD, 0x0AD31DDD,
+    0x198E06F0, 0x1DB80344, 0x021D1938, 0x08D41B81,
+    0x0A7303AE, 0x00370756, 0x0A2213E5, 0x06B11F30,
+    0x15A815AB, 0x07730962, 0x1FDA1286, 0x02D00F3B,
+    0x1D590110, 0x191C051C, 0x12A70D96, 0x01DA05AE
+  },
+
+  {
+    0x0DD1169A, 0x02ED074A, 0x11311264, 0x05F91648,
+    0x0F241861, 0x11311AB6, 0x0DC704C1, 0x1EC20218,
+    0x1EA415BA, 0x01870522, 0x1F920345, 0x134F06CF,
+    0x1ED40B52, 0x09571828, 0x1D151862, 0x08E80DC5,
+    0x0DBF1809, 0x0F6C04BD, 0x0D39018A, 0x017D04AB
+  },
+
+  {
+    0x0CA11A71, 0x0EE81C3F, 0x09F01EF9, 0x0A5D1CB6,
+    0x196D1FBC, 0x057004A9, 0x11051476, 0x09680FEF,
+    0x0AB91EF4, 0x0142151D, 0x0DE018D0, 0x00D112E2,
+    0x05390F18, 0x0C761F90, 0x1E831021, 0x05DF0BD3,
+    0x08AD0D49, 0x11480ED4, 0x113C0C4B, 0x00701355
+  },
+
+  {
+    0x0583155E, 0x0B040470, 0x0791180D, 0x0DB6132B,
+    0x0E51074A, 0x19E406DA, 0x10F81B4E, 0x166302B8,
+    0x00C803B2, 0x011B013D, 0x1882018F, 0x11F10527,
+    0x11500C51, 0x1BFB045D, 0x06391B5F, 0x184D1044,
+    0x07651F6E, 0x1FAC0B26, 0x1E830953, 0x002B0F35
+  },
+
+  {
+    0x10A217FE, 0x0FB60201, 0x0ACA1C87, 0x1118191C,
+    0x0B070B5C, 0x011D103B, 0x070F0418, 0x08C5080F,
+    0x192F027F, 0x00940050, 0x07DD04FC, 0x03431369,
+    0x01E31796, 0x1D6C189D, 0x09030D4B, 0x039B09E4,
+    0x18931144, 0x0377051F, 0x1F010F38, 0x01601A7D
+  },
+
+  {
+    0x1C3E1EA8, 0x1E901672, 0x11BA06E6, 0x0CC70551,
+    0x1A3C07EC, 0x02430E5D, 0x1F931B36, 0x10550C72,
+    0x08AA04E1, 0x01941FBA, 0x1CC21B5B, 0x1AAC1B5F,
+    0x0DCD040B, 0x134D157F, 0x1A110533, 0x1F9110A8,
+    0x08121842, 0x09471533, 0x00B310F1, 0x001A1300
+  },
+
+  {
+    0x1B6C0676, 0x13491326, 0x0ADC19A8, 0x08F514C1,
+    0x165F0462, 0x169E1AA4, 0x06451106, 0x11E11E2A,
+    0x1D3A170E, 0x01B2198C, 0x05820CC1, 0x1B4D1A3A,
+    0x05390D1F, 0x1CC802E9, 0x010A1D4C, 0x0C980CD6,
+    0x0999070F, 0x173F175D, 0x0F541825, 0x009A0513
+  },
+
+  {
+    0x17EE0380, 0x155E0759, 0x041B0A3B, 0x07A91343,
+    0x08D808F7, 0x1ACF1FD2, 0x1FCF1BA9, 0x0C9D1158,
+    0x05421AF8, 0x002A1DEB, 0x005B1B43, 0x15181F83,
+    0x16050E61, 0x16B50397, 0x166D1E96, 0x1C3B0494,
+    0x03090058, 0x0BDF038C, 0x0648138E, 0x00F00A1B
+  },
+
+  {
+    0x09DE0BF0, 0x06C91109, 0x08C000F8, 0x18E00EEE,
+    0x1F930390, 0x1A3C0EEC, 0x1E661A4A, 0x1A3D0D3A,
+    0x0D1C05A5, 0x01610324, 0x121A075C, 0x1922162D,
+    0x080D160D, 0x1AC50E80, 0x01CD1D97, 0x0A051EF8,
+    0x094E196C, 0x14E711BF, 0x06091158, 0x01711F88
+  },
+
+  {
+    0x00830368, 0x1BBE0EF8, 0x15B40FC0, 0x14B20FD4,
+    0x069E072B, 0x10F01E49, 0x15EF185A, 0x113A0DF1,
+    0x12521321, 0x012C1171, 0x12710771, 0x079906E0,
+    0x0E48158D, 0x1C2D1A0B, 0x04DB1E75, 0x01DA0730,
+    0x07641F6E, 0x1E9102FD, 0x1F311260, 0x01FF0DA0
+  },
+
+  {
+    0x0786081B, 0x038E0069, 0x01A10882, 0x09310075,
+    0x1F55011D, 0x13501FBB, 0x17D51797, 0x101018D1,
+    0x01F11984, 0x015310D9, 0x16370053, 0x014014FD,
+    0x0A5D0E04, 0x001C07E7, 0x00690874, 0x1A95094F,
+    0x067815DB, 0x099D1E92, 0x006011E9, 0x00ED137D
+  },
+
+  {
+    0x17980E41, 0x0460105F, 0x09E403F0, 0x07E9139D,
+    0x148C0449, 0x14EA05B2, 0x11440492, 0x005E1168,
+    0x19D30604, 0x012F102B, 0x111F0934, 0x171919E2,
+    0x10590D0D, 0x019C1C1E, 0x0A790236, 0x00651460,
+    0x03ED1B92, 0x047F16D2, 0x07CE0B56, 0x018D146C
+  },
+
+  {
+    0x1E2E0755, 0x0DE900CA, 0x07F10874, 0x0FEE1D68,
+    0x09EE06F5, 0x1E4310B2, 0x1E651E90, 0x0303021E,
+    0x158F0AE5, 0x01B704E9, 0x03D5088A, 0x0A940DEA,
+    0x17411F57, 0x0A8E0E5C, 0x093C11BF, 0x1D59058B,
+    0x1F490B6D, 0x18541597, 0x01D21DB3, 0x00EC1D4D
+  },
+
+  {
+    0x03B9136E, 0x19C81107, 0x0D2A15C2, 0x095A052C,
+    0x137E1623, 0x018413A7, 0x12E40081, 0x06321078,
+    0x077E188C, 0x00FD0507, 0x05CA053F, 0x0F530EB9,
+    0x08B41BFA, 0x17FB0C15, 0x131216B1, 0x092A1BC1,
+    0x0F360D4D, 0x0091160D, 0x1CE90948, 0x00FA0EF3
+  },
+
+  {
+    0x00320104, 0x100E14C6, 0x03C60824, 0x18810246,
+    0x0F9E02F9, 0x135E0A5B, 0x165F0F12, 0x1DA80475,
+    0x151A15B9, 0x014A1F76, 0x01D01CDF, 0x0F8F1C64,
+    0x1C8614F4, 0x19E305F6, 0x1228057F, 0x14271E84,
+    0x12DD125C, 0x08DB1F04, 0x179E17F7, 0x00B713F5
+  },
+
+  {
+    0x09B908BE, 0x041F1ECC, 0x1CA506CF, 0x12340F1A,
+    0x0CB20395, 0x086217F1, 0x1B7F1834, 0x124E189C,
+    0x13BD0784, 0x014D14E5, 0x1ABF15F4, 0x15700CF0,
+    0x02CD1F2B, 0x01840A10, 0x1C120A92, 0x1A4F1B37,
+    0x1C5D0BD2, 0x1102199A, 0x03A41B0B, 0x00CE13E1
+  },
+
+  {
+    0x1BE40A3E, 0x09180119, 0x12B512DF, 0x0100080E,
+    0x1BA7002F, 0x118F1FB6, 0x02AF17DB, 0x1BB514C6,
+    0x13B312C9, 0x009C1DA7, 0x01251BB0, 0x06C2196E,
+    0x11521A4C, 0x0DE70E44, 0x0FDC1AE1, 0x0D281CA0,
+    0x00021720, 0x00CC0C7B, 0x04161E83, 0x00850E64
+  },
+
+  {
+    0x18B10B85, 0x02381E6E, 0x0329140B, 0x0E2B0A24,
+    0x1A130E2F, 0x0B0D18F0, 0x10C00A67, 0x16690BA7,
+    0x015305DB, 0x00A01ED5, 0x044D18AD, 0x1F220AB9,
+    0x14E01225, 0x0666004D, 0x119A1203, 0x06711B37,
+    0x1C1E0E7D, 0x0A3A1B28, 0x00F6111A, 0x00BD0D5C
+  },
+
+  {
+    0x1E5E00C3, 0x1CCD0F3E, 0x0DCC0490, 0x0C821419,
+    0x074617B1, 0x1C350107, 0x1C0703E3, 0x1F9E17CB,
+    0x04FB1696, 0x00C51529, 0x090F1731, 0x1BBD19FD,
+    0x0D8A086E, 0x108E1CC1, 0x14811376, 0x06DF0A0F,
+    0x0C9F0CBF, 0x1A660958, 0x1F5E1347, 0x01A302CC
+  },
+
+  {
+    0x0D4308B9, 0x12A21437, 0x109816EF, 0x0F331033,
+    0x068F189E, 0x1143111E, 0x0E0E0A00, 0x1C0915FF,
+    0x17B01C6C, 0x00F101E3, 0x1F061976, 0x05720487,
+    0x06A719C6, 0x01D71782, 0x1B560E57, 0x0461077B,
+    0x098A02C1, 0x18640779, 0x1AEB1B72, 0x016D12CF
+  },
+
+  {
+    0x18D11573, 0x123D14B0, 0x1A4B07F9, 0x0B7A153E,
+    0x12DC02DD, 0x025F1F2B, 0x0E290208, 0x02501D65,
+    0x026B116B, 0x0019022F, 0x1A450CA8, 0x0F7E18D7,
+    0x127913A5, 0x1E9B1C95, 0x13E40181, 0x180919AA,
+    0x08DA1B39, 0x03B81863, 0x151F1390, 0x01BA1777
+  },
+
+  {
+    0x1B4B0D7B, 0x061F1ABE, 0x1D3418B0, 0x19480033,
+    0x1CE811BD, 0x1F510965, 0x07DC08D8, 0x0DDE00EF,
+    0x1C1F1F47, 0x01541679, 0x07AD0016, 0x1A6804E2,
+    0x1D010FBA, 0x1F4B102A, 0x11520147, 0x10621143,
+    0x164B0D0D, 0x0FBA0768, 0x156910E7, 0x0061084A
+  },
+
+  {
+    0x003B0ED0, 0x0825194C, 0x1F7F0DFA, 0x187D1390,
+    0x148707EF, 0x139310A8, 0x010D157E, 0x132715F4,
+    0x0DBD1498, 0x01C7177C, 0x035A0D7E, 0x0AB81221,
+    0x02AF05B9, 0x15B519F2, 0x1CAC1131, 0x0E441E9E,
+    0x08720677, 0x1D0B1E12, 0x1D45060C, 0x00500E0C
+  },
+
+  {
+    0x1D98062C, 0x147A088B, 0x1BF60FB5, 0x0FD61950,
+    0x12B40215, 0x0DFA021C, 0x0BB811B7, 0x017911D9,
+    0x19D20AD7, 0x019C1B64, 0x01F305C1, 0x1D77087F,
+    0x0E4E1A9C, 0x061A1044, 0x187E1A99, 0x15061374,
+    0x16DA17B9, 0x11761F47, 0x0B021D2C, 0x015100E6
+  },
+
+  {
+    0x020A10CC, 0x18D90363, 0x1C91188B, 0x043515B0,
+    0x039B158B, 0x13250208, 0x1D3A1032, 0x13FD0F50,
+    0x1C3415EA, 0x00F203B3, 0x1FDA1292, 0x0B011DC6,
+    0x0F0A159A, 0x01F31D47, 0x107B1A90, 0x1AC40E7D,
+    0x026209A9, 0x1D9E1BD1, 0x120E187D, 0x01C61035
+  },
+
+  {
+    0x01351033, 0x16510B04, 0x09D601EB, 0x01270943,
+    0x17F8199A, 0x10D30963, 0x00291E4E, 0x1AD71A8B,
+    0x0D52014D, 0x0160178D, 0x1AA2049F, 0x16981299,
+    0x1EB00FBC, 0x133F0109, 0x16121C08, 0x0B5C1A77,
+    0x122B088C, 0x00730B5F, 0x1CE30646, 0x008E09C3
+  },
+
+  {
+    0x0394089A, 0x156A02BA, 0x09D400DF, 0x1AEE00E4,
+    0x17D51939, 0x0D640090, 0x1E381441, 0x175D013A,
+    0x010612F8, 0x00450F14, 0x0B891946, 0x155519A7,
+    0x08090ABE, 0x13C71BC8, 0x19E10CD3, 0x1DF302A6,
+    0x13B412CA, 0x09851AB1, 0x172318E6, 0x00C21888
+  },
+
+  {
+    0x1545095D, 0x1B980A2D, 0x04321FFC, 0x18DE01A3,
+    0x130C148C, 0x11471EED, 0x1C8518C4, 0x13781809,
+    0x1F6C1323, 0x01F5090E, 0x1D471E3D, 0x08E0119D,
+    0x045E1977, 0x0F47191C, 0x0AFC03CA, 0x06900B9F,
+    0x04741E24, 0x0439084E, 0x0F880269, 0x01A4069D
+  },
+
+  {
+    0x0ADD1AE6, 0x13E30C68, 0x1DE71754, 0x17910E9A,
+    0x1D4E04EB, 0x15641B5D, 0x0F591513, 0x17761BCF,
+    0x196B1F94, 0x01FA0EF3, 0x17F11DDC, 0x068915D1,
+    0x1ED51FA8, 0x08BA0BD3, 0x1DD613E5, 0x11BC174D,
+    0x066518EF, 0x025B0EE9, 0x07F61971, 0x015B0945
+  },
+
+  {
+    0x1E7A0DBF, 0x1F4B18A2, 0x1B211017, 0x1B500085,
+    0x1D5E0AEA, 0x177E16A7, 0x1B090744, 0x0B311BBE,
+    0x045A1144, 0x01E50372, 0x1C250585, 0x092017AC,
+    0x0B6B12FD, 0x0ACE0F7D, 0x09841872, 0x0E3B1420,
+    0x089E0A66, 0x16B30F86, 0x0A040249, 0x0034090A
+  },
+
+  {
+    0x1B83123F, 0x130704C7, 0x04121DA3, 0x0156086B,
+    0x03671E75, 0x09D61B99, 0x0353168F, 0x1D24164B,
+    0x185A07C9, 0x00850436, 0x09A304C5, 0x05F70210,
+    0x0F8D0F9D, 0x1A79025C, 0x03250A8A, 0x05D7134F,
+    0x1DF50D1F, 0x182C0C98, 0x11991374, 0x016B1407
+  },
+
+  {
+    0x13950D0C, 0x14F31ECF, 0x1C971E96, 0x11880AE9,
+    0x1A1D00A2, 0x107C127C, 0x10520230, 0x0E8C1BBF,
+    0x057B0B31, 0x00D11CD1, 0x1D920D4A, 0x1C2F16CF,
+    0x03130CDF, 0x044E07D7, 0x1B340BFC, 0x09AC1FFC,
+    0x076C13C2, 0x01440181, 0x002F1854, 0x00630E71
+  },
+
+  {
+    0x12C10E7F, 0x168F0268, 0x0E140D36, 0x02891B0E,
+    0x00681A10, 0x1B7515E8, 0x1E310C3E, 0x03B70598,
+    0x1A5B0F46, 0x008014AF, 0x046905EB, 0x144F10C6,
+    0x062D1235, 0x073306FF, 0x073904F3, 0x03AE0332,
+    0x15F30BD7, 0x1F8C0618, 0x0A8C10B0, 0x01FD13D3
+  },
+
+  {
+    0x0D131295, 0x1D8817C5, 0x1888163F, 0x07CE134A,
+    0x0D201A77, 0x05BB1A43, 0x00DE0091, 0x186B124D,
+    0x17D50A83, 0x00AB00F6, 0x0FA006F4, 0x075C02C1,
+    0x19760BC9, 0x06D8109F, 0x167B13A8, 0x18DD04A9,
+    0x19351E52, 0x0F9A182B, 0x115A09B6, 0x01C1059C
+  },
+
+  {
+    0x057716E0, 0x035A14C0, 0x07640F4B, 0x1D320912,
+    0x028E1353, 0x1EBE1C14, 0x111B0244, 0x1BBE0AF6,
+    0x12621172, 0x00701907, 0x0D7F0306, 0x0D6B0B83,
+    0x0DBF1D07, 0x026010BE, 0x0DD7102E, 0x17730223,
+    0x1BB21537, 0x14EA1BBE, 0x00BF0EE3, 0x00510B0C
+  },
+
+  {
+    0x0EA60FAC, 0x08D80428, 0x13D20743, 0x1810149A,
+    0x157E1F5C, 0x0C571FDE, 0x19010A8F, 0x1C830848,
+    0x17160802, 0x003D176E, 0x101F1844, 0x015E0B75,
+    0x0C8B18FA, 0x0FC911C0, 0x01B7006B, 0x07B60CE8,
+    0x02FA0527, 0x179F1031, 0x0C32160E, 0x00860413
+  },
+
+  {
+    0x08EB18E5, 0x0B6A0443, 0x1A251961, 0x06441711,
+    0x133510DE, 0x155E0D8E, 0x05230FB6, 0x14431029,
+    0x15A404F7, 0x01690389, 0x0D001B2D, 0x17611D88,
+    0x07CC006E, 0x00910DEC, 0x060004E4, 0x1DAD1D9A,
+    0x098D1CDF, 0x07B50D90, 0x0A020D4D, 0x01F51005
+  },
+
+  {
+    0x13000E54, 0x1A13101C, 0x1E881FF8, 0x15E20080,
+    0x00CB00ED, 0x0EEE15BF, 0x0EEA08F3, 0x1101190A,
+    0x0F54084D, 0x009F0928, 0x09250D69, 0x13D51C63,
+    0x130717FA, 0x1195185B, 0x125C1A57, 0x0A6C12DA,
+    0x04241F33, 0x007F19FA, 0x0EDA026F, 0x007419A0
+  },
+
+  {
+    0x1D4F10A4, 0x04FA0D23, 0x0D511624, 0x18141D88,
+    0x1F7C12AA, 0x1784035F, 0x1DFD1576, 0x1A391E68,
+    0x1D7A17AD, 0x01C003D4, 0x1470182B, 0x12280826,
+    0x05661AA0, 0x0E0C161C, 0x0B6D1ADF, 0x1CFF08F6,
+    0x19F10CB9, 0x045D0461, 0x0DBD0E58, 0x002B0E31
+  },
+
+  {
+    0x09E8097F, 0x077E0856, 0x0ACD06B5, 0x1D501356,
+    0x05FB067B, 0x1D690FAB, 0x104F14FE, 0x04A31745,
+    0x03A60AC8, 0x00D3096C, 0x18C70CB3, 0x1ACA0C54,
+    0x09F00612, 0x179A1083, 0x0B3506AE, 0x10BA1C8C,
+    0x004A15E6, 0x082501A1, 0x00E01DAA, 0x008A13C9
+  },
+
+  {
+    0x0EB31E8A, 0x1CDA1029, 0x1A1D18D3, 0x13F4062D,
+    0x17091963, 0x091C1F70, 0x1A4F0A09, 0x1BD11D8D,
+    0x02FA126B, 0x01571532, 0x0C090DFE, 0x1B4F050B,
+    0x03391731, 0x1BAC1FB6, 0x14D41C0D, 0x107E0941,
+    0x1F5D054A, 0x0C45198F, 0x1697164A, 0x008E16EB
+  },
+
+  {
+    0x00550B96, 0x0E15146D, 0x163201AA, 0x1DBF0447,
+    0x07BD0CCA, 0x01F50567, 0x1C4C1CE7, 0x04B1058D,
+    0x1F20109A, 0x01D30F13, 0x1FCB19E4, 0x19C11406,
+    0x0CDF07BC, 0x0E770D97, 0x114A01C2, 0x15C60D97,
+    0x0BE6024B, 0x04271926, 0x1DDC0B08, 0x00411BF3
+  },
+
+  {
+    0x0EB71A57, 0x0D830C2F, 0x0C260DDE, 0x1B8D01DD,
+    0x1B261A38, 0x11451A8E, 0x1E820D68, 0x08F01D7B,
+    0x1C4C0DE9, 0x00BC04BC, 0x01141E61, 0x1B8D1CD3,
+    0x06701822, 0x0CA60B16, 0x001100A9, 0x04201364,
+    0x1AC71541, 0x018602FF, 0x0D430F43, 0x0199071C
+  },
+
+  {
+    0x035411DD, 0x07EF0BC5, 0x1948169A, 0x0ECE1D80,
+    0x03371B03, 0x08660514, 0x1D2B0503, 0x1F881FE2,
+    0x13721D12, 0x009B023C, 0x10EC0482, 0x10F41BF7,
+    0x16E2052E, 0x04FB013D, 0x038F1C3D, 0x18371F04,
+    0x13070B41, 0x014A0601, 0x0EE919AD, 0x005E1090
+  },
+
+  {
+    0x0D321E89, 0x031F1B57, 0x00021CEA, 0x0756180C,
+    0x1C4E102E, 0x0D6817AA, 0x19811DB1, 0x0D041164,
+    0x002200B3, 0x01EB1501, 0x17360A16, 0x0587062D,
+    0x0DB918E6, 0x095403E3, 0x05B3080F, 0x0E6B1DC1,
+    0x05A91AB3, 0x092A178B, 0x0580005E, 0x01211ABD
+  },
+
+  {
+    0x0183102A, 0x137E0274, 0x125D14EA, 0x14991920,
+    0x0747044E, 0x043C16D6, 0x153500A8, 0x152C082A,
+    0x1470117D, 0x0041043E, 0x04810901, 0x118601A0,
+    0x1A3901B6, 0x12E10D39, 0x1D780A7E, 0x07271E5A,
+    0x1A2008C0, 0x1E4B03AE, 0x11970C32, 0x013012F5
+  },
+
+  {
+    0x0ACF110E, 0x1B351E04, 0x08DE0807, 0x00161094,
+    0x17021EFF, 0x03601408, 0x14F80266, 0x103418BB,
+    0x09D109FB, 0x007A1161, 0x1ADE03A9, 0x13821BBD,
+    0x08700A6B, 0x00CA056A, 0x1410111A, 0x1BF80497,
+    0x108A049E, 0x1062061C, 0x19A5080A, 0x009C1378
+  },
+
+  {
+    0x1BEB197D, 0x14130358, 0x12A21270, 0x1DBF1DCD,
+    0x1B071F39, 0x1AD612A6, 0x1EFC0BF9, 0x0ABF0BAC,
+    0x1AF80E61, 0x00151260, 0x005E00E9, 0x00961A59,
+    0x0D84050C, 0x06671FA2, 0x17D104F7, 0x18D01CAC,
+    0x163D1195, 0x1AA61362, 0x19311D00, 0x01AD020A
+  },
+
+  {
+    0x11B5083D, 0x0A4608C0, 0x14890E00, 0x14791668,
+    0x00FD1825, 0x1F2515C9, 0x03CE0BC3, 0x07BB15A5,
+    0x193118EC, 0x007107BF, 0x159B07C1, 0x1FD41B07,
+    0x106F0E9F, 0x18B207CE, 0x10891A50, 0x0F610BE7,
+    0x081810CB, 0x0359073F, 0x0E4911EA, 0x00BC06C8
+  },
+
+  {
+    0x05670FF5, 0x1C5E0192, 0x1F1A0DA6, 0x0B3D0837,
+    0x03C61DC1, 0x09B60CA3, 0x1AFD1471, 0x174D0AD7,
+    0x07AF06F3, 0x0128066B, 0x13601B27, 0x19A215F1,
+    0x0DBD1B19, 0x1A7F046F, 0x0A391BE3, 0x1C621D28,
+    0x10FA115E, 0x0FD01822, 0x03881B42, 0x00AC16A4
+  },
+
+  {
+    0x11EF0F2F, 0x16B81D21, 0x0CAD071D, 0x18D01B6D,
+    0x02371C6C, 0x00AF03DF, 0x120F12AB, 0x17841906,
+    0x104800C9, 0x00751C90, 0x1E4D0B1A, 0x04671F6C,
+    0x07AC1134, 0x1536181C, 0x1BC310F3, 0x1E551CD0,
+    0x18F91B2D, 0x0E550CE6, 0x10720AB4, 0x00C004F6
+  },
+
+  {
+    0x18CE0A96, 0x163015BC, 0x0FD60A4A, 0x1C5F03C5,
+    0x17D6193F, 0x10660517, 0x0A1F1F7A, 0x06F30268,
+    0x1DF7119E, 0x016F1D06, 0x07DD040D, 0x165A11E2,
+    0x1BC10E71, 0x13FF14ED, 0x17DF087B, 0x1DE011A4,
+    0x1F6C1BED, 0x1FCE0146, 0x06600A92, 0x013B01AC
+  },
+
+  {
+    0x00E91434, 0x0D3B0FA4, 0x107B0E42, 0x09FF1A42,
+    0x049D11C8, 0x08700F1C, 0x05580CFC, 0x1EFE0E78,
+    0x0DCC1EF8, 0x01290A1D, 0x1E831E21, 0x09CA09DE,
+    0x1C5017C5, 0x0A241307, 0x122106E7, 0x0B3C1055,
+    0x08271F3A, 0x12301623, 0x03B10E3F, 0x01941548
+  },
+
+  {
+    0x19951EF2, 0x07750B8F, 0x075B0C6C, 0x1EF912FE,
+    0x18980EE8, 0x1CFD0270, 0x16151468, 0x04BF0427,
+    0x0BA51C26, 0x007F0FEF, 0x138B13D1, 0x0054022C,
+    0x0A941885, 0x1FE713C3, 0x0DD91271, 0x16DF1019,
+    0x04EF132E, 0x0CF20050, 0x1B9B1519, 0x004214C5
+  },
+
+  {
+    0x0D0A027C, 0x163A1C43, 0x1F94093E, 0x0E080438,
+    0x1DAF11A2, 0x126415C5, 0x0EA404BA, 0x056501FA,
+    0x055A176B, 0x01F100F1, 0x0D860C94, 0x03C01D45,
+    0x15AA0847, 0x064A183E, 0x15770701, 0x1B3B1B1E,
+    0x10F71E8D, 0x163A02D1, 0x1042088A, 0x00C101BC
+  },
+
+  {
+    0x009A05EB, 0x166E1D35, 0x1F6118A9, 0x14480C82,
+    0x1F210D2E, 0x0E480D7F, 0x18BB0E7D, 0x01C303AE,
+    0x13760A2C, 0x00701045, 0x1B951E35, 0x0F460074,
+    0x086F19C2, 0x0B9C0CA7, 0x0BA81819, 0x15331F80,
+    0x1E4C0CBC, 0x19DB0480, 0x0D3409F4, 0x01091670
+  },
+
+  {
+    0x1C48034E, 0x08E7056D, 0x0BBE0A7F, 0x0B9C0EB3,
+    0x1A9B1851, 0x0417134F, 0x0B490E0A, 0x096E04A7,
+    0x0C0219E4, 0x017F141C, 0x199F1199, 0x1A7C0559,
+    0x0A0D092C, 0x103307E4, 0x021A028C, 0x0FD311BA,
+    0x14481EC0, 0x15E0111F, 0x0B1B15DE, 0x008E040E
+  },
+
+  {
+    0x1C440C81, 0x00680981, 0x00030E24, 0x0CB01D24,
+    0x001A1473, 0x1F941FCD, 0x1B4D0111, 0x0A631520,
+    0x1E830E2F, 0x00700DC1, 0x1BE810DC, 0x15040527,
+    0x17990DC6, 0x0F190757, 0x0E500B85, 0x1B6D1E53,
+    0x052D165C, 0x0DEF0A29, 0x0C941B23, 0x00501FFC
+  },
+
+  {
+    0x060A155E, 0x10F11292, 0x0D961886, 0x19351DC3,
+    0x0AFD11FB, 0x02BF16A5, 0x1FFA08FB, 0x1F4C077F,
+    0x12EC0FB2, 0x01FB0614, 0x1F8609A8, 0x103C1D55,
+    0x0BC119A4, 0x05441C1A, 0x14DD0B3B, 0x04471257,
+    0x14EF1FBA, 0x05AC0655, 0x0BC00F6B, 0x01270103
+  },
+
+  {
+    0x1DD70B04, 0x154B1608, 0x047D0EAA, 0x0187091C,
+    0x15BD0DCA, 0x0F640D10, 0x0A651DC1, 0x0DA11C4E,
+    0x14A01D92, 0x0164106A, 0x0F12121D, 0x0A931D47,
+    0x05010DA7, 0x193C12D2, 0x07731534, 0x0D74195A,
+    0x0F061EE4, 0x041C1077, 0x176901B9, 0x010B0A9F
+  },
+
+  {
+    0x17C81228, 0x10AF1AAE, 0x15790348, 0x10291B2C,
+    0x1C490D0A, 0x03D10E0A, 0x09B707F9, 0x06351418,
+    0x006A0954, 0x00101A7B, 0x10281CDF, 0x1493110B,
+    0x0DA8154F, 0x195008F2, 0x165A07AD, 0x0CBD0E06,
+    0x10000762, 0x0EB401C2, 0x0AE41B76, 0x00AA1CA2
+  },
+
+  {
+    0x160A0E8F, 0x15BE1825, 0x112D09D1, 0x1265101A,
+    0x10321977, 0x11AB0A46, 0x0E5E11F5, 0x07F106CB,
+    0x19DE1E73, 0x002500C0, 0x1DEB0A2D, 0x041C03A6,
+    0x1C230B40, 0x0AEF14E0, 0x17451071, 0x0C6B11EF,
+    0x17A3065A, 0x0FAB1E12, 0x155114DD, 0x00A90703
+  },
+
+  {
+    0x037002AB, 0x1F6103FA, 0x03650F29, 0x18211570,
+    0x1D41066D, 0x1E911D27, 0x0AF107D2, 0x03760C97,
+    0x034F06F3, 0x01451AFD, 0x1C1508EB, 0x1D2F1640,
+    0x027B186A, 0x096618FC, 0x165C12F4, 0x005A1DBD,
+    0x0DCB0540, 0x046B14E4, 0x0C620432, 0x004F0FAF
+  },
+
+  {
+    0x1B2A181E, 0x00D1140D, 0x0C1707B3, 0x1EA3170B,
+    0x0AB01D30, 0x03E40F5A, 0x0022141B, 0x10991A29,
+    0x19001B40, 0x00D4097E, 0x01030329, 0x101C06D8,
+    0x01EA1501, 0x034B13D1, 0x18F01594, 0x00D41001,
+    0x1B19193D, 0x168413D5, 0x1FE019CF, 0x00B402BA
+  },
+
+  {
+    0x094D0049, 0x0A8B16B9, 0x0A0D0A2D, 0x0D181CE9,
+    0x1D2C01A7, 0x012A0299, 0x144511EE, 0x1F990ABF,
+    0x1BA212B8, 0x00C41DE3, 0x1C2403FC, 0x16371E82,
+    0x1612044B, 0x0B4D1A20, 0x02EB127F, 0x0A741DDB,
+    0x065F0605, 0x02110139, 0x17C01AE9, 0x01C2156C
+  },
+
+  {
+    0x19031A93, 0x094708C6, 0x178205D8, 0x0C761C6C,
+    0x17DD0E3D, 0x00270E2E, 0x0E751C16, 0x011A06AA,
+    0x1E7E11C6, 0x01F906A8, 0x1C66172D, 0x1EB21B33,
+    0x190601E3, 0x0B1B085A, 0x01301525, 0x0B58025B,
+    0x18581CD8, 0x06FB09B6, 0x12190BB6, 0x00690AC3
+  },
+
+  {
+    0x164A13E4, 0x09EB1044, 0x03850A9F, 0x100509A9,
+    0x1FF21180, 0x162E1DD6, 0x0AFD1CB0, 0x05761D51,
+    0x04A60175, 0x009E045E, 0x02511BE7, 0x1C931795,
+    0x160E05B5, 0x0DE40B0F, 0x086E1E35, 0x03B415B2,
+    0x157306A0, 0x1B3B1389, 0x0AA915FF, 0x01560ED8
+  },
+
+  {
+    0x0A7A0326, 0x1A061EF2, 0x0540121A, 0x15A007D8,
+    0x0EE91C9A, 0x06201908, 0x08F7065A, 0x1990013C,
+    0x10050DBA, 0x008E147F, 0x1E14117E, 0x106B0274,
+    0x1FB21E46, 0x088E0750, 0x17D40BD1, 0x034808BD,
+    0x034B1F31, 0x0EE50C80, 0x0A781FA0, 0x01D00F5F
+  },
+
+  {
+    0x0D901469, 0x00F71FD6, 0x13EF0CA9, 0x1FB81118,
+    0x07671DA9, 0x15F3049E, 0x19640BB5, 0x14DF122C,
+    0x036211C0, 0x00450614, 0x0BDF1C5F, 0x0E4813A7,
+    0x06DE0222, 0x19371237, 0x1EC803A0, 0x0B0107D9,
+    0x0B560ECA, 0x177A1E24, 0x1A520C45, 0x01FD1CD0
+  },
+
+  {
+    0x09990D4D, 0x092C0671, 0x045B1127, 0x09201D84,
+    0x13C11465, 0x05F013F7, 0x183206E5, 0x0BE11913,
+    0x17D41B85, 0x0159086C, 0x1AD60C3E, 0x01DB146E,
+    0x03BD09F4, 0x0A2B12C0, 0x11A01DD5, 0x0E6310E1,
+    0x115F16F7, 0x1EDC1105, 0x0AE31D37, 0x00611F0C
+  },
+
+  {
+    0x11120934, 0x0CAE1FAF, 0x097A107C, 0x0C820CED,
+    0x005E179C, 0x0DD5068C, 0x020519B2, 0x0B5E09B5,
+    0x1F240AF9, 0x01B90608, 0x08D008EB, 0x196702A5,
+    0x15A71F3D, 0x145915BD, 0x0E570DC3, 0x0AAE0BBF,
+    0x04771DB5, 0x0ADB16D9, 0x1110043C, 0x0164195A
+  },
+
+  {
+    0x05591106, 0x05CF089F, 0x05E6024C, 0x14A81777,
+    0x1F380143, 0x04781351, 0x0B9C0AAE, 0x12080C48,
+    0x1ACE0972, 0x01A61564, 0x1B720215, 0x179D1757,
+    0x02910D0A, 0x071B0325, 0x17841EF6, 0x17F30AC8,
+    0x0EF211FF, 0x16B019EF, 0x14C415ED, 0x00F50889
+  },
+
+  {
+    0x18740727, 0x00BE1614, 0x19791C7E, 0x1B310284,
+    0x1EA01592, 0x106B1D60, 0x1CDA0864, 0x072B05F2,
+    0x1D140F60, 0x001A172A, 0x0C280A76, 0x186C075F,
+    0x1F6F1B97, 0x11401D47, 0x13AE1063, 0x170C0BEF,
+    0x109E144E, 0x132F0EB4, 0x131A197D, 0x01970050
+  },
+
+  {
+    0x0FDD082B, 0x14431D61, 0x0B8C05E2, 0x0A5D1A03,
+    0x07151234, 0x1F1A0EB5, 0x06C916D8, 0x014D0D87,
+    0x1D550EA8, 0x00A61F83, 0x0E011360, 0x03220ED9,
+    0x02301E8A, 0x10DD0692, 0x0D6C1155, 0x13CF124B,
+    0x1E3D1E0C, 0x1CDB0C65, 0x17080476, 0x01311FCC
+  },
+
+  {
+    0x06B914CA, 0x062B063E, 0x108A1561, 0x07660AAD,
+    0x15480C80, 0x129E185C, 0x05B41042, 0x092A1BC8,
+    0x035909BB, 0x01381323, 0x1A211E3C, 0x04790F28,
+    0x05471725, 0x1AA30ABD, 0x0A011FC2, 0x133418CE,
+    0x05E50A0F, 0x19D81C99, 0x14FB0437, 0x01F00DF2
+  },
+
+  {
+    0x0B421448, 0x0F010105, 0x1EF103BB, 0x11E2061A,
+    0x187E03A2, 0x1E9D1AF7, 0x0F860FAC, 0x01BB1350,
+    0x1CCD0E3A, 0x0107013D, 0x05A71451, 0x1CCA0FC4,
+    0x1A3B0F4E, 0x01F00CF4, 0x161715D3, 0x11C11873,
+    0x1DE70B33, 0x13C601B0, 0x0A950A48, 0x00EC15C3
+  },
+
+  {
+    0x1C1018CF, 0x1D560E28, 0x09E20B7A, 0x16350783,
+    0x095807AE, 0x0F491253, 0x08B51E24, 0x0EC713C3,
+    0x14AC11FD, 0x00B51E21, 0x14ED0273, 0x1572050A,
+    0x100B0053, 0x156C07AF, 0x10861130, 0x069C0A12,
+    0x0CDC1C8D, 0x1BCC1542, 0x081B0ED4, 0x01640690
+  },
+
+  {
+    0x07421A02, 0x1E6C123E, 0x0E520940, 0x152A157A,
+    0x100A0FF0, 0x1D7F1D73, 0x17021982, 0x12EF1195,
+    0x16CB1CD3, 0x00E20137, 0x1C2E1FE7, 0x180A0498,
+    0x13B619A4, 0x078100C3, 0x183107BE, 0x0294142F,
+    0x00A3105B, 0x154F1BE3, 0x0BFC0C3F, 0x00761287
+  },
+
+  {
+    0x154308A0, 0x03C212F9, 0x0F27184B, 0x17681EF0,
+    0x1BDC18A2, 0x19000DCC, 0x16FA0E4C, 0x1C291439,
+    0x09B31958, 0x016E1469, 0x1CC311B7, 0x0AEE06D6,
+    0x082F0F92, 0x0B5C05BB, 0x177F1A61, 0x0D2B1775,
+    0x00A011AC, 0x11A200C5, 0x11530146, 0x01231AD5
+  },
+
+  {
+    0x04AE1F07, 0x007E043A, 0x15EC06A7, 0x1F40061D,
+    0x17EB15F3, 0x19C103FF, 0x0D830E70, 0x1BFD1BAD,
+    0x02A10783, 0x00D11DAE, 0x03890655, 0x0EDF029E,
+    0x1FBF190C, 0x1A5E0C42, 0x067A1293, 0x1B48140A,
+    0x040204DF, 0x019C1BEF, 0x15D412E4, 0x0197187F
+  },
+
+  {
+    0x060E0E9F, 0x18281CF0, 0x08E91FD4, 0x172F1B68,
+    0x193F1187, 0x13081415, 0x066C071D, 0x1A9A0C09,
+    0x0B7D0174, 0x019E1AC4, 0x13C9152F, 0x01640FF4,
+    0x12930D30, 0x0B040FC4, 0x09B20BC6, 0x156F0DC2,
+    0x08440192, 0x18A60B1E, 0x1D0D16BF, 0x01851787
+  },
+
+  {
+    0x1CB704C1, 0x119D1A90, 0x113A0E99, 0x016D0B3A,
+    0x1FE402EF, 0x04A11A49, 0x07B909F2, 0x0021048C,
+    0x0A690F42, 0x01A10CBE, 0x1C6A0966, 0x0B5B176C,
+    0x1DA21430, 0x1F0C0930, 0x10851838, 0x112A139E,
+    0x19311665, 0x033C15F6, 0x0C140B07, 0x012E0516
+  },
+
+  {
+    0x09FA135C, 0x09360F76, 0x0DF91645, 0x09B41DB9,
+    0x149C178B, 0x14031043, 0x18F91EE5, 0x13D5038A,
+    0x057D09D1, 0x00ED1C84, 0x01320D57, 0x15941EB1,
+    0x03DD0F04, 0x062900D2, 0x0CFC1890, 0x0C5003E4,
+    0x0996101E, 0x08191E10, 0x0E7513A0, 0x01E612CC
+  },
+
+  {
+    0x17460B7E, 0x1D831FFB, 0x0FD8175C, 0x1F5F01CD,
+    0x0AB30BF7, 0x12EB14BF, 0x106019A5, 0x1D8D130D,
+    0x146F1075, 0x01270CF3, 0x0AEB05CE, 0x16DC11E0,
+    0x09A21718, 0x183A070E, 0x00BF0C17, 0x1B5901AC,
+    0x0EC302F6, 0x15711928, 0x0D8F06DF, 0x004D0315
+  },
+
+  {
+    0x1FE50F2D, 0x0BFA0D33, 0x058D1B53, 0x1BF408EE,
+    0x04E40838, 0x02F11D91, 0x1DA31FDE, 0x17C512CB,
+    0x1FAF15D8, 0x0040045C, 0x0B470EEE, 0x1C390366,
+    0x1A8A0485, 0x1D5F015A, 0x08B21D69, 0x0AD615DE,
+    0x1B1006C7, 0x15D3085E, 0x108D0FE2, 0x011B0B1D
+  },
+
+  {
+    0x1EF9189D, 0x0BE408F6, 0x144F00C5, 0x08CC07B6,
+    0x03B00302, 0x022A0194, 0x0BAD0E2A, 0x06EB1062,
+    0x1D5E0911, 0x00EF0ABA, 0x1F0216E6, 0x1D35144B,
+    0x02720EDA, 0x08051779, 0x145508F7, 0x050E0D48,
+    0x1440103E, 0x19A90274, 0x053F1B60, 0x01E612AB
+  },
+
+  {
+    0x05EF1594, 0x17981CC2, 0x05051BC7, 0x1E55045E,
+    0x1C7F0C77, 0x093D17ED, 0x193C0269, 0x1AC51DEE,
+    0x062F1137, 0x00EF0C34, 0x07C509EA, 0x1AF612E2,
+    0x0D2415AD, 0x17B219B3, 0x00991EDF, 0x156C1BC6,
+    0x04E5026E, 0x0A560406, 0x1A3A15F4, 0x0081101E
+  },
+
+  {
+    0x19B41FC9, 0x0D6E0988, 0x1C3B04BD, 0x13CA0F42,
+    0x1ABF1292, 0x046801A1, 0x0AE51A4F, 0x0D570B0B,
+    0x00020A86, 0x012C0584, 0x12031A5E, 0x12F7134B,
+    0x05920499, 0x0FB20B77, 0x034D0B19, 0x1FCA04C7,
+    0x18F90438, 0x0BC810B3, 0x1D6E0EE7, 0x00F512E7
+  },
+
+  {
+    0x1A4C03B1, 0x1EFC09AC, 0x18A21FB5, 0x00FA0FEE,
+    0x1BF118E2, 0x1EE31B5F, 0x0477091A, 0x0B5D0BD8,
+    0x1093086E, 0x00DA1E3D, 0x03F3151E, 0x1A5C18D8,
+    0x1D1D12F9, 0x06E41D22, 0x0C3007CB, 0x09FC15AA,
+    0x17B6132F, 0x05710401, 0x0AD30D24, 0x0053002F
+  },
+
+  {
+    0x1E9614C0, 0x1D070508, 0x142D1254, 0x122F0BA9,
+    0x17AB1F0C, 0x1EEB0ABA, 0x06C400F6, 0x17EB0E98,
+    0x16650333, 0x00491AE6, 0x06D21DEA, 0x1C9912C7,
+    0x15A71E3D, 0x08381469, 0x0FF70F93, 0x17581313,
+    0x18921F88, 0x0F3911D0, 0x0E2D0CD0, 0x00D31E24
+  },
+
+  {
+    0x0DD407E7, 0x09561D0F, 0x11D60638, 0x02D61E29,
+    0x07471205, 0x07F41709, 0x08CC0DE0, 0x05120F1B,
+    0x0A7D150C, 0x00F51ECF, 0x12671320, 0x08310E4E,
+    0x0D660E4D, 0x01C91EAA, 0x0D56022A, 0x0A5807CC,
+    0x13E60675, 0x117D0C22, 0x11D61666, 0x006C0026
+  },
+
+  {
+    0x1A6B194F, 0x02DC0EEC, 0x1C09109A, 0x062919D0,
+    0x04611F4A, 0x0A39060D, 0x13DB1476, 0x0CA61BA2,
+    0x1DCE12C7, 0x008C19FA, 0x054407AB, 0x11091EAE,
+    0x1C2111F6, 0x11B40237, 0x168101BC, 0x0BEB050C,
+    0x16A30095, 0x0CCE1FF0, 0x163918D0, 0x005A1706
+  },
+
+  {
+    0x176513E4, 0x0910107E, 0x10E701D3, 0x16A0101B,
+    0x0F1706D3, 0x0ECF06E1, 0x05CB1268, 0x05680D41,
+    0x081B1881, 0x004A09E7, 0x133B0779, 0x05200255,
+    0x1E7A17E3, 0x0B76000A, 0x1780184A, 0x0C6116A0,
+    0x1441136D, 0x0C941D27, 0x185F1085, 0x01251406
+  },
+
+  {
+    0x167D09E8, 0x01E81A8D, 0x117B1946, 0x15101291,
+    0x1B4000B8, 0x00D4199C, 0x0ECC1A2C, 0x169E1A7D,
+    0x163D1101, 0x00350C5C, 0x190E059C, 0x138E00D4,
+    0x1E0F1F69, 0x029D144E, 0x105C1ACA, 0x1F5417AA,
+    0x03770BBD, 0x0D021A47, 0x08120F34, 0x011016B9
+  },
+
+  {
+    0x0BAB1170, 0x1D650772, 0x1A041DBD, 0x13190FC6,
+    0x12AD15A8, 0x098112F4, 0x19EF1D4A, 0x08641006,
+    0x10C6197E, 0x00701845, 0x1DF7079E, 0x146E1D15,
+    0x11630F3E, 0x09D71083, 0x0B04141F, 0x07881EE2,
+    0x0C7A1085, 0x026C0887, 0x1E9D18F4, 0x00FC1F40
+  },
+
+  {
+    0x1012081A, 0x108A0BBC, 0x17F61CC3, 0x10D50F25,
+    0x0A86119D, 0x0C591415, 0x1D96163C, 0x0AD11A0F,
+    0x05831B81, 0x017A1816, 0x039B1BB6, 0x04E31C5C,
+    0x0BEA0628, 0x1DB00FC9, 0x0E281419, 0x13DE1F76,
+    0x128A0E40, 0x0FC61E7B, 0x1DF71846, 0x01EF0387
+  },
+
+  {
+    0x1CFF05CE, 0x1DE80C4C, 0x13681045, 0x0C1A0930,
+    0x177A014A, 0x0C3E0EEF, 0x0A890156, 0x014A0710,
+    0x005D031D, 0x019409C3, 0x0E810271, 0x1B880762,
+    0x174900BD, 0x054A16E6, 0x02ED0241, 0x16CA14B3,
+    0x12340E21, 0x1DDC178A, 0x007109CB, 0x00120814
+  },
+
+  {
+    0x14391D50, 0x05DE0DA4, 0x02681827, 0x04CF0732,
+    0x1731125D, 0x10CE1548, 0x1A7A08D3, 0x11051358,
+    0x016704D5, 0x003B05A2, 0x03B004C9, 0x16A61597,
+    0x085117F0, 0x127A10C4, 0x09E113B3, 0x0DBC0E61,
+    0x05B20309, 0x0A73192F, 0x0D0C1F50, 0x006B1049
+  },
+
+  {
+    0x03900A67, 0x0BEC07E3, 0x01EE1BAD, 0x17821AFF,
+    0x11611C19, 0x0BAC1395, 0x1EA10656, 0x086F0665,
+    0x1A7A0950, 0x01560940, 0x0081192E, 0x052F1D85,
+    0x16B401F6, 0x09420BA1, 0x1DF718D1, 0x1BF71442,
+    0x002A1551, 0x1F750B59, 0x15E80D44, 0x00A712B4
+  },
+
+  {
+    0x092E0A56, 0x029A0383, 0x037F160D, 0x14B713E5,
+    0x118E0CE9, 0x1DE40DD9, 0x1716069B, 0x096A05FC,
+    0x1BD00D8E, 0x009C0F19, 0x1D8610CE, 0x0A5D129A,
+    0x0E540A7C, 0x191A00E4, 0x10D10389, 0x1D160751,
+    0x0B281737, 0x10960504, 0x1C850706, 0x00E20252
+  },
+
+  {
+    0x12AA0187, 0x0D8C1199, 0x042C076F, 0x01DA0EEB,
+    0x1EF10A1E, 0x152E1BA2, 0x0FB3085C, 0x10A312A0,
+    0x118F160C, 0x00910A75, 0x1B4916E6, 0x10360E0C,
+    0x065E195A, 0x09FE1E4D, 0x0AC40C23, 0x11B7000C,
+    0x01C405C6, 0x09181D58, 0x01BA1C1A, 0x01381DDE
+  },
+
+  {
+    0x184D1816, 0x18F51EE1, 0x1B190FC9, 0x005A12AD,
+    0x17801908, 0x19010F47, 0x093A1B04, 0x14400982,
+    0x0F111680, 0x00F20614, 0x04CF0F09, 0x1FA71ED6,
+    0x03D910B4, 0x139512C8, 0x029D113F, 0x18A01FD8,
+    0x0C9E1167, 0x076F10F2, 0x041C0D9E, 0x01E31BD4
+  },
+
+  {
+    0x16971E5C, 0x0DFC0182, 0x02651F42, 0x0D32008B,
+    0x05C31460, 0x007D1F38, 0x193B0724, 0x19930A87,
+    0x118213E2, 0x018612D2, 0x072B1D9F, 0x13670AF4,
+    0x1C0307E4, 0x11620D18, 0x14C80621, 0x17FE1D29,
+    0x10A00B98, 0x0DD40E46, 0x108F037C, 0x00A51795
+  },
+
+  {
+    0x14581B92, 0x1CB11278, 0x0E941AD1, 0x1A0E1E84,
+    0x1DFE03EA, 0x143B1A48, 0x0E9B07AB, 0x01D1067D,
+    0x097D0FB3, 0x01831B9C, 0x0C3B0AC6, 0x10DE0D1D,
+    0x00E11048, 0x04EA12D7, 0x1D8E136D, 0x11970A40,
+    0x15AF1D01, 0x0E2706CD, 0x05E3096A, 0x01361295
+  },
+
+  {
+    0x0CF00427, 0x080C1754, 0x17AB1DB8, 0x0457018E,
+    0x06B41DDA, 0x15A90F06, 0x1D831B46, 0x0C9F01C6,
+    0x088E0295, 0x0083136B, 0x01E6009B, 0x056E1314,
+    0x080E1727, 0x16C81AE9, 0x1B9704D2, 0x00671329,
+    0x1BB817D5, 0x13AA1FD1, 0x016713DF, 0x01FD1BB1
+  },
+
+  {
+    0x18C30AC4, 0x16811B95, 0x079E1435, 0x1D521EC9,
+    0x150B0130, 0x0A78110B, 0x1C611614, 0x08DC13CA,
+    0x0E7B047E, 0x00A60B78, 0x066619EF, 0x079213D9,
+    0x199C1FAF, 0x1D8300BA, 0x02731192, 0x05BF1A81,
+    0x05F61A8F, 0x113B1117, 0x016A1398, 0x0196194B
+  },
+
+  {
+    0x1A64047E, 0x0AED0EF4, 0x0D0418E6, 0x1DDA177A,
+    0x0E650EB5, 0x1F23010B, 0x065407DB, 0x1D3D1581,
+    0x03A31DE9, 0x006C0EE7, 0x048C1F51, 0x05151D21,
+    0x12C9020E, 0x138E09E6, 0x0C75065E, 0x1BD814CC,
+    0x1A59133A, 0x0E7B1C77, 0x1E380B15, 0x003610A9
+  },
+
+  {
+    0x0F7B0C3C, 0x1C6A0355, 0x1DD41E9E, 0x15A01628,
+    0x0FC20A8C, 0x00F314A0, 0x0B520FBE, 0x101C154C,
+    0x18A811A2, 0x01930FDB, 0x1072112E, 0x02941EA1,
+    0x02320774, 0x19FB050C, 0x15AB122B, 0x19B005EE,
+    0x0EB40D7F, 0x105E198C, 0x16C900F2, 0x01970378
+  },
+
+  {
+    0x157A13CA, 0x18C21461, 0x042F1E3C, 0x1AEC0271,
+    0x09E51BE8, 0x00491782, 0x11A80882, 0x01EC17B5,
+    0x18E11ED7, 0x007706D3, 0x11490129, 0x172518D3,
+    0x1A9E19C0, 0x1B820DF7, 0x0A561D5A, 0x19B61345,
+    0x1D69033E, 0x10C611D2, 0x13A01A3D, 0x01201840
+  },
+
+  {
+    0x1BA71412, 0x04520548, 0x03EC1120, 0x05221889,
+    0x060E0051, 0x096404C8, 0x04CC09B0, 0x10290529,
+    0x187E0B47, 0x01B41964, 0x0FDA0789, 0x0C4217DA,
+    0x065B0ED9, 0x19F515FF, 0x09E71CE1, 0x00D01EEF,
+    0x0A1214F0, 0x02770791, 0x0EED1304, 0x00BB05BF
+  },
+
+  {
+    0x0F710192, 0x11390017, 0x0321020F, 0x04AB13EC,
+    0x1B4819A9, 0x11C7184C, 0x1182125E, 0x0BDA0A52,
+    0x030B0858, 0x00CC0827, 0x0F090C85, 0x0086191B,
+    0x041200C9, 0x0E9E0092, 0x1ED6080D, 0x06411DC7,
+    0x1FD4143F, 0x058419ED, 0x11561588, 0x00140912
+  },
+
+  {
+    0x012316B5, 0x08960D5C, 0x112C0EEE, 0x141C1170,
+    0x03F61031, 0x1ADF0145, 0x11681E7B, 0x14201ED0,
+    0x03E21972, 0x01CA07D5, 0x0E79143D, 0x179A1BF2,
+    0x0C270A25, 0x1DC105F0, 0x14650922, 0x13FD0681,
+    0x17CC0B3A, 0x02701E98, 0x115905BB, 0x00380C26
+  },
+
+  {
+    0x177315B0, 0x05501171, 0x1DD51A35, 0x02690BEB,
+    0x186B0670, 0x0495070F, 0x04FC0CC8, 0x1D4C07CB,
+    0x16CB0671, 0x002208F3, 0x0602026B, 0x0C980AF1,
+    0x07860E20, 0x18EB176A, 0x05740A4A, 0x16071E34,
+    0x04E801E8, 0x17D81D1E, 0x01C10FD8, 0x00DB029A
+  },
+
+  {
+    0x0B3E0459, 0x0BB71AC6, 0x04C70929, 0x106611CB,
+    0x05800148, 0x1002060A, 0x024B1770, 0x1CA00F14,
+    0x1C5502C4, 0x00410E1E, 0x02BE0277, 0x062E1778,
+    0x016E1306, 0x06711F96, 0x00DE1539, 0x1ED30811,
+    0x08D61EF5, 0x0ED71834, 0x124C1197, 0x01EB11BE
+  },
+
+  {
+    0x00C61AAD, 0x04CA0439, 0x06ED0273, 0x088C0972,
+    0x198E0739, 0x060601C8, 0x1A3610D4, 0x0BA110CA,
+    0x14960FD1, 0x00730840, 0x0CB01DEA, 0x0E821DA6,
+    0x18F701EF, 0x1E021D7D, 0x1D051A92, 0x11EA0044,
+    0x1BC40B20, 0x04E314CF, 0x0A5311A8, 0x01F700DD
+  },
+
+  {
+    0x144C0779, 0x1FDC0305, 0x044A060F, 0x031E1893,
+    0x083F124F, 0x15B81C9F, 0x1A630E60, 0x1280068E,
+    0x1D730822, 0x017C187E, 0x1A7F0770, 0x00250FD8,
+    0x1B761E7C, 0x1C17114C, 0x10DA0108, 0x09CA1F1F,
+    0x108816B3, 0x0B061DA2, 0x1D0E0D61, 0x0072004A
+  },
+
+  {
+    0x093606AE, 0x1942166F, 0x02D302C8, 0x0419133F,
+    0x0C211D7F, 0x03F70B2B, 0x1A4E0E18, 0x04A11C0C,
+    0x1B7B056B, 0x01D60D3B, 0x014C1BCE, 0x0F200D83,
+    0x0698066E, 0x1EC91FC5, 0x17A80639, 0x1C93175E,
+    0x043A1421, 0x10E0126E, 0x1ACF10B8, 0x014C12FF
+  },
+
+  {
+    0x1F9915BB, 0x0B4510ED, 0x1D0D000A, 0x0BA902BC,
+    0x106F1AF1, 0x15C30B8E, 0x053C031A, 0x14F100F0,
+    0x086C0CDC, 0x00900C96, 0x0794185C, 0x0E6A0B7B,
+    0x0DFD1993, 0x1AE3004A, 0x00341199, 0x130E17F3,
+    0x03F3100D, 0x06D3035D, 0x04CD1FEC, 0x000E01F8
+  },
+
+  {
+    0x1AA01F94, 0x11CD0680, 0x08831B1A, 0x180717FB,
+    0x067210F2, 0x1BB11523, 0x1AE5104E, 0x1E401388,
+    0x1C0E114F, 0x000D179A, 0x03000A5E, 0x00B908F1,
+    0x11A515CA, 0x149B161D, 0x10050A7A, 0x102F1EE1,
+    0x07C21A44, 0x0E6D0700, 0x08E60397, 0x01B51572
+  },
+
+  {
+    0x1EAC1E11, 0x089C1D83, 0x16AF18C9, 0x142200BE,
+    0x11C316CB, 0x107F0A95, 0x0A611FAD, 0x02170691,
+    0x0DC91320, 0x003D15F4, 0x01251889, 0x023409C0,
+    0x09A20A10, 0x1B951033, 0x002F04D0, 0x16D40A89,
+    0x1A900F0E, 0x04AF094A, 0x1F811217, 0x00740AC0
+  },
+
+  {
+    0x18A9165B, 0x0B8B062C, 0x017810B2, 0x1E940CE0,
+    0x1A7C1FBB, 0x1E20002D, 0x1DDD0F7D, 0x02ED0BC5,
+    0x088C12ED, 0x01AF1C18, 0x0D761821, 0x007F07BA,
+    0x03040E6D, 0x1F780F0B, 0x032319A7, 0x067F19F4,
+    0x05681148, 0x06170535, 0x0B2A1DC7, 0x000C0CFC
+  },
+
+  {
+    0x18E8043D, 0x1F850BF7, 0x0D310F20, 0x01B61635,
+    0x1F991024, 0x000B030E, 0x1E9109CA, 0x1B3E1BF1,
+    0x0A2E078D, 0x002B1FB9, 0x1E4C0CDA, 0x1D050216,
+    0x16020501, 0x1CBA011A, 0x1A0F0F80, 0x0C24043E,
+    0x1ECF1494, 0x07F00555, 0x15951875, 0x00950D6D
+  },
+
+  {
+    0x10C70DF1, 0x140B18A1, 0x08B319CD, 0x1E3B0FE4,
+    0x06CD1BBD, 0x167E1FC9, 0x072C1995, 0x1D321084,
+    0x15191290, 0x00AA15B1, 0x0CEC1264, 0x08C21FFF,
+    0x018B0DFA, 0x0594100D, 0x09AF167E, 0x0DEB14B0,
+    0x19591C2A, 0x0CDE079C, 0x047516D6, 0x00C70128
+  },
+
+  {
+    0x0E2C0892, 0x06FB090B, 0x15C61B2D, 0x13800EF7,
+    0x1F6C136A, 0x1F1D14C3, 0x054306A1, 0x1C060C4F,
+    0x0E07007D, 0x019D1B6E, 0x128915B4, 0x0E85150F,
+    0x0B26088F, 0x14E11B1F, 0x0F9909DA, 0x1490128C,
+    0x031F0119, 0x1BB91C35, 0x1A4310CD, 0x012F03A4
+  },
+
+  {
+    0x09CE0A0B, 0x0C150D22, 0x1A030C5D, 0x1C920DE3,
+    0x14AD0DEB, 0x0E311D90, 0x1DB21A79, 0x14440425,
+    0x015C0EA4, 0x012712E4, 0x1B6A1FDB, 0x0485031E,
+    0x126B0F07, 0x177C1450, 0x1BE20E4D, 0x1B6B0137,
+    0x153E0182, 0x036C1FBB, 0x00570814, 0x01A70C37
+  },
+
+  {
+    0x119C032B, 0x17610F63, 0x192E0C42, 0x1E700AC9,
+    0x19DB0D0E, 0x19F81892, 0x08C50F48, 0x0F930E16,
+    0x1E9C0EE4, 0x01BF0256, 0x0A8C05F0, 0x0BA10EF0,
+    0x0B5808BB, 0x034B0172, 0x0C0C1D35, 0x0A971A37,
+    0x01C108D1, 0x0C7A19AA, 0x0D2E0369, 0x00530713
+  },
+
+  {
+    0x048A09A5, 0x182818CA, 0x0C821EA4, 0x1E55121E,
+    0x079F1CCC, 0x02750584, 0x02EE073E, 0x00410086,
+    0x153F13CF, 0x019A1946, 0x14931D66, 0x03B01D11,
+    0x05DD0A48, 0x07250066, 0x0B541A3C, 0x1EA8010B,
+    0x0C871AA3, 0x0C0C1FF1, 0x087D10EE, 0x00211752
+  },
+
+  {
+    0x1620170A, 0x1E9A1EAA, 0x010F09BA, 0x1E0115D6,
+    0x036D0147, 0x10F315F6, 0x105313C3, 0x19AE1D63,
+    0x04C5060B, 0x010C1A66, 0x0C5206EB, 0x19A91696,
+    0x1C3B1AE7, 0x1D00061F, 0x0A140DED, 0x15E208D5,
+    0x051115D2, 0x0EBE10CB, 0x176504B0, 0x01811612
+  },
+
+  {
+    0x1AEC0953, 0x1DA01C74, 0x16DF048C, 0x0B2F187B,
+    0x0C331C34, 0x140E1198, 0x0E2D0D71, 0x0C390CDB,
+    0x0DBC1E68, 0x012707B8, 0x1B041C5B, 0x1CE11AD6,
+    0x114100E5, 0x0D2500A0, 0x0D431969, 0x17510EDE,
+    0x0BDD0C67, 0x15C21718, 0x0790152D, 0x00321289
+  },
+
+  {
+    0x16991571, 0x0B051177, 0x1DCA139F, 0x1AF207D3,
+    0x195C1A8E, 0x05471BC9, 0x012304E8, 0x1F580411,
+    0x123C07B3, 0x014F18D5, 0x1B3E1EA6, 0x175B01E8,
+    0x106E1005, 0x0C000676, 0x18791CDD, 0x0B26017F,
+    0x17BA06AA, 0x12E404C1, 0x16C51290, 0x012E07C7
+  },
+
+  {
+    0x02960DD7, 0x0388132E, 0x0CAE1451, 0x1BB21D6E,
+    0x0F5B0BF1, 0x0E551763, 0x00FB0835, 0x16521898,
+    0x023E1054, 0x00420485, 0x16780265, 0x0C480050,
+    0x0D150F4F, 0x0F7C0E9E, 0x0B230731, 0x1F241ECD,
+    0x07690D1A, 0x16B407C1, 0x0E7B0534, 0x011D05B8
+  },
+
+  {
+    0x1A1207B2, 0x1B720CEB, 0x1A97058A, 0x136014DC,
+    0x12460EBF, 0x0CDF1C7E, 0x19850429, 0x1D381237,
+    0x19370788, 0x00470781, 0x1CDA08B0, 0x12B108B5,
+    0x074705C6, 0x0AA91A45, 0x1911072E, 0x1C201A87,
+    0x0E5D1757, 0x18A70464, 0x014A1F71, 0x009F0298
+  },
+
+  {
+    0x18AC0BEA, 0x066D08FD, 0x0390025B, 0x02041DDD,
+    0x196400A1, 0x14161104, 0x097B0A40, 0x1A090853,
+    0x171A03D8, 0x0027096F, 0x05220502, 0x0D1817F9,
+    0x0BD9093B, 0x09861925, 0x02ED05D1, 0x0DB00963,
+    0x0B4718A2, 0x181301D4, 0x05270B43, 0x0168157A
+  },
+
+  {
+    0x0F5F050C, 0x0C2908EC, 0x15321640, 0x0ECE1AB2,
+    0x19FC0054, 0x169B047F, 0x09830048, 0x0B3A0DA5,
+    0x0F521198, 0x01200EEE, 0x1AFD0C7F, 0x0B3C1A67,
+    0x0480093A, 0x05270436, 0x18EF1549, 0x19CB1E8C,
+    0x1EDD0188, 0x05030E08, 0x13890350, 0x00AA1D3C
+  },
+
+  {
+    0x184A088A, 0x03640000, 0x1C5F0F11, 0x0A5D14B9,
+    0x136D1A18, 0x0BED0815, 0x0469119C, 0x0B380AA1,
+    0x184C0C4B, 0x01E30B85, 0x00DE157F, 0x1AA01EE2,
+    0x02A81757, 0x0F3D1521, 0x1EBE1B68, 0x0A53130A,
+    0x100609C8, 0x11580C33, 0x00170BD1, 0x01F60CE6
+  },
+
+  {
+    0x1E3C0E0C, 0x18B51CC7, 0x1ED41250, 0x1D2013DF,
+    0x14270EB8, 0x1FFD0039, 0x10BF0069, 0x10B91E96,
+    0x0C231032, 0x01BD05BC, 0x1F201E6F, 0x1576004F,
+    0x09470CCE, 0x08F01C93, 0x117B0745, 0x117A1B5C,
+    0x15FB1E2B, 0x1EF90DEE, 0x15871CBE, 0x001A1AE2
+  },
+
+  {
+    0x0D5E0AF5, 0x0C691306, 0x0A4319BE, 0x18000A46,
+    0x16070EBA, 0x17A20C2D, 0x0DFF0DD3, 0x04B8067C,
+    0x1D0902D6, 0x004916AC, 0x01030E3A, 0x16641F2D,
+    0x0151146A, 0x0E6A1541, 0x09190D33, 0x1D731AA0,
+    0x0D701B50, 0x13CD1637, 0x082E0B9F, 0x017C073D
+  },
+
+  {
+    0x1E6D0FE6, 0x09C10972, 0x06AD0E85, 0x00680D4D,
+    0x078F0981, 0x081E0E4F, 0x13980583, 0x04F2129C,
+    0x04640CFD, 0x00E60A54, 0x1C7419CD, 0x0B101A94,
+    0x149C0E71, 0x11EC1478, 0x0A4A0D5A, 0x12960818,
+    0x10410616, 0x1C790BA3, 0x17FE040B, 0x00121C69
+  },
+
+  {
+    0x0AE80D81, 0x08720D11, 0x1E771566, 0x0B2E0FE3,
+    0x0086024D, 0x1671098C, 0x0962037B, 0x088B1A98,
+    0x007412F1, 0x009D1E6A, 0x17220719, 0x0C911887,
+    0x00B30A9A, 0x19411477, 0x197B02FE, 0x0E2F02E8,
+    0x01EC1909, 0x0E6415A7, 0x16C41FF6, 0x01D9028E
+  },
+
+  {
+    0x04140F9A, 0x01AD0B24, 0x18E707CE, 0x004B1254,
+    0x0D951D1A, 0x16210AE7, 0x0DA2012B, 0x09811970,
+    0x066D0EEE, 0x00701D46, 0x079B08AA, 0x1CAF13A6,
+    0x1F3D087D, 0x04570E4A, 0x090F1579, 0x02E81202,
+    0x0AA2099F, 0x02051597, 0x03E619E3, 0x00EE1ED0
+  },
+
+  {
+    0x1A370AA6, 0x125503B9, 0x12C9109D, 0x10AB102C,
+    0x1FF40613, 0x0B1703AB, 0x0B791FF6, 0x0A3C049A,
+    0x18E01A3C, 0x01121BF3, 0x029C0F16, 0x1CC21FBF,
+    0x117308D8, 0x11EC0424, 0x08E613C3, 0x0DD51072,
+    0x0281145D, 0x0BA40613, 0x160D0420, 0x00C31FD0
+  },
+
+  {
+    0x118509A6, 0x08361760, 0x0DDC17B7, 0x17310FCA,
+    0x1FAB19DE, 0x11FF1665, 0x13890779, 0x163C04E5,
+    0x02CF14FC, 0x00DB185A, 0x13911B7F, 0x0F47037A,
+    0x09C71C6B, 0x1E5E13EC, 0x03BE13E0, 0x02A11E81,
+    0x03C713AA, 0x17DD166D, 0x1C3B09B0, 0x00B70585
+  },
+
+  {
+    0x0C210031, 0x01DD12C7, 0x0DE3066D, 0x0DD416BB,
+    0x0D7D09C6, 0x155A05B4, 0x08AD187F, 0x0131059D,
+    0x05A01584, 0x01B009F2, 0x052100ED, 0x16F70C72,
+    0x12DE15E1, 0x157B10A3, 0x1C75003C, 0x08A30235,
+    0x06C314FD, 0x19F203F1, 0x00BE022E, 0x005E1987
+  },
+
+  {
+    0x147D19EF, 0x15FD0DCC, 0x18F91DCE, 0x0C460472,
+    0x11A318E0, 0x07C010BA, 0x1DF319E0, 0x151F0EDF,
+    0x0D5108A8, 0x01F60092, 0x07701B8B, 0x0976112E,
+    0x1409150B, 0x13E71454, 0x1072140E, 0x135404E8,
+    0x128A0E10, 0x17871923, 0x119C1C5F, 0x002E0BD1
+  },
+
+  {
+    0x1BE71BFE, 0x1AA91E28, 0x1A541DD8, 0x1FDF03FE,
+    0x0BD803CD, 0x080E037D, 0x1A380522, 0x08C21B28,
+    0x128C19BF, 0x00161964, 0x1221054B, 0x1C61163B,
+    0x12781CE2, 0x1FA8056E, 0x15221C28, 0x1D0619AA,
+    0x18E90BF5, 0x1E620F30, 0x175A19B2, 0x011C0926
+  },
+
+  {
+    0x17C91781, 0x082A0755, 0x09121887, 0x1B440A24,
+    0x19D9008C, 0x07EB0D6B, 0x0FA51015, 0x0217127E,
+    0x001A057C, 0x00C10AA9, 0x18060D5E, 0x057B0800,
+    0x1420152A, 0x16141D0D, 0x0F22103B, 0x18E21630,
+    0x00221FE7, 0x0C55078D, 0x06B815AC, 0x01B90A38
+  },
+
+  {
+    0x1B0E0F42, 0x07B90224, 0x0EE80A42, 0x12390844,
+    0x112C1533, 0x0A121CCF, 0x0DFB1224, 0x05D51B34,
+    0x053A1E55, 0x00C50A3E, 0x0FDA1704, 0x034F0713,
+    0x02A30A6A, 0x1C940AAF, 0x110A1F2D, 0x1B9909F5,
+    0x1F6F0744, 0x1AEB1FB8, 0x0E6A093E, 0x0177164D
+  },
+
+  {
+    0x0C7D1F6A, 0x16F019EB, 0x04E80228, 0x174907C4,
+    0x015A0DCC, 0x19D40517, 0x0F6E1A56, 0x0F3000BB,
+    0x0020052D, 0x00670B93, 0x189003AF, 0x1C201477,
+    0x0C7C1487, 0x1B060310, 0x11A11ED3, 0x092B1AA1,
+    0x0D6C14E0, 0x10490DC5, 0x162F0945, 0x018F0296
+  },
+
+  {
+    0x049A1E5F, 0x000E06A3, 0x01E01368, 0x123E1615,
+    0x13EB164E, 0x1CA517D7, 0x1B431F0E, 0x03A31536,
+    0x11071ECF, 0x00FD0B47, 0x1F4D0684, 0x19730517,
+    0x18050453, 0x07F6196E, 0x08E506C4, 0x0A2C0C35,
+    0x01CD08AD, 0x1AC81664, 0x0F6C17C7, 0x001909D0
+  },
+
+  {
+    0x02DF076B, 0x1C28107D, 0x071E1614, 0x18021DF6,
+    0x152F0F3E, 0x0BCE0204, 0x13100654, 0x178D038D,
+    0x0D65025E, 0x000B1549, 0x0B74027A, 0x060806E4,
+    0x0026011C, 0x01501A2F, 0x0BEA1AB0, 0x1D011A91,
+    0x0FC00B11, 0x0A8A1C4A, 0x02A402AB, 0x00CC0F22
+  },
+
+  {
+    0x01340106, 0x01DE0C31, 0x16B800EA, 0x1E73009F,
+    0x048117B2, 0x107E18C4, 0x0DA702F5, 0x00CF030F,
+    0x0A590AB1, 0x002108FD, 0x037016C5, 0x0FBA0ADC,
+    0x09210709, 0x11351C59, 0x0EA3170A, 0x0E1C0504,
+    0x0A2815E3, 0x031D1E54, 0x18280DA5, 0x015A08DC
+  },
+
+  {
+    0x0433189A, 0x17400A07, 0x028611F5, 0x1574155C,
+    0x1A9E033F, 0x002F022C, 0x0A4B0634, 0x0DE70D07,
+    0x00F50163, 0x006F1EFD, 0x1BD80609, 0x0C770543,
+    0x06A81077, 0x005512AA, 0x15FA10BC, 0x1CC30C71,
+    0x12E01736, 0x0CC0170A, 0x0387146A, 0x0152045B
+  },
+
+  {
+    0x1B7910C4, 0x1200068C, 0x120D0599, 0x076A012D,
+    0x126C0B3C, 0x02D21AE0, 0x0D2A1073, 0x1FC50CE8,
+    0x1E870650, 0x00C01697, 0x11250D94, 0x179E0D11,
+    0x0DE71E45, 0x1C280BFC, 0x19B00522, 0x0B070C82,
+    0x034813B0, 0x146C043B, 0x0EE503E4, 0x010E0013
+  },
+
+  {
+    0x014E13D7, 0x08ED0F2C, 0x1249094B, 0x1971020E,
+    0x19AA1100, 0x05D30876, 0x0A020648, 0x06D60471,
+    0x1F5E1B08, 0x01C6177D, 0x1D2E1DB7, 0x0B4F1D5A,
+    0x054302DB, 0x0B6E0BBE, 0x1C901BC0, 0x1BB91453,
+    0x0BFB03E8, 0x059C075A, 0x10B81935, 0x000C11BF
+  },
+
+  {
+    0x05630F86, 0x1F810DC6, 0x0EF4063D, 0x06FA014C,
+    0x1F171B95, 0x00261AB8, 0x0F57113D, 0x1A5E1D20,
+    0x0A540E4B, 0x01C006BC, 0x07CB14EC, 0x1C9F07E2,
+    0x1991149E, 0x18D20ABB, 0x0EBB04A4, 0x1C070BEA,
+    0x1E5A03F1, 0x02040510, 0x1CF3136E, 0x018111EF
+  },
+
+  {
+    0x1DAB1932, 0x0F251466, 0x08A6072F, 0x08A01451,
+    0x18DF0D98, 0x098A032D, 0x15830A64, 0x19DB1693,
+    0x03420EFD, 0x0104152E, 0x0ED61ADE, 0x16E91672,
+    0x0B0A147B, 0x1D960F65, 0x196A08E4, 0x02B508A7,
+    0x1E4E0F1C, 0x057106B7, 0x02331846, 0x00190E88
+  },
+
+  {
+    0x1CFA0BFE, 0x1B350ED1, 0x03B409B0, 0x042B18F1,
+    0x01F3190D, 0x0EB8190F, 0x16A20CD3, 0x1B880E8E,
+    0x1B2B0AC0, 0x013B1EEE, 0x0E3B02EC, 0x1FF61E55,
+    0x12F01DA6, 0x063B19E2, 0x1891094F, 0x1AE01218,
+    0x11160684, 0x1805182B, 0x01AB0C18, 0x00C20450
+  },
+
+  {
+    0x0B6E11ED, 0x01B10236, 0x16351236, 0x0AA10A4D,
+    0x18DC19CC, 0x0C131E4F, 0x19511F58, 0x1278110D,
+    0x0A520DC9, 0x00151F08, 0x15F9196F, 0x11AD11E9,
+    0x1AF10BA0, 0x0D151C88, 0x0D361445, 0x1BD810FB,
+    0x10E1178B, 0x0FC3178F, 0x149619CA, 0x00010E02
+  },
+
+  {
+    0x1D5C0183, 0x0A140AB1, 0x15BD1067, 0x1AD21FD3,
+    0x10210DD3, 0x1A1D1E9E, 0x026B1923, 0x06EA0D33,
+    0x043E1979, 0x01FE0DB9, 0x10370132, 0x1BFE18D3,
+    0x037F0104, 0x04CD145C, 0x0CBB13AE, 0x1FFD0EC0,
+    0x14C81813, 0x129F1E5C, 0x0E361FC6, 0x00B2001B
+  },
+
+  {
+    0x00581061, 0x179E0677, 0x0A4602FF, 0x15A20E6B,
+    0x14230730, 0x05940F09, 0x1EAF1201, 0x14B30B2E,
+    0x1AF40855, 0x01D710F4, 0x1C9F0742, 0x089505D6,
+    0x1F1D0186, 0x1EBF03D2, 0x086D0658, 0x1FC60962,
+    0x1E1B1853, 0x0606012C, 0x160B01CE, 0x00A5042F
+  },
+
+  {
+    0x0FA00F6F, 0x15A9074F, 0x137A1E6F, 0x1BF91294,
+    0x0C421DD6, 0x143001E8, 0x180707C4, 0x1AB40702,
+    0x18591404, 0x007F1B35, 0x1C1618D7, 0x17FC1219,
+    0x163E1E77, 0x192E0557, 0x1AA50B18, 0x06400901,
+    0x06DB11FB, 0x0AC011DF, 0x0B6307BA, 0x01081055
+  },
+
+  {
+    0x0EBC0DD4, 0x129C007A, 0x17CD1386, 0x1F761630,
+    0x1FC20FBB, 0x046911CF, 0x09811D3A, 0x11071CEF,
+    0x1F2F1F16, 0x01040E5A, 0x04361F4E, 0x19E71F7A,
+    0x0AD3056E, 0x17B005C9, 0x1E561118, 0x15460E36,
+    0x14930BA1, 0x103F1EE9, 0x0B0D0A19, 0x005419DE
+  },
+
+  {
+    0x0FA60C58, 0x02B20301, 0x0C64075A, 0x17941A7D,
+    0x121F1076, 0x12F01B0E, 0x0D4919B7, 0x01810A2B,
+    0x0B0C15A5, 0x00741D63, 0x110A15EF, 0x0908186E,
+    0x00D61223, 0x127D0FF9, 0x1ACC05F5, 0x03F6173D,
+    0x1FD61559, 0x048312B7, 0x16E7054E, 0x01710246
+  },
+
+  {
+    0x07E005CD, 0x02A21E09, 0x0BDF0181, 0x088104B6,
+    0x116313FD, 0x17D70C41, 0x0D460BA2, 0x1B05096D,
+    0x141F0E17, 0x00021F30, 0x17740FDB, 0x0E8E0C10,
+    0x1F220199, 0x1D11050C, 0x1F8B0121, 0x05FE0679,
+    0x07550D5A, 0x119509D8, 0x032501EC, 0x01AE068A
+  },
+
+  {
+    0x1A1501BF, 0x03951CDF, 0x1AC3026F, 0x0DD00BC9,
+    0x06551D26, 0x15E9013D, 0x189B15B6, 0x1CDF0825,
+    0x16600A43, 0x01571CD5, 0x0E2F00F8, 0x0A0705A4,
+    0x1D621C7B, 0x1FC70A3B, 0x1DD71618, 0x0B440C5B,
+    0x10FF0991, 0x06BA0F2C, 0x11D80F26, 0x002A1972
+  },
+
+  {
+    0x0FDB064D, 0x157E1B5E, 0x0D50101B, 0x16B70596,
+    0x050A0B4A, 0x0C9B0A98, 0x12601BDB, 0x1B7015BF,
+    0x04EC138E, 0x01D412C8, 0x148512F4, 0x055E1CCC,
+    0x1B970E32, 0x1AE504AB, 0x0A5D0CDE, 0x03C10761,
+    0x0C120E4B, 0x003607C0, 0x01C60AA0, 0x00901700
+  },
+
+  {
+    0x00490020, 0x1CBF0A1F, 0x18C61954, 0x1933069C,
+    0x1832191E, 0x1F871A96, 0x08301516, 0x08181F0D,
+    0x0CC61A3E, 0x019F0C4D, 0x137B0EB1, 0x0F9801A0,
+    0x0ADD1B44, 0x1CD9112C, 0x05C8176B, 0x0C2B067B,
+    0x0271121C, 0x19CD0C08, 0x05EA0E9F, 0x00CC144B
+  },
+
+  {
+    0x048F0A5A, 0x1940105A, 0x19E40F59, 0x180B084B,
+    0x05600D2C, 0x1F5B1B2D, 0x0139032E, 0x0CA014BE,
+    0x047E03A8, 0x00E80E81, 0x0D541765, 0x0A900E3E,
+    0x0DBB0D01, 0x1D8207FB, 0x1D2A08E7, 0x03CE1F21,
+    0x133F0D66, 0x0B7C1042, 0x0CF21E16, 0x01480E53
+  },
+
+  {
+    0x096E1F9F, 0x110A0AC0, 0x05CB0279, 0x1D371D3F,
+    0x0EAA139B, 0x01181ADA, 0x053C1B9B, 0x0C1B0466,
+    0x1E5D0370, 0x01C40EF4, 0x05350401, 0x1EA5125A,
+    0x0B820CC7, 0x096A1C24, 0x16FB097F, 0x0A290AEF,
+    0x14D80B87, 0x194B0F10, 0x19F91212, 0x013B1F62
+  },
+
+  {
+    0x053A0D26, 0x05480E21, 0x1F7704C8, 0x0B3B1127,
+    0x1CA71C77, 0x075E0CE9, 0x02680CA7, 0x07ED0698,
+    0x062C1999, 0x014400A3, 0x19E906C8, 0x04281DDC,
+    0x0A17006D, 0x0CE61C12, 0x0CBF0A28, 0x02471F8B,
+    0x1EAF1B5F, 0x18E1189B, 0x166302C4, 0x00331459
+  },
+
+  {
+    0x1DFF0286, 0x04B9186A, 0x168D04AF, 0x18FF137B,
+    0x0D291341, 0x1A4119DB, 0x0E9A064C, 0x07A6172C,
+    0x19F20AB2, 0x00AD17B3, 0x09250AFB, 0x064009F9,
+    0x1C311DD8, 0x1CA01690, 0x0F70102B, 0x08C71E4D,
+    0x135F1FAD, 0x077217E6, 0x11C204F4, 0x018907AB
+  },
+
+  {
+    0x1C4A0F9B, 0x0C171622, 0x1122159E, 0x12761442,
+    0x1BBE00A8, 0x188B1A7C, 0x099E1EDA, 0x0F770BD8,
+    0x02731E0A, 0x00FF023F, 0x08DD10FD, 0x02BB0A9D,
+    0x137408C6, 0x02AA188F, 0x03251A76, 0x17B117AB,
+    0x1F801614, 0x16A20FDA, 0x0F811997, 0x00D1118D
+  },
+
+  {
+    0x1BA91698, 0x0BE90779, 0x02EE18D1, 0x01821989,
+    0x1D8E16F2, 0x05DD09EC, 0x056200B9, 0x01240A66,
+    0x10580C3C, 0x01CB1207, 0x0D4F076A, 0x194C0CE1,
+    0x15661F65, 0x16710295, 0x193B19B4, 0x1DF60301,
+    0x0DD0189E, 0x05AA1501, 0x140D07D6, 0x00CB0478
+  },
+
+  {
+    0x1EA008B4, 0x112D145A, 0x17CA148C, 0x143311AE,
+    0x023E0E08, 0x110F1BAF, 0x06EE0E9A, 0x131B053D,
+    0x03450E73, 0x000811FE, 0x05D50537, 0x112B1FA7,
+    0x1F991B70, 0x003C057B, 0x1EE41356, 0x054F110C,
+    0x0E0E108A, 0x0995100D, 0x077F10FB, 0x00BE0DF3
+  },
+
+  {
+    0x03E1029B, 0x095501E9, 0x170D1F5A, 0x172204DB,
+    0x10CE1C19, 0x03C10309, 0x0EF614C5, 0x1B001075,
+    0x10A20F85, 0x00830AD1, 0x1C0806CA, 0x1BA3151C,
+    0x057F1F02, 0x1E850ADA, 0x19060C8F, 0x187918D9,
+    0x00291E73, 0x1C111707, 0x122113F9, 0x0090145D
+  },
+
+  {
+    0x1FB51E1F, 0x01030AED, 0x17D801E3, 0x12811629,
+    0x1EBB168C, 0x032014A0, 0x10060753, 0x1AE701C3,
+    0x1CAD0E64, 0x01421DB0, 0x1D1A178C, 0x10A10F07,
+    0x128309E5, 0x19CC047F, 0x00431565, 0x1FDD1A97,
+    0x15CC04B9, 0x08BE0546, 0x0444147B, 0x013D0F7B
+  },
+
+  {
+    0x1C971BEC, 0x18BB082D, 0x05651587, 0x0D7D1A7A,
+    0x1ACC0635, 0x09CA171C, 0x131D14D2, 0x0AC907EA,
+    0x02020C98, 0x019D1EE1, 0x004906DF, 0x01FC0D15,
+    0x06F411C2, 0x0FCF070E, 0x13100448, 0x110209C3,
+    0x09A40A95, 0x150C0DED, 0x1D780767, 0x01480322
+  },
+
+  {
+    0x029B117D, 0x1D911C37, 0x1C2F04F0, 0x00DD0ECE,
+    0x1A171C60, 0x0CF21DFF, 0x1CB10D20, 0x1CB00E57,
+    0x0EAE150A, 0x00C3052F, 0x027D08AA, 0x042F030B,
+    0x0BB4076C, 0x09E70AFC, 0x09A9077D, 0x0BD11614,
+    0x116D158E, 0x066C0928, 0x0C6D1F90, 0x015E1926
+  },
+
+  {
+    0x1DF71628, 0x0568049F, 0x15DA0C3C, 0x0AC00022,
+    0x15341C77, 0x1A7404DD, 0x092118ED, 0x141018FD,
+    0x024B1688, 0x00741BD3, 0x137A1476, 0x142C1044,
+    0x05AC18DC, 0x19CB19E4, 0x1BEF0645, 0x0A241465,
+    0x08D11274, 0x0E7F0D6D, 0x111F1799, 0x00F21AAE
+  },
+
+  {
+    0x1C500575, 0x052414AD, 0x0FB11061, 0x13A00C7A,
+    0x13651901, 0x03E40A64, 0x09421440, 0x0C32100E,
+    0x0AFB0ECA, 0x01B41FEA, 0x1A31068C, 0x1E2D0ED8,
+    0x0E5305AB, 0x0C111B17, 0x0D6104E5, 0x19250F0D,
+    0x044E145B, 0x130B05CA, 0x16DD1BD1, 0x00580BBF
+  },
+
+  {
+    0x1A3F1ECA, 0x163705B4, 0x0F25089E, 0x09F9168C,
+    0x0E46078F, 0x16BD0FB9, 0x046608C9, 0x168A1E65,
+    0x0A1B0F69, 0x00AD0549, 0x1539167A, 0x167D1DF6,
+    0x036616A3, 0x1A871ABA, 0x195F0CF2, 0x153712C5,
+    0x1A841A68, 0x186D1998, 0x01F51BBB, 0x018C1C15
+  },
+
+  {
+    0x05E409E8, 0x1249058A, 0x125617B2, 0x0BC61DB7,
+    0x158D0C12, 0x0B22148B, 0x1B3003BF, 0x0B6D0D1C,
+    0x133B1C77, 0x01380B18, 0x1150143B, 0x03BC1963,
+    0x1A4D1CA9, 0x127B11EA, 0x1953026E, 0x0FF711E3,
+    0x1901165E, 0x0DF20218, 0x0E2B0DF1, 0x013B172B
+  },
+
+  {
+    0x04CD19C9, 0x037F1424, 0x06ED0413, 0x0E1D0E14,
+    0x09DF111E, 0x069E14C8, 0x13821C3B, 0x09AF0508,
+    0x0290082E, 0x00430E8F, 0x013F0BE9, 0x04F900F9,
+    0x03DC076A, 0x1A8B1BAE, 0x09701D8C, 0x052A1446,
+    0x1D530E57, 0x179207B3, 0x0B60077C, 0x014515E4
+  },
+
+  {
+    0x0C0E06CD, 0x1C9A1B8D, 0x1AF608CB, 0x07DF150F,
+    0x12F80709, 0x02AE0544, 0x1F931F8B, 0x05A90CBF,
+    0x0D9C176D, 0x007A164A, 0x05B20B81, 0x1B811080,
+    0x068F0171, 0x029E00FF, 0x01B714B1, 0x0F40053D,
+    0x028D1789, 0x04120045, 0x1BDD173F, 0x004E1FE9
+  },
+
+  {
+    0x1AE50B24, 0x1BD0152B, 0x025B16FC, 0x0E8819E8,
+    0x06A708AA, 0x179E0F4B, 0x08A61597, 0x19551853,
+    0x07BD00AB, 0x018A1B61, 0x0F601DD7, 0x0C110C7A,
+    0x0A7B0937, 0x1D7019C4, 0x16FA1054, 0x1BBF04E9,
+    0x009D1C56, 0x091F11AC, 0x182E1D3E, 0x00B71FD3
+  },
+
+  {
+    0x075C1FA6, 0x0E9B097A, 0x0AEC1A68, 0x1B2B154F,
+    0x143817F1, 0x0EEA1082, 0x0AEE015E, 0x0EEF19C9,
+    0x11C61119, 0x00E31349, 0x054F1C16, 0x06C418AB,
+    0x1B1D1ED6, 0x1EED04DD, 0x1A8B11C1, 0x06FD11DE,
+    0x18C601D0, 0x10420C6F, 0x16F51F3B, 0x00C70D20
+  },
+
+  {
+    0x0B6F0321, 0x123C199F, 0x1B9700BC, 0x11EE11A5,
+    0x17D708DD, 0x1DE0182D, 0x15540254, 0x02730587,
+    0x0CAE1DB3, 0x01E81AEB, 0x109013C9, 0x010B01F0,
+    0x158E0927, 0x1A0F1427, 0x008E1287, 0x1D4A0BDA,
+    0x0C0A1D86, 0x02141E9E, 0x1C970DDB, 0x016A12ED
+  },
+
+  {
+    0x1B680AE6, 0x188A1D98, 0x177602D7, 0x016F1F2F,
+    0x1A59187E, 0x006E01F2, 0x1CD41D01, 0x1441128F,
+    0x00881398, 0x01A40368, 0x1DD80455, 0x1F581E1D,
+    0x14E70FD1, 0x1AF10BEF, 0x02E60544, 0x1175129D,
+    0x02361917, 0x1BAF1456, 0x0A120901, 0x006009C7
+  },
+
+  {
+    0x181B1401, 0x15ED17D2, 0x0E961EE0, 0x031E12E1,
+    0x02AE0D36, 0x127F0C37, 0x11AB0464, 0x0080153A,
+    0x17B401BD, 0x015B1F3A, 0x18EE1F0D, 0x1BF307D6,
+    0x1DDC1342, 0x14EC0174, 0x097F0483, 0x073C0CF6,
+    0x16EA06A6, 0x07A5036A, 0x158C1162, 0x0136136A
+  },
+
+  {
+    0x1E28178A, 0x10171640, 0x0DCE0E79, 0x06AE0BCD,
+    0x02521ED0, 0x05DA0D13, 0x04A21C03, 0x01650170,
+    0x0F5C12A4, 0x01B9167D, 0x0F36089A, 0x05F706D4,
+    0x1DDD058D, 0x1F0E1776, 0x01F90BBA, 0x1F6108A1,
+    0x1CBC11CF, 0x1348192A, 0x04D31BAD, 0x01C20BB0
+  },
+
+  {
+    0x1C4E14BD, 0x1BED06C2, 0x1D421048, 0x1DF61C3E,
+    0x11110888, 0x19C005FD, 0x10621F6C, 0x10AB1112,
+    0x0EC60264, 0x01D7111A, 0x1E5A16BB, 0x04170775,
+    0x15760B64, 0x093D097D, 0x09271723, 0x0DDF19AA,
+    0x0CAB0D88, 0x0C691F8D, 0x1BC20B12, 0x0175197E
+  },
+
+  {
+    0x1E500BC1, 0x166D095E, 0x0AF811BC, 0x19D81AB5,
+    0x06D61F6D, 0x0101183E, 0x10F40E76, 0x0F581677,
+    0x1F151256, 0x00D0075A, 0x11FA0FCB, 0x03DB151D,
+    0x08781DEB, 0x0DDC161E, 0x01530A76, 0x1E29186C,
+    0x1F90166C, 0x10FE0C98, 0x1C960480, 0x003B1F2A
+  },
+
+  {
+    0x1C0C09C5, 0x071A149D, 0x11371C0C, 0x18B40804,
+    0x1347181B, 0x0BD21D2E, 0x07451A33, 0x143A0E24,
+    0x00C41B23, 0x016C18D1, 0x11DB1AF3, 0x1D3D0076,
+    0x0BF207CD, 0x144D1291, 0x16BF0854, 0x1CF40F57,
+    0x14C90BC8, 0x08AB01B4, 0x131611DA, 0x019016CC
   },
 
   {
-    0x1B341978, 0x16911F11, 0x0D9A1A60, 0x1C4E1FC8,
-    0x1E040969, 0x096A06B0, 0x091C0030, 0x09EF1A29,
-    0x18C40D03, 0x00F91C9E, 0x13C313D1, 0x096F0748,
-    0x011419E0, 0x1CC713A6, 0x1DD31DAD, 0x1EE80C36,
-    0x1ECD0C69, 0x1A0800A4, 0x08861B8E, 0x000E1DD5
+    0x12EF14EB, 0x16CB02BB, 0x1751032F, 0x052E1686,
+    0x04E402E9, 0x00C703CE, 0x1CED0889, 0x183E1941,
+    0x191A1A2C, 0x01590756, 0x05B2036B, 0x02A804E9,
+    0x059904C3, 0x089C08B0, 0x08C11B44, 0x02ED0648,
+    0x09000568, 0x12A00FFF, 0x1A240DBB, 0x00D90EC2
   },
 
   {
-    0x173F1D6C, 0x02CC06F1, 0x14C21FB4, 0x043D1EB6,
-    0x0F3606B7, 0x1A971C59, 0x1BF71951, 0x01481323,
-    0x068D0633, 0x00BD12F9, 0x13EA1032, 0x136209E8,
-    0x1C1E19A7, 0x06C7013E, 0x06C10AB0, 0x14C908BB,
-    0x05830CE1, 0x1FEF18DD, 0x00620998, 0x010E0D19
+    0x109800A9, 0x12FB0677, 0x1C39161F, 0x04B00E54,
+    0x020C0412, 0x16181197, 0x124F032D, 0x08F71A7C,
+    0x176E1C24, 0x01DF0973, 0x00C81D51, 0x061B069B,
+    0x1B5209AB, 0x1DB20016, 0x16DF14DD, 0x01CC1C3F,
+    0x1EB51030, 0x1AE51A42, 0x1C0E08EF, 0x00570585
   },
 
   {
-    0x18180852, 0x0604111A, 0x0B771509, 0x1B6F0156,
-    0x00181FE2, 0x1DCC0AF4, 0x16EF0659, 0x11F70E80,
-    0x11A912D0, 0x01C414D2, 0x027618C6, 0x05840FC6,
-    0x100215C4, 0x187E0C3B, 0x12771C96, 0x150C0B5D,
-    0x0FF705FD, 0x07981C67, 0x1AD20C63, 0x01C11C55
+    0x12041EB3, 0x186C0625, 0x198D102A, 0x08C90B15,
+    0x1548040E, 0x01D1061E, 0x1A271B88, 0x1F6C1C01,
+    0x16C60571, 0x006F0DC9, 0x0ABE10F1, 0x12D4169F,
+    0x1A9502AD, 0x04610A3B, 0x1EE219D3, 0x0A361AFA,
+    0x100B1547, 0x190106A7, 0x097A09E1, 0x017E037E
   },
 
   {
-    0x1E8113ED, 0x0A940370, 0x12920215, 0x1FA31D6F,
-    0x1F7C0C82, 0x10CD03F7, 0x02640560, 0x081A0B5E,
-    0x1BD21151, 0x00A21642, 0x0D0B0DA4, 0x0176113F,
-    0x04440D1D, 0x001A1360, 0x1068012F, 0x1F141E49,
-    0x10DF136B, 0x0E4F162B, 0x0D44104A, 0x01C1105F
+    0x0FC01C9E, 0x1D340F4E, 0x0A350E86, 0x008E1E0E,
+    0x0DA31A90, 0x08390CD5, 0x1D2110F5, 0x1BE61DCA,
+    0x1FD50C3F, 0x00B703B8, 0x1AD70687, 0x0E3F1698,
+    0x03E91DF3, 0x06FA0C2F, 0x1BAA029F, 0x15211EC8,
+    0x0AC619B0, 0x0BD21703, 0x01B50C1D, 0x00B215D5
   },
 
   {
-    0x011411A9, 0x01551A4F, 0x0ADA0C6B, 0x01BD0EC8,
-    0x18120C74, 0x112F1778, 0x099202CB, 0x0C05124B,
-    0x195316A4, 0x01600685, 0x1E3B1FE2, 0x189014E3,
-    0x0B5E1FD7, 0x0E0311F8, 0x08E000F7, 0x174E00DE,
-    0x160702DF, 0x1B5A15BF, 0x03A11237, 0x01D01704
+    0x03670683, 0x043A1903, 0x15850B5D, 0x04A1001D,
+    0x075506F7, 0x0C8D1EFB, 0x0EC407C8, 0x07FE1420,
+    0x11F21AF1, 0x01390E90, 0x0A7E03C0, 0x05F8127D,
+    0x038C19BB, 0x0E641B17, 0x13CF1372, 0x0B9B1C2B,
+    0x178002F1, 0x02FC0016, 0x08510AA0, 0x00EA1886
   },
 
   {
-    0x0C3D12A3, 0x0C501C0C, 0x17AD1300, 0x1715003F,
-    0x03F719F8, 0x18031ED8, 0x1D980667, 0x0F681896,
-    0x1B7D00BF, 0x011C14CE, 0x0FA000B4, 0x1C3501B0,
-    0x0D901C55, 0x06790C10, 0x029E0736, 0x0DEB0400,
-    0x034F183A, 0x030619B4, 0x0DEF0033, 0x00E71AC7
+    0x0D050F19, 0x0EFD1F01, 0x16100647, 0x1DAC0A4A,
+    0x0E1E0DA2, 0x081B0506, 0x0AC90E56, 0x05C31FC9,
+    0x08ED14BB, 0x00A6022E, 0x18A204CE, 0x1A6E086F,
+    0x03A50BC5, 0x119D150A, 0x072516BD, 0x175C00A4,
+    0x085C1AFA, 0x03150CB5, 0x193207C0, 0x00D6192F
   },
 
   {
-    0x1B7D1393, 0x1B3B1076, 0x0BED1B4D, 0x13011F3A,
-    0x0E0E1238, 0x156A132B, 0x013A02D3, 0x160A0D01,
-    0x1CED1EE9, 0x00C5165D, 0x184C157E, 0x08141A83,
-    0x153C0DA5, 0x1ED70F9D, 0x05170D51, 0x02CF13B8,
-    0x18AE1771, 0x1B04113F, 0x05EC11E9, 0x015A16B3
+    0x1BB60E56, 0x1D380CAC, 0x10C91580, 0x1C531F5B,
+    0x1BEB100E, 0x1DD8159A, 0x1EA107A1, 0x08B4184A,
+    0x122B01EA, 0x01D31DCE, 0x02480971, 0x02F50A02,
+    0x0D690556, 0x157B0F28, 0x02521AA3, 0x07090DAB,
+    0x1F581A68, 0x08891162, 0x171007E4, 0x00EC0C8F
   },
 
   {
-    0x04A41EE0, 0x1D1412E4, 0x1C591D79, 0x118511B7,
-    0x14F00ACB, 0x1AE31E1C, 0x049C0D51, 0x016E061E,
-    0x1DB71EDF, 0x01D41A35, 0x0E8208FA, 0x14441293,
-    0x011F1E85, 0x1D54137A, 0x026B114F, 0x151D0832,
-    0x00A50964, 0x1F9C1E1C, 0x064B12C9, 0x005409D1
+    0x02511B64, 0x1EA914C3, 0x01961E88, 0x01B91872,
+    0x17BB015B, 0x0E7A163F, 0x13D61B09, 0x1E2E0CBD,
+    0x10E603CE, 0x016501C7, 0x14BA169E, 0x07A5089E,
+    0x0A9D0ED8, 0x16950D67, 0x0E881912, 0x086B0463,
+    0x1B26079A, 0x0C980C41, 0x134F0F27, 0x019414DE
   },
 
   {
-    0x062B123F, 0x0C0D0501, 0x183704C3, 0x08E31120,
-    0x0A2E0A6C, 0x14440FED, 0x090A0D1E, 0x13271964,
-    0x0B590A3A, 0x019D1D9B, 0x05780773, 0x09770A91,
-    0x0F770CA3, 0x053F19D4, 0x02C80DED, 0x1A761304,
-    0x091E0DD9, 0x15D201B8, 0x151109AA, 0x010F0198
+    0x00921DEE, 0x0AD71224, 0x13C3194D, 0x171C1DE2,
+    0x0DA911F3, 0x1EB11CD8, 0x0AA8133A, 0x0E1C14EF,
+    0x04FF015C, 0x01FC05F9, 0x178E1920, 0x076A11B1,
+    0x1CFC1DD9, 0x07661B32, 0x18621FF3, 0x11E215D7,
+    0x16521E62, 0x095A010E, 0x1B021C27, 0x014A16D3
   },
 
   {
-    0x05E101D1, 0x072314DD, 0x045F1433, 0x1A041541,
-    0x10B3142E, 0x01840736, 0x1C1B19DB, 0x098B0418,
-    0x1DBC083B, 0x007D1444, 0x01511740, 0x11DD1F3A,
-    0x04ED0E2F, 0x1B4B1A62, 0x10480D04, 0x09E911A2,
-    0x04211AFA, 0x19140893, 0x04D60CC4, 0x01210648
+    0x12C41232, 0x1FB50741, 0x11B115A6, 0x1ACA1839,
+    0x14B31F03, 0x02ED1F95, 0x09F41896, 0x161D1E24,
+    0x0A02143D, 0x01590D13, 0x144A1B40, 0x1C4A0AA3,
+    0x0CF30AB0, 0x0E9A10A5, 0x0D5912C9, 0x094016B4,
+    0x1FBF0154, 0x0AE51AF0, 0x1D0B0511, 0x00CA09C6
   },
 
   {
-    0x112703C4, 0x018B1BA1, 0x164C1D50, 0x05160BE0,
-    0x0BCC1830, 0x01CB1554, 0x13291732, 0x1B2B1918,
-    0x0DED0817, 0x00E80775, 0x0A2401D3, 0x0BFE08B3,
-    0x0E531199, 0x058616E9, 0x04770B91, 0x110F0C55,
-    0x19C11554, 0x0BFB1159, 0x03541C38, 0x000E1C2D
+    0x06C81C45, 0x133C022F, 0x09CB1FCF, 0x1175129D,
+    0x1F7C04F1, 0x1CA41747, 0x03271306, 0x01231C55,
+    0x10AA025D, 0x001A085A, 0x16101D69, 0x0FB90BC2,
+    0x128C11F8, 0x00CC1D05, 0x05551243, 0x1EBA063E,
+    0x14540B87, 0x118E145D, 0x04CE040A, 0x019C0F9F
   },
 
   {
-    0x10390C01, 0x02BB0751, 0x0AC5098E, 0x096C17AB,
-    0x03C90E28, 0x10BD18BF, 0x002E1F2D, 0x092B0986,
-    0x1BD700AC, 0x002E1F20, 0x1E3D1FD8, 0x077718BB,
-    0x06F919C4, 0x187407ED, 0x11370E14, 0x081E139C,
-    0x00481ADB, 0x14AB0289, 0x066A0EBE, 0x00C70ED6
+    0x1DB613EE, 0x03EB018D, 0x15F404F3, 0x086E12B0,
+    0x027B0A03, 0x08EB0273, 0x1A3C1F4C, 0x143619B2,
+    0x10AE08DE, 0x00691C1B, 0x09F0171B, 0x03691741,
+    0x0E8F1E09, 0x0DA4103F, 0x1B4C09FD, 0x1FE4048F,
+    0x12D00639, 0x0DB40778, 0x064A113A, 0x001C012F
   },
 
   {
-    0x0694120B, 0x124E1CC9, 0x0E2F0570, 0x17CF081A,
-    0x078906AC, 0x066D17CF, 0x1B3207F4, 0x0C5705E9,
-    0x10001C38, 0x00A919DE, 0x06851375, 0x0F900BD8,
-    0x080401BA, 0x0EEE0D42, 0x1B8B11EA, 0x0B4519F0,
-    0x090F18C0, 0x062E1508, 0x0DD909F4, 0x01EB067C
+    0x09A11616, 0x1036007A, 0x13181649, 0x17990E1B,
+    0x0482102C, 0x0D4B17BF, 0x12CA1EC8, 0x18D31913,
+    0x13B605F1, 0x00AD0129, 0x16C21A87, 0x13B113F0,
+    0x01B51E4B, 0x012B1335, 0x1D4E0D90, 0x1B220DE0,
+    0x0CA91433, 0x0ACC04CC, 0x0E280AC2, 0x012904D2
   },
 
   {
-    0x0CDC1D5F, 0x0D1818F9, 0x07781636, 0x125B18E8,
-    0x0D7003AF, 0x13110099, 0x1D9B1899, 0x175C1EB7,
-    0x0E34171A, 0x01E01153, 0x081A0F36, 0x0B391783,
-    0x1D1F147E, 0x19CE16D7, 0x11511B21, 0x1F2C10F9,
-    0x12CA0E51, 0x05A31D39, 0x171A192E, 0x016B0E4F
+    0x12771A22, 0x07EB1D55, 0x1EF512BE, 0x1EA31B89,
+    0x0E2F14CE, 0x1C4B0F43, 0x11CF0560, 0x00E018EC,
+    0x078C1BF1, 0x01B51CFD, 0x1C8C1A7D, 0x05290D56,
+    0x058A1788, 0x13D71E0F, 0x18DE079C, 0x1C620B72,
+    0x12120031, 0x12991781, 0x06F80511, 0x00FF1E8E
   }
 };
 
+#endif
+
 /*
-   Lookup one of the Gwin[] values, by index. This is constant-time.
+   Lookup one of the Gcomb[] values, by index. This is constant-time.
 */
 static void
-lookup_Gwin(p256_jacobian *T, uint32_t idx)
+lookup_Gcomb(p256_jacobian *T, uint32_t idx)
 {
   uint32_t xy[20];
   uint32_t k;
@@ -2044,7 +5906,7 @@ lookup_Gwin(p256_jacobian *T, uint32_t idx)
 
   memset(xy, 0, sizeof xy);
 
-  for (k = 0; k < 15; k ++)
+  for (k = 0; k < COMB_POINTS; k ++)
   {
     uint32_t m;
 
@@ -2052,7 +5914,7 @@ lookup_Gwin(p256_jacobian *T, uint32_t idx)
 
     for (u = 0; u < 20; u ++)
     {
-      xy[u] |= m & Gwin[k][u];
+      xy[u] |= m & Gcomb[k][u];
     }
   }
 
@@ -2079,43 +5941,62 @@ p256_mulgen(p256_jacobian *P, const unsigned char *x, size_t xlen)
      qz is a flag that is initially 1, and remains equal to 1
      as long as the point is the point at infinity.
 
-     We use a 4-bit window to handle multiplier bits by groups
-     of 4. The precomputed window is constant static data, with
-     points in affine coordinates; we use a constant-time lookup.
+     The comb points are constant static data, in affine coordinates;
+     we use a constant-time lookup. Q is never equal to the comb point
+     added to it, nor to its opposite (the multiplier is lower than the
+     curve order), so a mixed addition is enough.
   */
+  unsigned char k[32];
   p256_jacobian Q;
   uint32_t qz;
+  int j;
+
+  /*
+     Multiplier as 32 bytes (big-endian); since it is lower than the
+     order, extra leading bytes are zero.
+  */
+  memset(k, 0, sizeof k);
+
+  if (xlen > sizeof k)
+  {
+    x += xlen - sizeof k;
+    xlen = sizeof k;
+  }
+
+  memcpy(k + sizeof k - xlen, x, xlen);
 
   memset(&Q, 0, sizeof Q);
   qz = 1;
 
-  while (xlen -- > 0)
+  for (j = COMB_SPACING - 1; j >= 0; j --)
   {
-    int k;
-    unsigned bx;
+    uint32_t bits;
+    uint32_t bnz;
+    p256_jacobian T, U;
+    int i;
 
-    bx = *x ++;
+    p256_double(&Q);
+    bits = 0;
 
-    for (k = 0; k < 2; k ++)
+    for (i = 0; i < BR_P256_COMB; i ++)
     {
-      uint32_t bits;
-      uint32_t bnz;
-      p256_jacobian T, U;
+      int b;
 
-      p256_double(&Q);
-      p256_double(&Q);
-      p256_double(&Q);
-      p256_double(&Q);
-      bits = (bx >> 4) & 0x0F;
-      bnz = NEQ(bits, 0);
-      lookup_Gwin(&T, bits);
-      U = Q;
-      p256_add_mixed(&U, &T);
-      CCOPY(bnz & qz, &Q, &T, sizeof Q);
-      CCOPY(bnz & ~qz, &Q, &U, sizeof Q);
-      qz &= ~bnz;
-      bx <<= 4;
+      b = j + i * COMB_SPACING;
+
+      if (b < 256)
+      {
+        bits |= (uint32_t)((k[31 - (b >> 3)] >> (b & 7)) & 1) << i;
+      }
     }
+
+    bnz = NEQ(bits, 0);
+    lookup_Gcomb(&T, bits);
+    U = Q;
+    p256_add_mixed(&U, &T);
+    CCOPY(bnz & qz, &Q, &T, sizeof Q);
+    CCOPY(bnz & ~qz, &Q, &U, sizeof Q);
+    qz &= ~bnz;
   }
 
   *P = Q;
@@ -290,6 +290,23 @@ verify_SKE_sig(br_ssl_client_context *ctx,
   return 0;
 }
 
+/*
+   Clear a secret; the writes through a volatile pointer are not removed
+   by the compiler, unlike a memset() of a buffer which is not used after.
+*/
+static void
+wipe(void *dst, size_t len)
+{
+  volatile unsigned char *p;
+
+  p = dst;
+
+  while (len -- > 0)
+  {
+    *p ++ = 0;
+  }
+}
+
 /*
    Perform client-side ECDH (or ECDHE). The point that should be sent to
    the server is written in the pad; returned value is either the point
@@ -302,8 +319,8 @@ verify_SKE_sig(br_ssl_client_context *ctx,
 static int
 make_pms_ecdh(br_ssl_client_context *ctx, unsigned ecdhe, int prf_id)
 {
-  int curve;
-  unsigned char key[66], point[133];
+  int curve, pooled;
+  unsigned char key[66], point[133], pub[133];
   const unsigned char *order, *point_src;
   size_t glen, olen, point_len, xoff, xlen;
   unsigned char mask;
@@ -338,32 +355,49 @@ make_pms_ecdh(br_ssl_client_context *ctx, unsigned ecdhe, int prf_id)
      the value is in the proper range.
   */
   order = ctx->eng.iec->order(curve, &olen);
-  mask = 0xFF;
+  ctx->eng.iec->generator(curve, &glen);
 
-  while (mask >= order[0])
+  if (glen != point_len)
   {
-    mask >>= 1;
+    return -BR_ERR_INVALID_ALGORITHM;
   }
 
-  br_hmac_drbg_generate(&ctx->eng.rng, key, olen);
-  key[0] &= mask;
-  key[olen - 1] |= 0x01;
-
   /*
-     Compute the common ECDH point, whose X coordinate is the
-     pre-master secret.
+     With ECDHE, a precomputed key pair (private key and public point)
+     may be taken from the key source, which saves the computation of
+     the public point.
   */
-  ctx->eng.iec->generator(curve, &glen);
+  pooled = 0;
 
-  if (glen != point_len)
+  if (ecdhe && ctx->ecdhe_source != NULL && olen <= sizeof key)
   {
-    return -BR_ERR_INVALID_ALGORITHM;
+    pooled = (*ctx->ecdhe_source)->take(ctx->ecdhe_source,
+                                        curve, key, olen, pub, glen);
   }
 
+  if (!pooled)
+  {
+    mask = 0xFF;
+
+    while (mask >= order[0])
+    {
+      mask >>= 1;
+    }
+
+    br_hmac_drbg_generate(&ctx->eng.rng, key, olen);
+    key[0] &= mask;
+    key[olen - 1] |= 0x01;
+  }
+
+  /*
+     Compute the common ECDH point, whose X coordinate is the
+     pre-master secret.
+  */
   memcpy(point, point_src, glen);
 
   if (!ctx->eng.iec->mul(point, glen, key, olen, curve))
   {
+    wipe(key, sizeof key);
     return -BR_ERR_INVALID_ALGORITHM;
   }
 
@@ -373,8 +407,21 @@ make_pms_ecdh(br_ssl_client_context *ctx, unsigned ecdhe, int prf_id)
   xoff = ctx->eng.iec->xoff(curve, &xlen);
   br_ssl_engine_compute_master(&ctx->eng, prf_id, point + xoff, xlen);
 
-  ctx->eng.iec->mulgen(point, key, olen, curve);
-  memcpy(ctx->eng.pad, point, glen);
+  if (pooled)
+  {
+    memcpy(ctx->eng.pad, pub, glen);
+  }
+  else
+  {
+    ctx->eng.iec->mulgen(point, key, olen, curve);
+    memcpy(ctx->eng.pad, point, glen);
+  }
+
+  /*
+     The private key is single-use.
+  */
+  wipe(key, sizeof key);
+  wipe(point, sizeof point);
   return (int)glen;
 }
 
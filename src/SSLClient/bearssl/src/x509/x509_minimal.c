@@ -415,6 +415,57 @@ hash_dn(br_x509_minimal_context *ctx, const void *dn, size_t len,
   ctx->dn_hash_impl->out(&ctx->dn_hash.vtable, out);
 }
 
+/*
+   Get the range of trust anchors whose DN may have the provided hash. With
+   an index (sorted by hash prefix), it is found by binary search, otherwise
+   it is all the trust anchors.
+*/
+static void
+ta_range(br_x509_minimal_context *ctx, const unsigned char *dn_hash,
+         size_t *start, size_t *end)
+{
+  const unsigned char *index;
+  size_t lo, hi, mid;
+
+  index = ctx->ta_index;
+
+  if (index == NULL || ctx->dn_hash_impl->desc != br_sha256_vtable.desc)
+  {
+    *start = 0;
+    *end = ctx->trust_anchors_num;
+    return;
+  }
+
+  /* first entry >= dn_hash */
+  lo = 0;
+  hi = ctx->trust_anchors_num;
+
+  while (lo < hi)
+  {
+    mid = (lo + hi) >> 1;
+
+    if (memcmp(index + mid * BR_X509_TA_INDEX_LEN, dn_hash, BR_X509_TA_INDEX_LEN) < 0)
+    {
+      lo = mid + 1;
+    }
+    else
+    {
+      hi = mid;
+    }
+  }
+
+  *start = lo;
+
+  /* entries with the same prefix, usually one */
+  while (lo < ctx->trust_anchors_num
+         && memcmp(index + lo * BR_X509_TA_INDEX_LEN, dn_hash, BR_X509_TA_INDEX_LEN) == 0)
+  {
+    lo ++;
+  }
+
+  *end = lo;
+}
+
 /*
    Compare two big integers for equality. The integers use unsigned big-endian
    encoding; extra leading bytes (of value 0) are allowed.
@@ -1246,9 +1297,11 @@ t0_next:
         {
           /* check-direct-trust */
 
-          size_t u;
+          size_t u, end;
 
-          for (u = 0; u < CTX->trust_anchors_num; u ++)
+          ta_range(CTX, CTX->current_dn_hash, &u, &end);
+
+          for (; u < end; u ++)
           {
             const br_x509_trust_anchor *ta;
             unsigned char hashed_DN[64];
@@ -1323,9 +1376,11 @@ t0_next:
         {
           /* check-trust-anchor-CA */
 
-          size_t u;
+          size_t u, end;
+
+          ta_range(CTX, CTX->saved_dn_hash, &u, &end);
 
-          for (u = 0; u < CTX->trust_anchors_num; u ++)
+          for (; u < end; u ++)
           {
             const br_x509_trust_anchor *ta;
             unsigned char hashed_DN[64];
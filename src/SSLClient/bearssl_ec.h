@@ -617,15 +617,29 @@ extern const br_ec_impl br_ec_all_m15;
 extern const br_ec_impl br_ec_all_m31;
 
 /**
-   \brief Aggregate EC implementation "m31".
+   \brief Aggregate EC implementation "prime_fast_256".
 
    This implementation is a wrapper for:
 
-   - `br_ec_p256_m31` for NIST P-256
-   - `br_ec_prime_i31` for other curves (NIST P-384 and NIST-P512)
+   - `br_ec_p256_m15` for NIST P-256
+   - the fastest Curve25519 implementation for the target (`m64`,
+     `m31`, or `m15` if `BR_LOMUL`) for Curve25519
+   - `br_ec_prime_i15` for other curves (NIST P-384 and NIST-P512)
 */
 extern const br_ec_impl br_ec_prime_fast_256;
 
+/**
+   \brief EC implementation for the key exchange, Curve25519 and NIST P-256 only.
+
+   Both curves use the fastest implementation for the target (`m64`,
+   `m31`, or `m15` if `BR_LOMUL`). Set on the engine of a client, it
+   restricts the curves sent in the Supported Groups extension to
+   Curve25519 (first) and P-256, so that the server doesn't choose a
+   slower curve for ECDHE. The server certificate, if EC, must then
+   also be on P-256.
+*/
+extern const br_ec_impl br_ec_x25519_p256;
+
 /**
    \brief Get the "default" EC implementation for the current system.
 
@@ -1359,6 +1359,24 @@ void br_ghash_pwr8(void *y, const void *h, const void *data, size_t len);
 */
 br_ghash br_ghash_pwr8_get(void);
 
+/**
+   \brief GHASH implementation using 4-bit lookup tables (Shoup's method).
+
+   This implementation is NOT constant-time: its table lookups are
+   indexed by the processed data and the running hash value, which may
+   leak through cache or memory timings. It is several times faster than
+   the `ctmul*` implementations on cores without a carry-less multiply,
+   and is meant for deployments where timing side channels are out of
+   scope. It is never selected by default. The 256-byte table is
+   computed on the stack for each call.
+
+   \param y      the array to update.
+   \param h      the GHASH key.
+   \param data   the input data (may be `NULL` if `len` is zero).
+   \param len    the input data length (in bytes).
+*/
+void br_ghash_shoup4(void *y, const void *h, const void *data, size_t len);
+
 #ifdef __cplusplus
 }
 #endif
@@ -2320,6 +2320,38 @@ int br_ssl_key_export(br_ssl_engine_context *cc,
 */
 typedef struct br_ssl_client_context_ br_ssl_client_context;
 
+/**
+   \brief Class type for a source of ECDHE key pairs (client side).
+
+   The client generates an ephemeral key pair for each handshake with an
+   ECDHE cipher suite. A key source provides key pairs computed earlier,
+   e.g. during idle time, so that the generation of the public point is
+   not on the path of the handshake.
+*/
+typedef struct br_ssl_client_ecdhe_source_class_ br_ssl_client_ecdhe_source_class;
+struct br_ssl_client_ecdhe_source_class_
+{
+  /**
+     \brief Get a key pair for a curve.
+
+     The private key is written in `key` (`key_len` bytes, the length
+     of the curve order) and the public point in `point` (`point_len`
+     bytes, the length of the curve generator). A key pair must be given
+     only once. The client wipes its copy after use.
+
+     \param ctx         source context.
+     \param curve       curve identifier.
+     \param key         destination for the private key.
+     \param key_len     private key length (in bytes).
+     \param point       destination for the public point.
+     \param point_len   public point length (in bytes).
+     \return  1 on success, 0 if no key pair is available for the curve.
+  */
+  int (*take)(const br_ssl_client_ecdhe_source_class **ctx, int curve,
+              unsigned char *key, size_t key_len,
+              unsigned char *point, size_t point_len);
+};
+
 /**
    \brief Type for the client certificate, if requested by the server.
 */
@@ -2707,6 +2739,11 @@ struct br_ssl_client_context_
      Implementations.
   */
   br_rsa_public irsapub;
+
+  /*
+     Optional source of precomputed ECDHE key pairs.
+  */
+  const br_ssl_client_ecdhe_source_class **ecdhe_source;
 #endif
 };
 
@@ -2848,6 +2885,23 @@ br_ssl_client_set_rsapub(br_ssl_client_context *cc, br_rsa_public irsapub)
   cc->irsapub = irsapub;
 }
 
+/**
+   \brief Set a source of precomputed ECDHE key pairs.
+
+   With ECDHE cipher suites, the client key pair is taken from the source
+   when it has one for the curve chosen by the server; otherwise, it is
+   generated during the handshake, as without a source.
+
+   \param cc       client context.
+   \param source   key source context, or `NULL`.
+*/
+static inline void
+br_ssl_client_set_ecdhe_source(br_ssl_client_context *cc,
+                               const br_ssl_client_ecdhe_source_class **source)
+{
+  cc->ecdhe_source = source;
+}
+
 /**
    \brief Set the "default" RSA implementation for public-key operations.
 
@@ -711,6 +711,9 @@ typedef struct
   const br_x509_trust_anchor *trust_anchors;
   size_t trust_anchors_num;
 
+  /* Optional index of the trust anchors, see br_x509_minimal_set_ta_index(). */
+  const unsigned char *ta_index;
+
   /*
      Multi-hasher for the TBS.
   */
@@ -884,6 +887,34 @@ br_x509_minimal_set_time(br_x509_minimal_context *ctx,
   ctx->seconds = seconds;
 }
 
+/**
+   \brief Length of an entry of a trust anchor index.
+*/
+#define BR_X509_TA_INDEX_LEN   8
+
+/**
+   \brief Set an index of the trust anchors (X.509 "minimal" engine).
+
+   Without an index, the DN of every trust anchor is hashed and compared
+   for each certificate of the chain. With an index, the trust anchors
+   which may match a DN are found by binary search.
+
+   The index has one entry of `BR_X509_TA_INDEX_LEN` bytes per trust
+   anchor: the first bytes of the SHA-256 of the anchor DN. The trust
+   anchors must be sorted by their entry, in ascending order (as emitted
+   by `pycert_bearssl --index`). The index is only used when the DN hash
+   function is SHA-256, which is the case with `br_ssl_client_init_full()`.
+
+   \param ctx     validation context.
+   \param index   the index, or `NULL` to search all trust anchors.
+*/
+static inline void
+br_x509_minimal_set_ta_index(br_x509_minimal_context *ctx,
+                             const unsigned char *index)
+{
+  ctx->ta_index = index;
+}
+
 /**
    \brief Set the minimal acceptable length for RSA keys (X.509 "minimal"
    engine).
@@ -244,4 +244,15 @@
   #define BR_BE_UNALIGNED   1
 */
 
+/*
+   BR_P256_COMB is the number of teeth of the fixed-base comb used by
+   the "m15" P-256 implementation to multiply the curve generator (ECDHE
+   key generation, ECDSA signatures, half of ECDSA verifications). It
+   ranges from 4 to 8; each extra tooth doubles the table in flash (from
+   1.2 kB to 20 kB) and cuts the number of point additions and doublings
+   (from 64 to 32 of each). The default is 6 (5 kB, 43 of each).
+
+  #define BR_P256_COMB   6
+*/
+
 #endif
@@ -24,6 +24,24 @@
 
 #include "inner.h"
 
+/*
+   Fastest backends for the target, as chosen by br_ec_all_m31 and
+   br_ec_all_m15: 64-bit multiplications if available, 15-bit words
+   if 32x32 multiplications are slow or not constant-time (BR_LOMUL),
+   31-bit words otherwise. br_ec_prime_fast_256 keeps br_ec_p256_m15
+   for P-256.
+*/
+#if BR_INT128 || BR_UMUL128
+  #define EC_C25519_FAST    br_ec_c25519_m64
+  #define EC_P256_FAST      br_ec_p256_m64
+#elif BR_LOMUL
+  #define EC_C25519_FAST    br_ec_c25519_m15
+  #define EC_P256_FAST      br_ec_p256_m15
+#else
+  #define EC_C25519_FAST    br_ec_c25519_m31
+  #define EC_P256_FAST      br_ec_p256_m31
+#endif
+
 static const unsigned char *
 api_generator(int curve, size_t *len)
 {
@@ -32,6 +50,11 @@ api_generator(int curve, size_t *len)
     return br_ec_p256_m15.generator(curve, len);
   }
 
+  if (curve == BR_EC_curve25519)
+  {
+    return EC_C25519_FAST.generator(curve, len);
+  }
+
   return br_ec_prime_i15.generator(curve, len);
 }
 
@@ -43,6 +66,11 @@ api_order(int curve, size_t *len)
     return br_ec_p256_m15.order(curve, len);
   }
 
+  if (curve == BR_EC_curve25519)
+  {
+    return EC_C25519_FAST.order(curve, len);
+  }
+
   return br_ec_prime_i15.order(curve, len);
 }
 
@@ -54,6 +82,11 @@ api_xoff(int curve, size_t *len)
     return br_ec_p256_m15.xoff(curve, len);
   }
 
+  if (curve == BR_EC_curve25519)
+  {
+    return EC_C25519_FAST.xoff(curve, len);
+  }
+
   return br_ec_prime_i15.xoff(curve, len);
 }
 
@@ -66,6 +99,11 @@ api_mul(unsigned char *G, size_t Glen,
     return br_ec_p256_m15.mul(G, Glen, kb, kblen, curve);
   }
 
+  if (curve == BR_EC_curve25519)
+  {
+    return EC_C25519_FAST.mul(G, Glen, kb, kblen, curve);
+  }
+
   return br_ec_prime_i15.mul(G, Glen, kb, kblen, curve);
 }
 
@@ -78,6 +116,11 @@ api_mulgen(unsigned char *R,
     return br_ec_p256_m15.mulgen(R, x, xlen, curve);
   }
 
+  if (curve == BR_EC_curve25519)
+  {
+    return EC_C25519_FAST.mulgen(R, x, xlen, curve);
+  }
+
   return br_ec_prime_i15.mulgen(R, x, xlen, curve);
 }
 
@@ -92,6 +135,12 @@ api_muladd(unsigned char *A, const unsigned char *B, size_t len,
                                  x, xlen, y, ylen, curve);
   }
 
+  /* no muladd() on Curve25519, which has no ECDSA */
+  if (curve == BR_EC_curve25519)
+  {
+    return 0;
+  }
+
   return br_ec_prime_i15.muladd(A, B, len,
                                 x, xlen, y, ylen, curve);
 }
@@ -99,7 +148,7 @@ api_muladd(unsigned char *A, const unsigned char *B, size_t len,
 /* see bearssl_ec.h */
 const br_ec_impl br_ec_prime_fast_256 =
 {
-  (uint32_t)0x03800000,
+  (uint32_t)0x23800000,
   &api_generator,
   &api_order,
   &api_xoff,
@@ -107,3 +156,90 @@ const br_ec_impl br_ec_prime_fast_256 =
   &api_mulgen,
   &api_muladd
 };
+
+/*
+   Key exchange curves only: Curve25519 and P-256, both with the
+   fastest backend for the target.
+*/
+static const unsigned char *
+kex_generator(int curve, size_t *len)
+{
+  if (curve == BR_EC_curve25519)
+  {
+    return EC_C25519_FAST.generator(curve, len);
+  }
+
+  return EC_P256_FAST.generator(curve, len);
+}
+
+static const unsigned char *
+kex_order(int curve, size_t *len)
+{
+  if (curve == BR_EC_curve25519)
+  {
+    return EC_C25519_FAST.order(curve, len);
+  }
+
+  return EC_P256_FAST.order(curve, len);
+}
+
+static size_t
+kex_xoff(int curve, size_t *len)
+{
+  if (curve == BR_EC_curve25519)
+  {
+    return EC_C25519_FAST.xoff(curve, len);
+  }
+
+  return EC_P256_FAST.xoff(curve, len);
+}
+
+static uint32_t
+kex_mul(unsigned char *G, size_t Glen,
+        const unsigned char *kb, size_t kblen, int curve)
+{
+  if (curve == BR_EC_curve25519)
+  {
+    return EC_C25519_FAST.mul(G, Glen, kb, kblen, curve);
+  }
+
+  return EC_P256_FAST.mul(G, Glen, kb, kblen, curve);
+}
+
+static size_t
+kex_mulgen(unsigned char *R,
+           const unsigned char *x, size_t xlen, int curve)
+{
+  if (curve == BR_EC_curve25519)
+  {
+    return EC_C25519_FAST.mulgen(R, x, xlen, curve);
+  }
+
+  return EC_P256_FAST.mulgen(R, x, xlen, curve);
+}
+
+static uint32_t
+kex_muladd(unsigned char *A, const unsigned char *B, size_t len,
+           const unsigned char *x, size_t xlen,
+           const unsigned char *y, size_t ylen, int curve)
+{
+  if (curve == BR_EC_curve25519)
+  {
+    return 0;
+  }
+
+  return EC_P256_FAST.muladd(A, B, len,
+                             x, xlen, y, ylen, curve);
+}
+
+/* see bearssl_ec.h */
+const br_ec_impl br_ec_x25519_p256 =
+{
+  (uint32_t)0x20800000,
+  &kex_generator,
+  &kex_order,
+  &kex_xoff,
+  &kex_mul,
+  &kex_mulgen,
+  &kex_muladd
+};
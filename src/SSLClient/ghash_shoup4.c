@@ -0,0 +1,134 @@
+/*
+   ghash_shoup4.c
+
+   GHASH with the 4-bit tables of Shoup, for the AES-GCM cipher suites
+   where throughput matters more than timing side channels.
+
+   NOT constant-time: the table lookups are indexed by the data and
+   the running hash, so the cache and memory timings may leak them. The
+   constant-time implementations (ctmul, ctmul32, ctmul64) remain the
+   default; this one is only used when chosen explicitly, see
+   SSLCryptoProfile::useTableGcm().
+*/
+
+#include "inner.h"
+
+/*
+   Reduction of the 4 bits shifted out of the low end of the hash, by
+   the GHASH polynomial (x^128 + x^7 + x^2 + x + 1, bit-reflected),
+   as the top 16 bits of the high word.
+*/
+static const uint16_t shoup4_rem[16] =
+{
+  0x0000, 0x1C20, 0x3840, 0x2460, 0x7080, 0x6CA0, 0x48C0, 0x54E0,
+  0xE100, 0xFD20, 0xD940, 0xC560, 0x9180, 0x8DA0, 0xA9C0, 0xB5E0
+};
+
+/*
+   Multiply z (4 big-endian words) by x^4, i.e. shift it 4 bits towards
+   the low end and reduce.
+*/
+static inline void
+shoup4_shift(uint32_t *z)
+{
+  unsigned rem;
+
+  rem = z[3] & 0x0F;
+  z[3] = (z[2] << 28) | (z[3] >> 4);
+  z[2] = (z[1] << 28) | (z[2] >> 4);
+  z[1] = (z[0] << 28) | (z[1] >> 4);
+  z[0] = (z[0] >> 4) ^ ((uint32_t)shoup4_rem[rem] << 16);
+}
+
+static inline void
+shoup4_xor(uint32_t *z, const uint32_t *m)
+{
+  z[0] ^= m[0];
+  z[1] ^= m[1];
+  z[2] ^= m[2];
+  z[3] ^= m[3];
+}
+
+/* see bearssl_hash.h */
+void
+br_ghash_shoup4(void *y, const void *h, const void *data, size_t len)
+{
+  /*
+     M[n] = n * H for the 16 values of a nibble, 256 bytes of stack.
+     It only depends on H but the br_ghash API has no context, so it is
+     computed again for each call, about as long as 2 blocks.
+  */
+  uint32_t M[16][4];
+  const unsigned char *buf;
+  unsigned char *yb;
+  uint32_t z[4];
+  int i, j;
+
+  yb = y;
+  buf = data;
+
+  M[8][0] = br_dec32be((const unsigned char *)h);
+  M[8][1] = br_dec32be((const unsigned char *)h + 4);
+  M[8][2] = br_dec32be((const unsigned char *)h + 8);
+  M[8][3] = br_dec32be((const unsigned char *)h + 12);
+
+  /* M[4], M[2], M[1]: H times x, x^2 and x^3 */
+  for (i = 4; i > 0; i >>= 1)
+  {
+    const uint32_t *s = M[i << 1];
+    uint32_t *d = M[i];
+
+    d[3] = (s[2] << 31) | (s[3] >> 1);
+    d[2] = (s[1] << 31) | (s[2] >> 1);
+    d[1] = (s[0] << 31) | (s[1] >> 1);
+    d[0] = (s[0] >> 1) ^ ((uint32_t)(-(s[3] & 1)) & 0xE1000000);
+  }
+
+  memset(M[0], 0, sizeof M[0]);
+
+  for (i = 2; i <= 8; i <<= 1)
+  {
+    for (j = 1; j < i; j++)
+    {
+      M[i + j][0] = M[i][0] ^ M[j][0];
+      M[i + j][1] = M[i][1] ^ M[j][1];
+      M[i + j][2] = M[i][2] ^ M[j][2];
+      M[i + j][3] = M[i][3] ^ M[j][3];
+    }
+  }
+
+  while (len > 0)
+  {
+    unsigned char x[16];
+    size_t clen;
+
+    /* the last block is padded with zeros */
+    clen = len < 16 ? len : 16;
+
+    for (i = 0; i < 16; i++)
+    {
+      x[i] = yb[i] ^ (i < (int)clen ? buf[i] : 0);
+    }
+
+    buf += clen;
+    len -= clen;
+
+    /* Horner on the nibbles, from the last one (highest powers of x) */
+    memcpy(z, M[x[15] & 0x0F], sizeof z);
+    shoup4_shift(z);
+    shoup4_xor(z, M[x[15] >> 4]);
+
+    for (i = 14; i >= 0; i--)
+    {
+      shoup4_shift(z);
+      shoup4_xor(z, M[x[i] & 0x0F]);
+      shoup4_shift(z);
+      shoup4_xor(z, M[x[i] >> 4]);
+    }
+
+    br_enc32be(yb, z[0]);
+    br_enc32be(yb + 4, z[1]);
+    br_enc32be(yb + 8, z[2]);
+    br_enc32be(yb + 12, z[3]);
+  }
+}
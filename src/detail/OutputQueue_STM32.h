@@ -0,0 +1,190 @@
+/****************************************************************************************************************************
+  OutputQueue_STM32.h - Dead simple web-server.
+  For STM32F/L/H/G/WB/MP1 with built-in Ethernet LAN8742A (Nucleo-144, DISCOVERY, etc) or W5x00/ENC28J60 shield/module
+
+  EthernetWebServer_SSL_STM32 is a library for STM32 using the Ethernet shields to run WebServer and Client with/without SSL
+
+  Use SSLClient Library code from https://github.com/OPEnSLab-OSU/SSLClient
+
+  Based on and modified from ESP8266 https://github.com/esp8266/Arduino/releases
+  Built by Khoi Hoang https://github.com/khoih-prog/EthernetWebServer_SSL_STM32
+
+  Version: 1.6.0
+
+  Version Modified By   Date      Comments
+  ------- -----------  ---------- -----------
+  1.1.0   K Hoang      14/11/2020 Initial coding for STM32F/L/H/G/WB/MP1 to support Ethernet shields using SSL. Supporting BI LAN8742A,
+                                  W5x00 using Ethernetx, ENC28J60 using EthernetENC and UIPEthernet libraries
+  ...
+  1.4.0   K Hoang      25/12/2021 Reduce usage of Arduino String with std::string. Fix bug
+  1.4.1   K Hoang      27/12/2021 Fix wrong http status header bug and authenticate issue caused by libb64
+  1.4.2   K Hoang      11/01/2022 Fix libb64 fallthrough compile warning
+  1.4.3   K Hoang      02/03/2022 Fix decoding error bug
+  1.4.4   K Hoang      19/03/2022 Change licence from `MIT` to `GPLv3`
+  1.4.5   K Hoang      29/03/2022 Sync with `SSLClient` v1.6.11
+  1.5.0   K Hoang      05/04/2022 Use Ethernet_Generic library as default
+  1.5.1   K Hoang      27/04/2022 Change from `arduino.cc` to `arduino.tips` in examples
+  1.6.0   K Hoang      03/05/2022 Add support to STM32L5 and to custom SPI, such as SPI2, SPI3, SPI_New, etc.
+ ****************************************************************************************************************************/
+
+#pragma once
+
+#ifndef OutputQueue_STM32_h
+#define OutputQueue_STM32_h
+
+#include "ResponseStreamer_STM32.h"
+
+// Permit redefinition of HTTP_OUTPUT_BUFFER_SZ in sketch. Response data the socket can't take at once is
+// queued in a buffer of this size, allocated on first use, default is 2K, minimum is 256 bytes
+#ifndef HTTP_OUTPUT_BUFFER_SZ
+  #define HTTP_OUTPUT_BUFFER_SZ     2048
+#elif (HTTP_OUTPUT_BUFFER_SZ < 256)
+  #undef HTTP_OUTPUT_BUFFER_SZ
+  #define HTTP_OUTPUT_BUFFER_SZ     256
+
+  #if (_ETHERNET_WEBSERVER_LOGLEVEL_ > 2)
+    #warning HTTP_OUTPUT_BUFFER_SZ reset to min 256 bytes
+  #endif
+#endif
+
+/////////////////////////////////////////////////////////////////////////
+
+// Bounded ring buffer of response data waiting for TX space on a connection
+class OutputQueue
+{
+  public:
+
+    OutputQueue()
+      : _buffer(new uint8_t[HTTP_OUTPUT_BUFFER_SZ])
+      , _head(0)
+      , _count(0)
+      , _lastProgress(millis())
+      , _failed(false)
+    {
+    }
+
+    ~OutputQueue()
+    {
+      if (_buffer)
+        delete [] _buffer;
+    }
+
+    // false if the buffer couldn't be allocated
+    bool valid() const
+    {
+      return (_buffer != nullptr);
+    }
+
+    bool failed() const
+    {
+      return _failed;
+    }
+
+    bool empty() const
+    {
+      return (_count == 0);
+    }
+
+    size_t size() const
+    {
+      return _count;
+    }
+
+    size_t space() const
+    {
+      return HTTP_OUTPUT_BUFFER_SZ - _count;
+    }
+
+    void clear()
+    {
+      _head   = 0;
+      _count  = 0;
+      _failed = false;
+    }
+
+    // Queue as much of data as fits. Return the number of bytes queued
+    size_t push(const uint8_t* data, size_t len)
+    {
+      size_t count = 0;
+
+      if (_count == 0)
+        _lastProgress = millis();
+
+      while ( (count < len) && (_count < HTTP_OUTPUT_BUFFER_SZ) )
+      {
+        size_t tail   = (_head + _count) % HTTP_OUTPUT_BUFFER_SZ;
+        size_t toCopy = (tail < _head) ? (_head - tail) : (HTTP_OUTPUT_BUFFER_SZ - tail);
+
+        if (toCopy > len - count)
+          toCopy = len - count;
+
+        memcpy(_buffer + tail, data + count, toCopy);
+
+        count   += toCopy;
+        _count  += toCopy;
+      }
+
+      return count;
+    }
+
+    // Write queued data to the client, as much as its TX space permits. If block is false, return as
+    // soon as the socket is full. Return true when the queue is empty (or has failed).
+    bool flush(EthernetClient& client, bool block)
+    {
+      while (_count && !_failed)
+      {
+        size_t space = ethernetClientTxSpace(client);
+        size_t written = 0;
+
+        if (space > 0)
+        {
+          size_t toSend = HTTP_OUTPUT_BUFFER_SZ - _head;
+
+          if (toSend > _count)
+            toSend = _count;
+
+          if (toSend > space)
+            toSend = space;
+
+          written = client.write(_buffer + _head, toSend);
+        }
+
+        if (written == 0)
+        {
+          const SendStall stall = ethernetClientSendStall(client, _lastProgress, block);
+
+          if (stall == SEND_FAILED)
+          {
+            ET_LOGWARN(F("OutputQueue: client gone or send timeout"));
+            _failed = true;
+
+            break;
+          }
+
+          if (stall == SEND_WOULD_BLOCK)
+            return false;
+
+          continue;
+        }
+
+        _head          = (_head + written) % HTTP_OUTPUT_BUFFER_SZ;
+        _count        -= written;
+        _lastProgress  = millis();
+      }
+
+      if (_count == 0)
+        _head = 0;
+
+      return true;
+    }
+
+  private:
+
+    uint8_t*        _buffer;
+    size_t          _head;
+    size_t          _count;
+    unsigned long   _lastProgress;
+    bool            _failed;
+};
+
+#endif  //OutputQueue_STM32_h
@@ -0,0 +1,263 @@
+/****************************************************************************************************************************
+  ResponseGenerator_STM32.h - Dead simple web-server.
+  For STM32F/L/H/G/WB/MP1 with built-in Ethernet LAN8742A (Nucleo-144, DISCOVERY, etc) or W5x00/ENC28J60 shield/module
+
+  EthernetWebServer_SSL_STM32 is a library for STM32 using the Ethernet shields to run WebServer and Client with/without SSL
+
+  Use SSLClient Library code from https://github.com/OPEnSLab-OSU/SSLClient
+
+  Based on and modified from ESP8266 https://github.com/esp8266/Arduino/releases
+  Built by Khoi Hoang https://github.com/khoih-prog/EthernetWebServer_SSL_STM32
+
+  Version: 1.6.0
+
+  Version Modified By   Date      Comments
+  ------- -----------  ---------- -----------
+  1.1.0   K Hoang      14/11/2020 Initial coding for STM32F/L/H/G/WB/MP1 to support Ethernet shields using SSL. Supporting BI LAN8742A,
+                                  W5x00 using Ethernetx, ENC28J60 using EthernetENC and UIPEthernet libraries
+  ...
+  1.4.0   K Hoang      25/12/2021 Reduce usage of Arduino String with std::string. Fix bug
+  1.4.1   K Hoang      27/12/2021 Fix wrong http status header bug and authenticate issue caused by libb64
+  1.4.2   K Hoang      11/01/2022 Fix libb64 fallthrough compile warning
+  1.4.3   K Hoang      02/03/2022 Fix decoding error bug
+  1.4.4   K Hoang      19/03/2022 Change licence from `MIT` to `GPLv3`
+  1.4.5   K Hoang      29/03/2022 Sync with `SSLClient` v1.6.11
+  1.5.0   K Hoang      05/04/2022 Use Ethernet_Generic library as default
+  1.5.1   K Hoang      27/04/2022 Change from `arduino.cc` to `arduino.tips` in examples
+  1.6.0   K Hoang      03/05/2022 Add support to STM32L5 and to custom SPI, such as SPI2, SPI3, SPI_New, etc.
+ ****************************************************************************************************************************/
+
+#pragma once
+
+#ifndef ResponseGenerator_STM32_h
+#define ResponseGenerator_STM32_h
+
+// Coroutines need C++20, e.g. build_flags = -std=gnu++20 -fcoroutines with GCC 10 or later
+#if ( defined(__cpp_impl_coroutine) && (__cpp_impl_coroutine >= 201902L) && __has_include(<coroutine>) )
+  #define ETHERNET_WEBSERVER_HAS_COROUTINES     true
+#else
+  #define ETHERNET_WEBSERVER_HAS_COROUTINES     false
+#endif
+
+#if ETHERNET_WEBSERVER_HAS_COROUTINES
+
+#include <coroutine>
+
+#include "ResponseStreamer_STM32.h"
+
+/////////////////////////////////////////////////////////////////////////
+
+// Return type of a handler coroutine which co_yield's the response body in pieces, e.g.
+//
+//   ResponseGenerator report()
+//   {
+//     for (int i = 0; i < 1000; i++)
+//       co_yield String("<p>Row ") + i + "</p>";
+//   }
+//
+//   server.on("/report", []() { server.send(200, "text/html", report()); });
+//
+// A yielded String or C string isn't copied, it must stay valid until the coroutine is resumed,
+// which is the case for temporaries and locals of the coroutine.
+class ResponseGenerator
+{
+  public:
+
+    struct promise_type
+    {
+      const uint8_t*  data  = nullptr;
+      size_t          len   = 0;
+
+      ResponseGenerator get_return_object()
+      {
+        return ResponseGenerator(std::coroutine_handle<promise_type>::from_promise(*this));
+      }
+
+      std::suspend_always initial_suspend() noexcept
+      {
+        return {};
+      }
+
+      std::suspend_always final_suspend() noexcept
+      {
+        return {};
+      }
+
+      std::suspend_always yield_value(const String& chunk)
+      {
+        data  = (const uint8_t*) chunk.c_str();
+        len   = chunk.length();
+
+        return {};
+      }
+
+      std::suspend_always yield_value(const char* chunk)
+      {
+        data  = (const uint8_t*) chunk;
+        len   = chunk ? strlen(chunk) : 0;
+
+        return {};
+      }
+
+      void return_void() {}
+
+      void unhandled_exception() {}
+    };
+
+    ResponseGenerator(ResponseGenerator&& other)
+      : _handle(other._handle)
+    {
+      other._handle = nullptr;
+    }
+
+    ResponseGenerator(const ResponseGenerator&) = delete;
+    ResponseGenerator& operator=(const ResponseGenerator&) = delete;
+
+    ~ResponseGenerator()
+    {
+      if (_handle)
+        _handle.destroy();
+    }
+
+    // Run the coroutine to its next co_yield. Return false when the body is complete
+    bool next()
+    {
+      if (!_handle || _handle.done())
+        return false;
+
+      _handle.promise().len = 0;
+      _handle.resume();
+
+      return !_handle.done();
+    }
+
+    const uint8_t* data() const
+    {
+      return _handle.promise().data;
+    }
+
+    size_t length() const
+    {
+      return _handle.promise().len;
+    }
+
+  private:
+
+    explicit ResponseGenerator(std::coroutine_handle<promise_type> handle)
+      : _handle(handle)
+    {
+    }
+
+    std::coroutine_handle<promise_type> _handle;
+};
+
+/////////////////////////////////////////////////////////////////////////
+
+// Sends the output of a ResponseGenerator. The coroutine is only resumed when the socket has TX space
+// to take what it produces, and each buffer is framed as one HTTP chunk when chunked is true.
+class GeneratorStreamer : public ResponseStreamer
+{
+  public:
+
+    GeneratorStreamer(ResponseGenerator&& generator, bool chunked = false)
+      : ResponseStreamer(false)
+      , _generator(static_cast<ResponseGenerator&&>(generator))
+      , _offset(0)
+      , _chunked(chunked)
+      , _done(false)
+    {
+    }
+
+    // The framing is only known once the response header is prepared, set it before the first run()
+    void setChunked(bool chunked)
+    {
+      _chunked = chunked;
+    }
+
+  protected:
+
+    // "XXXX\r\n" before the chunk data and "\r\n" after it
+    static const size_t CHUNK_PREFIX_SZ = 6;
+    static const size_t CHUNK_SUFFIX_SZ = 2;
+
+    size_t _fill(uint8_t* buf, size_t len) override
+    {
+      if (_done)
+        return 0;
+
+      if (!_chunked)
+        return _copy(buf, len);
+
+      size_t count = _copy(buf + CHUNK_PREFIX_SZ, len - CHUNK_PREFIX_SZ - CHUNK_SUFFIX_SZ);
+
+      if (count == 0)
+      {
+        // Last chunk
+        _done = true;
+        memcpy(buf, "0\r\n\r\n", 5);
+
+        return 5;
+      }
+
+      static const char hex[] = "0123456789abcdef";
+
+      for (int i = 3; i >= 0; i--)
+        buf[3 - i] = hex[(count >> (4 * i)) & 0x0F];
+
+      buf[4] = '\r';
+      buf[5] = '\n';
+      buf[CHUNK_PREFIX_SZ + count]      = '\r';
+      buf[CHUNK_PREFIX_SZ + count + 1]  = '\n';
+
+      return CHUNK_PREFIX_SZ + count + CHUNK_SUFFIX_SZ;
+    }
+
+  private:
+
+    // Copy as much of the yielded data as fits into buf, resuming the coroutine as needed
+    size_t _copy(uint8_t* buf, size_t len)
+    {
+      size_t count = 0;
+
+      while (count < len)
+      {
+        if (_offset == _generator.length())
+        {
+          _offset = 0;
+
+          if (!_generator.next())
+          {
+            if (!_chunked)
+              _done = true;
+
+            break;
+          }
+
+          continue;
+        }
+
+        size_t toCopy = _generator.length() - _offset;
+
+        if (toCopy > len - count)
+          toCopy = len - count;
+
+        memcpy(buf + count, _generator.data() + _offset, toCopy);
+
+        count   += toCopy;
+        _offset += toCopy;
+      }
+
+      return count;
+    }
+
+    ResponseGenerator _generator;
+    size_t            _offset;
+    bool              _chunked;
+    bool              _done;
+};
+
+static_assert(STREAMFILE_BUFFER_SZ <= 0xFFFF, "STREAMFILE_BUFFER_SZ too large for the 4-digit chunk size of GeneratorStreamer");
+
+#endif    // ETHERNET_WEBSERVER_HAS_COROUTINES
+
+#endif  //ResponseGenerator_STM32_h
@@ -0,0 +1,296 @@
+/****************************************************************************************************************************
+  ResponseStreamer_STM32.h - Dead simple web-server.
+  For STM32F/L/H/G/WB/MP1 with built-in Ethernet LAN8742A (Nucleo-144, DISCOVERY, etc) or W5x00/ENC28J60 shield/module
+
+  EthernetWebServer_SSL_STM32 is a library for STM32 using the Ethernet shields to run WebServer and Client with/without SSL
+
+  Use SSLClient Library code from https://github.com/OPEnSLab-OSU/SSLClient
+
+  Based on and modified from ESP8266 https://github.com/esp8266/Arduino/releases
+  Built by Khoi Hoang https://github.com/khoih-prog/EthernetWebServer_SSL_STM32
+
+  Version: 1.6.0
+
+  Version Modified By   Date      Comments
+  ------- -----------  ---------- -----------
+  1.1.0   K Hoang      14/11/2020 Initial coding for STM32F/L/H/G/WB/MP1 to support Ethernet shields using SSL. Supporting BI LAN8742A,
+                                  W5x00 using Ethernetx, ENC28J60 using EthernetENC and UIPEthernet libraries
+  ...
+  1.4.0   K Hoang      25/12/2021 Reduce usage of Arduino String with std::string. Fix bug
+  1.4.1   K Hoang      27/12/2021 Fix wrong http status header bug and authenticate issue caused by libb64
+  1.4.2   K Hoang      11/01/2022 Fix libb64 fallthrough compile warning
+  1.4.3   K Hoang      02/03/2022 Fix decoding error bug
+  1.4.4   K Hoang      19/03/2022 Change licence from `MIT` to `GPLv3`
+  1.4.5   K Hoang      29/03/2022 Sync with `SSLClient` v1.6.11
+  1.5.0   K Hoang      05/04/2022 Use Ethernet_Generic library as default
+  1.5.1   K Hoang      27/04/2022 Change from `arduino.cc` to `arduino.tips` in examples
+  1.6.0   K Hoang      03/05/2022 Add support to STM32L5 and to custom SPI, such as SPI2, SPI3, SPI_New, etc.
+ ****************************************************************************************************************************/
+
+#pragma once
+
+#ifndef ResponseStreamer_STM32_h
+#define ResponseStreamer_STM32_h
+
+#include "Debug_STM32.h"
+
+// Permit redefinition of STREAMFILE_BUFFER_SZ in sketch. Two buffers of this size are used per transfer,
+// default is one TCP segment (HTTP_DOWNLOAD_UNIT_SIZE), minimum is 256 bytes
+#ifndef STREAMFILE_BUFFER_SZ
+  #define STREAMFILE_BUFFER_SZ      HTTP_DOWNLOAD_UNIT_SIZE
+#elif (STREAMFILE_BUFFER_SZ < 256)
+  #undef STREAMFILE_BUFFER_SZ
+  #define STREAMFILE_BUFFER_SZ      256
+
+  #if (_ETHERNET_WEBSERVER_LOGLEVEL_ > 2)
+    #warning STREAMFILE_BUFFER_SZ reset to min 256 bytes
+  #endif
+#endif
+
+// Ethernet_Generic (W5x00) and EthernetENC report the free space of the socket TX buffer through availableForWrite().
+// The other Ethernet libraries don't, so a full TCP segment is written at a time, as before
+#ifndef ETHERNET_CLIENT_HAS_TX_SPACE
+  #if ( USE_BUILTIN_ETHERNET || USE_UIP_ETHERNET || USE_CUSTOM_ETHERNET || USE_ETHERNET_ESP8266 )
+    #define ETHERNET_CLIENT_HAS_TX_SPACE      false
+  #else
+    #define ETHERNET_CLIENT_HAS_TX_SPACE      true
+  #endif
+#endif
+
+/////////////////////////////////////////////////////////////////////////
+
+// Number of bytes which can be written to the client without blocking
+inline size_t ethernetClientTxSpace(EthernetClient& client)
+{
+#if ETHERNET_CLIENT_HAS_TX_SPACE
+  int space = client.availableForWrite();
+
+  return (space > 0) ? (size_t) space : 0;
+#else
+  (void) client;
+
+  return HTTP_DOWNLOAD_UNIT_SIZE;
+#endif
+}
+
+// What to do when the socket took nothing, either for lack of TX space or because write() returned 0
+typedef enum
+{
+  SEND_RETRY,         // blocking: yielded, try again
+  SEND_WOULD_BLOCK,   // non-blocking: return and try again from the next handleClient()
+  SEND_FAILED         // client gone, or nothing sent for HTTP_MAX_SEND_WAIT
+} SendStall;
+
+inline SendStall ethernetClientSendStall(EthernetClient& client, unsigned long lastProgress, bool block)
+{
+  if (!client.connected() || (millis() - lastProgress > HTTP_MAX_SEND_WAIT))
+    return SEND_FAILED;
+
+  if (!block)
+    return SEND_WOULD_BLOCK;
+
+  yield();
+
+  return SEND_RETRY;
+}
+
+/////////////////////////////////////////////////////////////////////////
+
+// Sends a response body from a data source through two buffers: one is drained to the socket, sized to
+// its free TX space, while the other is filled from the source. run() can be called repeatedly from
+// EthernetWebServer::handleClient(), so that a transfer doesn't hold the loop until it is complete.
+class ResponseStreamer
+{
+  public:
+
+    ResponseStreamer(bool readAhead = true)
+      : _buffer(new uint8_t[2 * STREAMFILE_BUFFER_SZ])
+      , _drain(0)
+      , _pos(0)
+      , _sent(0)
+      , _lastProgress(millis())
+      , _readAhead(readAhead)
+      , _eof(false)
+      , _failed(false)
+    {
+      _len[0] = _len[1] = 0;
+    }
+
+    virtual ~ResponseStreamer()
+    {
+      if (_buffer)
+        delete [] _buffer;
+    }
+
+    // false if the buffers couldn't be allocated
+    bool valid() const
+    {
+      return (_buffer != nullptr);
+    }
+
+    bool failed() const
+    {
+      return _failed;
+    }
+
+    size_t sent() const
+    {
+      return _sent;
+    }
+
+    unsigned long lastProgress() const
+    {
+      return _lastProgress;
+    }
+
+    // Push data to the client. If block is false, return as soon as the socket is full or after
+    // two buffers have been sent. Return true when the transfer is finished (or has failed).
+    bool run(EthernetClient& client, bool block)
+    {
+      size_t budget = 2 * STREAMFILE_BUFFER_SZ;
+
+      while (!_failed)
+      {
+        if (_pos == _len[_drain])
+        {
+          // Current buffer is empty, switch to the read-ahead one, or refill
+          _len[_drain] = 0;
+          _pos = 0;
+          _drain ^= 1;
+
+          if (_len[_drain] == 0)
+          {
+            if (_eof)
+              return true;
+
+            // Without read-ahead, the source is only read when the socket can take the data
+            if (_readAhead || (ethernetClientTxSpace(client) > 0))
+            {
+              _len[_drain] = _read(_drain);
+
+              continue;
+            }
+          }
+        }
+
+        size_t space = ethernetClientTxSpace(client);
+        size_t written = 0;
+
+        if (space > 0)
+        {
+          size_t toSend = _len[_drain] - _pos;
+
+          if (toSend > space)
+            toSend = space;
+
+          written = client.write(_buffer + (_drain * STREAMFILE_BUFFER_SZ) + _pos, toSend);
+        }
+
+        if (written == 0)
+        {
+          const uint8_t fill = _drain ^ 1;
+
+          // Socket is full, use the time to read ahead into the other buffer
+          if (_readAhead && !_eof && (_len[fill] == 0))
+          {
+            _len[fill] = _read(fill);
+
+            continue;
+          }
+
+          const SendStall stall = ethernetClientSendStall(client, _lastProgress, block);
+
+          if (stall == SEND_FAILED)
+          {
+            ET_LOGWARN(F("ResponseStreamer: client gone or send timeout"));
+            _failed = true;
+
+            break;
+          }
+
+          if (stall == SEND_WOULD_BLOCK)
+            return false;
+
+          continue;
+        }
+
+        _pos          += written;
+        _sent         += written;
+        _lastProgress  = millis();
+
+        if (!block)
+        {
+          if (written >= budget)
+            return false;
+
+          budget -= written;
+        }
+      }
+
+      return true;
+    }
+
+  protected:
+
+    // Copy up to len bytes of the body into buf. Return 0 at the end of the body.
+    virtual size_t _fill(uint8_t* buf, size_t len) = 0;
+
+  private:
+
+    size_t _read(uint8_t index)
+    {
+      size_t len = _fill(_buffer + (index * STREAMFILE_BUFFER_SZ), STREAMFILE_BUFFER_SZ);
+
+      if (len == 0)
+        _eof = true;
+
+      return len;
+    }
+
+    uint8_t*        _buffer;
+    size_t          _len[2];
+    uint8_t         _drain;
+    size_t          _pos;
+    size_t          _sent;
+    unsigned long   _lastProgress;
+    bool            _readAhead;
+    bool            _eof;
+    bool            _failed;
+};
+
+/////////////////////////////////////////////////////////////////////////
+
+// T is a file type with read(buf, len), such as SD's File. FileStreamer<File&> reads from the caller's
+// file, FileStreamer<File> keeps its own copy of the handle and closes it when the transfer ends.
+template<typename T> class FileStreamer : public ResponseStreamer
+{
+  public:
+
+    FileStreamer(T file, bool closeOnEnd)
+      : _file(file)
+      , _closeOnEnd(closeOnEnd)
+    {
+    }
+
+    ~FileStreamer()
+    {
+      if (_closeOnEnd)
+        _file.close();
+    }
+
+  protected:
+
+    size_t _fill(uint8_t* buf, size_t len) override
+    {
+      int count = _file.read(buf, len);
+
+      return (count > 0) ? (size_t) count : 0;
+    }
+
+  private:
+
+    T     _file;
+    bool  _closeOnEnd;
+};
+
+#endif  //ResponseStreamer_STM32_h
@@ -0,0 +1,730 @@
+/*
+   bearssl_bench.c
+
+   Micro-benchmarks of the BearSSL primitives bundled in src/SSLClient, built natively
+   on the host (see the Makefile). Every implementation variant of a primitive is run,
+   and the results are written as JSON, one entry per primitive and implementation:
+
+     { "name": "aes128_ctr", "impl": "ct64", "available": true,
+       "bytes_per_op": 16384, "ops_per_s": ..., "mb_per_s": ..., "cycles_per_byte": ... }
+
+   Asymmetric operations have "bytes_per_op": 0 and "cycles_per_op" instead of
+   "cycles_per_byte". Variants which aren't compiled in or which the CPU doesn't
+   support (e.g. aes_x86ni, the m62/m64 EC code) are listed with "available": false.
+
+   Cycles are read from the TSC on x86, or computed from the time and -m cpu_mhz;
+   they are null otherwise. The TSC runs at a fixed rate, which may differ from the
+   core clock when frequency scaling is active.
+
+   usage: bearssl_bench [-t seconds] [-f filter] [-m cpu_mhz] [-o file.json]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/utsname.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+  #include <x86intrin.h>
+  #define BENCH_HAVE_TSC   1
+#else
+  #define BENCH_HAVE_TSC   0
+#endif
+
+#include "bearssl.h"
+
+#ifndef BENCH_CFLAGS
+  #define BENCH_CFLAGS   ""
+#endif
+
+// size of the buffers of the symmetric primitives, one TLS record
+#define BULK_LEN   16384
+
+typedef void (*bench_fn)(void *ctx);
+
+static double         min_time  = 0.25;
+static const char     *filter   = NULL;
+static double         cpu_mhz   = 0;
+static FILE           *out;
+static int            first_result = 1;
+static unsigned char  bulk[BULK_LEN];
+
+/*************************************************************************************/
+
+static double
+now(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static uint64_t
+cycles(void)
+{
+#if BENCH_HAVE_TSC
+  return __rdtsc();
+#else
+  return 0;
+#endif
+}
+
+/*
+   Run fn, doubling the number of calls until min_time is spent. Returns the time of
+   one call in seconds, and its number of TSC cycles in *cyc (0 without a TSC).
+*/
+static double
+measure(bench_fn fn, void *ctx, double *cyc)
+{
+  unsigned long n = 1, total = 0, i;
+  double t0, elapsed;
+  uint64_t c0;
+
+  // warm up the caches
+  fn(ctx);
+
+  t0 = now();
+  c0 = cycles();
+
+  for (;;)
+  {
+    for (i = 0; i < n; i ++)
+    {
+      fn(ctx);
+    }
+
+    total += n;
+    elapsed = now() - t0;
+
+    if (elapsed >= min_time)
+    {
+      break;
+    }
+
+    n <<= 1;
+  }
+
+  *cyc = (double) (cycles() - c0) / total;
+
+  return elapsed / total;
+}
+
+/*
+   Benchmark one implementation and write its JSON entry. fn is NULL when the
+   implementation isn't available. bytes is the input length of one call, 0 for
+   asymmetric operations.
+*/
+static void
+report(const char *name, const char *impl, size_t bytes, bench_fn fn, void *ctx)
+{
+  char full[128];
+  double sec, cyc;
+
+  snprintf(full, sizeof full, "%s/%s", name, impl);
+
+  if (filter != NULL && strstr(full, filter) == NULL)
+  {
+    return;
+  }
+
+  fprintf(out, "%s\n    { \"name\": \"%s\", \"impl\": \"%s\", \"available\": %s",
+          first_result ? "" : ",", name, impl, fn ? "true" : "false");
+  first_result = 0;
+
+  if (fn == NULL)
+  {
+    fprintf(out, " }");
+    fprintf(stderr, "%-34s n/a\n", full);
+    return;
+  }
+
+  sec = measure(fn, ctx, &cyc);
+
+  if (!BENCH_HAVE_TSC)
+  {
+    cyc = (cpu_mhz > 0) ? sec * cpu_mhz * 1e6 : -1;
+  }
+
+  fprintf(out, ", \"bytes_per_op\": %lu, \"ops_per_s\": %.1f", (unsigned long) bytes, 1.0 / sec);
+
+  if (bytes > 0)
+  {
+    fprintf(out, ", \"mb_per_s\": %.2f, \"cycles_per_byte\": ", bytes / sec / 1e6);
+
+    if (cyc >= 0)
+      fprintf(out, "%.2f", cyc / bytes);
+    else
+      fprintf(out, "null");
+
+    fprintf(stderr, "%-34s %10.2f MB/s %8.2f cycles/byte\n", full, bytes / sec / 1e6, cyc >= 0 ? cyc / bytes : 0);
+  }
+  else
+  {
+    fprintf(out, ", \"cycles_per_op\": ");
+
+    if (cyc >= 0)
+      fprintf(out, "%.0f", cyc);
+    else
+      fprintf(out, "null");
+
+    fprintf(stderr, "%-34s %10.1f ops/s %10.0f cycles/op\n", full, 1.0 / sec, cyc >= 0 ? cyc : 0);
+  }
+
+  fprintf(out, " }");
+}
+
+/*************************************************************************************/
+/* Block ciphers */
+
+static const unsigned char key32[32] =
+{
+  0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+  0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F
+};
+
+static unsigned char iv16[16];
+
+typedef struct
+{
+  const br_block_ctr_class *ctr;
+  const br_block_cbcenc_class *cbcenc;
+  const br_block_cbcdec_class *cbcdec;
+  br_aes_gen_ctr_keys ctr_keys;
+  br_aes_gen_cbcenc_keys enc_keys;
+  br_aes_gen_cbcdec_keys dec_keys;
+  br_gcm_context gcm;
+} aes_ctx;
+
+static void
+run_ctr(void *ctx)
+{
+  aes_ctx *c = ctx;
+
+  c->ctr->run(&c->ctr_keys.vtable, iv16, 1, bulk, BULK_LEN);
+}
+
+static void
+run_cbcenc(void *ctx)
+{
+  aes_ctx *c = ctx;
+
+  c->cbcenc->run(&c->enc_keys.vtable, iv16, bulk, BULK_LEN);
+}
+
+static void
+run_cbcdec(void *ctx)
+{
+  aes_ctx *c = ctx;
+
+  c->cbcdec->run(&c->dec_keys.vtable, iv16, bulk, BULK_LEN);
+}
+
+static void
+run_gcm(void *ctx)
+{
+  aes_ctx *c = ctx;
+  unsigned char tag[16];
+
+  br_gcm_reset(&c->gcm, iv16, 12);
+  br_gcm_aad_inject(&c->gcm, iv16, 13);
+  br_gcm_flip(&c->gcm);
+  br_gcm_run(&c->gcm, 1, bulk, BULK_LEN);
+  br_gcm_get_tag(&c->gcm, tag);
+}
+
+static void
+bench_aes(void)
+{
+  static const char *names[] = { "big", "small", "ct", "ct64", "x86ni" };
+  const br_block_ctr_class *ctr[5];
+  const br_block_cbcenc_class *enc[5];
+  const br_block_cbcdec_class *dec[5];
+  br_ghash gh;
+  size_t i;
+
+  ctr[0] = &br_aes_big_ctr_vtable;
+  enc[0] = &br_aes_big_cbcenc_vtable;
+  dec[0] = &br_aes_big_cbcdec_vtable;
+  ctr[1] = &br_aes_small_ctr_vtable;
+  enc[1] = &br_aes_small_cbcenc_vtable;
+  dec[1] = &br_aes_small_cbcdec_vtable;
+  ctr[2] = &br_aes_ct_ctr_vtable;
+  enc[2] = &br_aes_ct_cbcenc_vtable;
+  dec[2] = &br_aes_ct_cbcdec_vtable;
+  ctr[3] = &br_aes_ct64_ctr_vtable;
+  enc[3] = &br_aes_ct64_cbcenc_vtable;
+  dec[3] = &br_aes_ct64_cbcdec_vtable;
+  ctr[4] = br_aes_x86ni_ctr_get_vtable();
+  enc[4] = br_aes_x86ni_cbcenc_get_vtable();
+  dec[4] = br_aes_x86ni_cbcdec_get_vtable();
+
+  // GCM with the fastest GHASH available, to show the AES part
+  gh = br_ghash_pclmul_get();
+
+  if (gh == 0)
+  {
+    gh = &br_ghash_ctmul64;
+  }
+
+  for (i = 0; i < 5; i ++)
+  {
+    aes_ctx c;
+
+    memset(&c, 0, sizeof c);
+    c.ctr = ctr[i];
+    c.cbcenc = enc[i];
+    c.cbcdec = dec[i];
+
+    if (c.ctr != NULL)
+    {
+      c.ctr->init(&c.ctr_keys.vtable, key32, 16);
+      br_gcm_init(&c.gcm, &c.ctr_keys.vtable, gh);
+    }
+
+    if (c.cbcenc != NULL)
+    {
+      c.cbcenc->init(&c.enc_keys.vtable, key32, 16);
+      c.cbcdec->init(&c.dec_keys.vtable, key32, 16);
+    }
+
+    report("aes128_ctr", names[i], BULK_LEN, c.ctr ? run_ctr : NULL, &c);
+    report("aes128_cbc_enc", names[i], BULK_LEN, c.cbcenc ? run_cbcenc : NULL, &c);
+    report("aes128_cbc_dec", names[i], BULK_LEN, c.cbcdec ? run_cbcdec : NULL, &c);
+    report("aes128_gcm", names[i], BULK_LEN, c.ctr ? run_gcm : NULL, &c);
+  }
+}
+
+/*
+   AES-GCM as the record layer runs it, with the AES and GHASH pairs of the
+   default 32 and 64-bit configurations, and the table based (not constant-time)
+   pair of SSLCryptoProfile::useTableGcm().
+*/
+static void
+bench_gcm(void)
+{
+  static const char *names[] = { "ct+ctmul32", "ct64+ctmul64", "big+shoup4" };
+  const br_block_ctr_class *ctr[3] = { &br_aes_ct_ctr_vtable, &br_aes_ct64_ctr_vtable, &br_aes_big_ctr_vtable };
+  br_ghash gh[3] = { &br_ghash_ctmul32, &br_ghash_ctmul64, &br_ghash_shoup4 };
+  size_t i;
+
+  for (i = 0; i < 3; i ++)
+  {
+    aes_ctx c;
+
+    memset(&c, 0, sizeof c);
+    c.ctr = ctr[i];
+    c.ctr->init(&c.ctr_keys.vtable, key32, 16);
+    br_gcm_init(&c.gcm, &c.ctr_keys.vtable, gh[i]);
+
+    report("aes128_gcm_pair", names[i], BULK_LEN, run_gcm, &c);
+  }
+}
+
+/*************************************************************************************/
+/* ChaCha20, Poly1305, GHASH */
+
+typedef struct
+{
+  br_chacha20_run chacha;
+  br_poly1305_run poly;
+  br_ghash ghash;
+} stream_ctx;
+
+static void
+run_chacha(void *ctx)
+{
+  stream_ctx *c = ctx;
+
+  c->chacha(key32, iv16, 1, bulk, BULK_LEN);
+}
+
+static void
+run_poly(void *ctx)
+{
+  stream_ctx *c = ctx;
+  unsigned char tag[16];
+
+  c->poly(key32, iv16, bulk, BULK_LEN, iv16, 13, tag, &br_chacha20_ct_run, 1);
+}
+
+static void
+run_ghash(void *ctx)
+{
+  stream_ctx *c = ctx;
+  unsigned char y[16];
+
+  memset(y, 0, sizeof y);
+  c->ghash(y, key32, bulk, BULK_LEN);
+}
+
+static void
+bench_stream(void)
+{
+  stream_ctx c;
+
+  memset(&c, 0, sizeof c);
+
+  c.chacha = &br_chacha20_ct_run;
+  report("chacha20", "ct", BULK_LEN, run_chacha, &c);
+  c.chacha = br_chacha20_sse2_get();
+  report("chacha20", "sse2", BULK_LEN, c.chacha ? run_chacha : NULL, &c);
+
+  // Poly1305 only exists as part of the AEAD, with ChaCha20 "ct"
+  c.poly = &br_poly1305_ctmul_run;
+  report("chacha20_poly1305", "ctmul", BULK_LEN, run_poly, &c);
+  c.poly = &br_poly1305_ctmul32_run;
+  report("chacha20_poly1305", "ctmul32", BULK_LEN, run_poly, &c);
+  c.poly = br_poly1305_ctmulq_get();
+  report("chacha20_poly1305", "ctmulq", BULK_LEN, c.poly ? run_poly : NULL, &c);
+  c.poly = &br_poly1305_i15_run;
+  report("chacha20_poly1305", "i15", BULK_LEN, run_poly, &c);
+
+  c.ghash = &br_ghash_ctmul;
+  report("ghash", "ctmul", BULK_LEN, run_ghash, &c);
+  c.ghash = &br_ghash_ctmul32;
+  report("ghash", "ctmul32", BULK_LEN, run_ghash, &c);
+  c.ghash = &br_ghash_ctmul64;
+  report("ghash", "ctmul64", BULK_LEN, run_ghash, &c);
+  c.ghash = br_ghash_pclmul_get();
+  report("ghash", "pclmul", BULK_LEN, c.ghash ? run_ghash : NULL, &c);
+  c.ghash = br_ghash_pwr8_get();
+  report("ghash", "pwr8", BULK_LEN, c.ghash ? run_ghash : NULL, &c);
+  c.ghash = &br_ghash_shoup4;
+  report("ghash", "shoup4", BULK_LEN, run_ghash, &c);
+}
+
+/*************************************************************************************/
+/* Hash functions */
+
+static void
+run_hash(void *ctx)
+{
+  const br_hash_class *vt = ctx;
+  br_hash_compat_context hc;
+  unsigned char hash[64];
+
+  vt->init(&hc.vtable);
+  vt->update(&hc.vtable, bulk, BULK_LEN);
+  vt->out(&hc.vtable, hash);
+}
+
+static void
+bench_hash(void)
+{
+  report("sha1", "c", BULK_LEN, run_hash, (void *) &br_sha1_vtable);
+  report("sha256", "c", BULK_LEN, run_hash, (void *) &br_sha256_vtable);
+  report("sha384", "c", BULK_LEN, run_hash, (void *) &br_sha384_vtable);
+}
+
+/*************************************************************************************/
+/* RSA */
+
+typedef struct
+{
+  br_rsa_pkcs1_vrfy vrfy;
+  br_rsa_public_key *pk;
+  unsigned char *sig;
+  size_t sig_len;
+} rsa_ctx;
+
+static unsigned char hash32[32];
+
+static void
+run_rsa_vrfy(void *ctx)
+{
+  rsa_ctx *c = ctx;
+  unsigned char hash[32];
+
+  c->vrfy(c->sig, c->sig_len, BR_HASH_OID_SHA256, sizeof hash, c->pk, hash);
+}
+
+static void
+bench_rsa(br_hmac_drbg_context *rng, unsigned bits)
+{
+  static const char *names[] = { "i15", "i31", "i32", "i62" };
+  br_rsa_pkcs1_vrfy vrfy[4];
+  br_rsa_private_key sk;
+  br_rsa_public_key pk;
+  unsigned char *kbuf_priv, *kbuf_pub, *sig;
+  char name[32];
+  size_t i;
+
+  kbuf_priv = malloc(BR_RSA_KBUF_PRIV_SIZE(bits));
+  kbuf_pub = malloc(BR_RSA_KBUF_PUB_SIZE(bits));
+  sig = malloc(bits / 8);
+
+  if (!br_rsa_i31_keygen(&rng->vtable, &sk, kbuf_priv, &pk, kbuf_pub, bits, 65537)
+      || !br_rsa_i31_pkcs1_sign(BR_HASH_OID_SHA256, hash32, sizeof hash32, &sk, sig))
+  {
+    fprintf(stderr, "RSA-%u key generation failed\n", bits);
+    exit(EXIT_FAILURE);
+  }
+
+  vrfy[0] = &br_rsa_i15_pkcs1_vrfy;
+  vrfy[1] = &br_rsa_i31_pkcs1_vrfy;
+  vrfy[2] = &br_rsa_i32_pkcs1_vrfy;
+  vrfy[3] = br_rsa_i62_pkcs1_vrfy_get();
+
+  snprintf(name, sizeof name, "rsa%u_verify", bits);
+
+  for (i = 0; i < 4; i ++)
+  {
+    rsa_ctx c;
+    unsigned char hash[32];
+
+    c.vrfy = vrfy[i];
+    c.pk = &pk;
+    c.sig = sig;
+    c.sig_len = bits / 8;
+
+    if (c.vrfy != 0 && (!c.vrfy(sig, bits / 8, BR_HASH_OID_SHA256, sizeof hash, &pk, hash)
+                        || memcmp(hash, hash32, sizeof hash) != 0))
+    {
+      fprintf(stderr, "%s/%s: wrong result\n", name, names[i]);
+      exit(EXIT_FAILURE);
+    }
+
+    report(name, names[i], 0, c.vrfy ? run_rsa_vrfy : NULL, &c);
+  }
+
+  free(kbuf_priv);
+  free(kbuf_pub);
+  free(sig);
+}
+
+/*************************************************************************************/
+/* ECDSA and ECDH */
+
+typedef struct
+{
+  const br_ec_impl *iec;
+  int curve;
+  br_ec_private_key sk;
+  br_ec_public_key pk;
+  unsigned char kbuf_pub[BR_EC_KBUF_PUB_MAX_SIZE];
+  unsigned char sig[BR_EC_KBUF_PUB_MAX_SIZE];
+  size_t sig_len;
+} ec_ctx;
+
+static unsigned char ec_key[32];
+
+static void
+run_ecdsa_sign(void *ctx)
+{
+  ec_ctx *c = ctx;
+  unsigned char sig[BR_EC_KBUF_PUB_MAX_SIZE];
+
+  br_ecdsa_i31_sign_asn1(c->iec, &br_sha256_vtable, hash32, &c->sk, sig);
+}
+
+static void
+run_ecdsa_vrfy(void *ctx)
+{
+  ec_ctx *c = ctx;
+
+  br_ecdsa_i31_vrfy_asn1(c->iec, hash32, sizeof hash32, &c->pk, c->sig, c->sig_len);
+}
+
+static void
+run_ecdh(void *ctx)
+{
+  ec_ctx *c = ctx;
+  unsigned char point[BR_EC_KBUF_PUB_MAX_SIZE];
+
+  // the point of the peer, here our own public key
+  memcpy(point, c->pk.q, c->pk.qlen);
+  c->iec->mul(point, c->pk.qlen, c->sk.x, c->sk.xlen, c->curve);
+}
+
+static void
+run_keygen(void *ctx)
+{
+  ec_ctx *c = ctx;
+  unsigned char point[BR_EC_KBUF_PUB_MAX_SIZE];
+
+  c->iec->mulgen(point, c->sk.x, c->sk.xlen, c->curve);
+}
+
+static int
+ec_setup(ec_ctx *c, const br_ec_impl *iec, int curve)
+{
+  memset(c, 0, sizeof *c);
+
+  if (iec == NULL)
+  {
+    return 0;
+  }
+
+  c->iec = iec;
+  c->curve = curve;
+  c->sk.curve = curve;
+  c->sk.x = ec_key;
+  c->sk.xlen = sizeof ec_key;
+
+  if (br_ec_compute_pub(iec, &c->pk, c->kbuf_pub, &c->sk) == 0)
+  {
+    return 0;
+  }
+
+  if (curve == BR_EC_secp256r1)
+  {
+    c->sig_len = br_ecdsa_i31_sign_asn1(iec, &br_sha256_vtable, hash32, &c->sk, c->sig);
+
+    if (c->sig_len == 0
+        || !br_ecdsa_i31_vrfy_asn1(iec, hash32, sizeof hash32, &c->pk, c->sig, c->sig_len))
+    {
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+static void
+bench_ec(void)
+{
+  static const char *names[] = { "m15", "m31", "m62", "m64" };
+  const br_ec_impl *p256[4], *c25519[4];
+  size_t i;
+
+  p256[0] = &br_ec_p256_m15;
+  p256[1] = &br_ec_p256_m31;
+  p256[2] = br_ec_p256_m62_get();
+  p256[3] = br_ec_p256_m64_get();
+  c25519[0] = &br_ec_c25519_m15;
+  c25519[1] = &br_ec_c25519_m31;
+  c25519[2] = br_ec_c25519_m62_get();
+  c25519[3] = br_ec_c25519_m64_get();
+
+  for (i = 0; i < 4; i ++)
+  {
+    ec_ctx c;
+    int ok;
+
+    ok = ec_setup(&c, p256[i], BR_EC_secp256r1);
+
+    if (p256[i] != NULL && !ok)
+    {
+      fprintf(stderr, "p256/%s: wrong result\n", names[i]);
+      exit(EXIT_FAILURE);
+    }
+
+    report("ecdsa_p256_sign", names[i], 0, ok ? run_ecdsa_sign : NULL, &c);
+    report("ecdsa_p256_verify", names[i], 0, ok ? run_ecdsa_vrfy : NULL, &c);
+    report("ecdh_p256_keygen", names[i], 0, ok ? run_keygen : NULL, &c);
+    report("ecdh_p256", names[i], 0, ok ? run_ecdh : NULL, &c);
+  }
+
+  // the P-256 implementation of TLS12_only_profile.c
+  {
+    ec_ctx c;
+
+    ec_setup(&c, &br_ec_prime_fast_256, BR_EC_secp256r1);
+    report("ecdh_p256_keygen", "prime_fast_256", 0, run_keygen, &c);
+    report("ecdh_p256", "prime_fast_256", 0, run_ecdh, &c);
+  }
+
+  for (i = 0; i < 4; i ++)
+  {
+    ec_ctx c;
+    int ok;
+
+    ok = ec_setup(&c, c25519[i], BR_EC_curve25519);
+    report("ecdh_x25519_keygen", names[i], 0, ok ? run_keygen : NULL, &c);
+    report("ecdh_x25519", names[i], 0, ok ? run_ecdh : NULL, &c);
+  }
+}
+
+/*************************************************************************************/
+
+static void
+usage(const char *prog)
+{
+  fprintf(stderr,
+          "usage: %s [-t seconds] [-f filter] [-m cpu_mhz] [-o file.json]\n"
+          "  -t  minimum time per benchmark, default 0.25 s\n"
+          "  -f  only run the benchmarks whose \"name/impl\" contains filter\n"
+          "  -m  core clock, to report cycles where there is no TSC\n"
+          "  -o  JSON output file, default stdout\n", prog);
+  exit(EXIT_FAILURE);
+}
+
+int
+main(int argc, char *argv[])
+{
+  br_hmac_drbg_context rng;
+  struct utsname un;
+  int opt;
+
+  out = stdout;
+
+  while ((opt = getopt(argc, argv, "t:f:m:o:h")) != -1)
+  {
+    switch (opt)
+    {
+      case 't':
+        min_time = atof(optarg);
+        break;
+
+      case 'f':
+        filter = optarg;
+        break;
+
+      case 'm':
+        cpu_mhz = atof(optarg);
+        break;
+
+      case 'o':
+        out = fopen(optarg, "w");
+
+        if (out == NULL)
+        {
+          perror(optarg);
+          return EXIT_FAILURE;
+        }
+
+        break;
+
+      default:
+        usage(argv[0]);
+    }
+  }
+
+  // deterministic keys and data, so that runs can be compared
+  br_hmac_drbg_init(&rng, &br_sha256_vtable, "bearssl_bench", 13);
+  br_hmac_drbg_generate(&rng, bulk, sizeof bulk);
+  br_hmac_drbg_generate(&rng, hash32, sizeof hash32);
+  br_hmac_drbg_generate(&rng, ec_key, sizeof ec_key);
+  ec_key[0] &= 0x7F;
+
+  if (uname(&un) != 0)
+  {
+    strcpy(un.machine, "unknown");
+  }
+
+  fprintf(out, "{\n  \"bench\": \"bearssl\",\n  \"machine\": \"%s\",\n  \"compiler\": \"%s\",\n"
+          "  \"cflags\": \"%s\",\n  \"min_time_s\": %.3f,\n  \"cycles\": \"%s\",\n  \"results\": [",
+          un.machine, __VERSION__, BENCH_CFLAGS, min_time,
+          BENCH_HAVE_TSC ? "tsc" : (cpu_mhz > 0 ? "cpu_mhz" : "none"));
+
+  bench_aes();
+  bench_gcm();
+  bench_stream();
+  bench_hash();
+  bench_rsa(&rng, 2048);
+  bench_rsa(&rng, 4096);
+  bench_ec();
+
+  fprintf(out, "\n  ]\n}\n");
+
+  if (out != stdout)
+  {
+    fclose(out);
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -15,6 +15,7 @@
 #   certifi - Install with 'sudo pip install certifi' (omit sudo on windows)
 
 import re
+import hashlib
 from OpenSSL import SSL, crypto
 import socket
 import textwrap
@@ -36,6 +37,10 @@ RSA_E_PRE = "TA_RSA_E"
 EC_CURVE_PRE = "TA_EC_CURVE"
 # EC curve type enum prefix
 EC_CURVE_NAME_PRE = "BR_EC_"
+# Trust anchor index suffix, appended to the cert array name
+INDEX_SUF = "_INDEX"
+# Bytes of the DN hash per index entry, BR_X509_TA_INDEX_LEN in bearssl_x509.h
+INDEX_ENTRY_LEN = 8
 
 
 # Template that defines the C header output format.
@@ -124,6 +129,56 @@ CROOTCA_EC_TEMPLATE = """\
     }},"""
 
 
+# Template that defines the C header output format of a client certificate and
+# private key, for SSLClientParameters::fromBlob().
+# This takes in a few named parameters:
+#  - guard_name: Unique name to apply to the #ifndef header guard.
+#  - blob_var: Variable name of the SSLClientBlob.
+#  - cert_description: Descriptive info about the cert to put in comments.
+#  - key_description: Descriptive info about the key to put in comments.
+#  - blob_data: The static arrays of the certificate and key numbers.
+#  - cert_name: Variable name of the DER certificate array.
+#  - key_type: BR_KEYTYPE_EC or BR_KEYTYPE_RSA.
+#  - ec_key: Initializer of the br_ec_private_key.
+#  - rsa_key: Initializer of the br_rsa_private_key.
+CBLOB_TEMPLATE = """\
+#ifndef _{guard_name}_H_
+#define _{guard_name}_H_
+
+/* This file is auto-generated by the pycert_bearssl tool.  Do not change it manually.
+ * Client certificate and private key for mutual TLS, decoded for
+ * SSLClientParameters::fromBlob(). Keep this file secret, it contains the private key.
+ *
+{cert_description}
+ * Key:      {key_description}
+ */
+
+{blob_data}
+
+static const SSLClientBlob {blob_var} = {{
+    {{ (unsigned char *){cert_name}, sizeof {cert_name} }},
+    {key_type},
+    {ec_key},
+    {rsa_key}
+}};
+
+#endif /* ifndef _{guard_name}_H_ */
+"""
+
+# Initializers of the key structures of SSLClientBlob
+CEC_KEY_TEMPLATE = "{{ {curve_name}, (unsigned char *){x_name}, sizeof {x_name} }}"
+CEC_KEY_NONE = "{ 0, NULL, 0 }"
+CRSA_KEY_TEMPLATE = """\
+{{
+        {n_bitlen},
+        (unsigned char *){p_name}, sizeof {p_name},
+        (unsigned char *){q_name}, sizeof {q_name},
+        (unsigned char *){dp_name}, sizeof {dp_name},
+        (unsigned char *){dq_name}, sizeof {dq_name},
+        (unsigned char *){iq_name}, sizeof {iq_name}
+    }}"""
+CRSA_KEY_NONE = "{ 0, NULL, 0, NULL, 0, NULL, 0, NULL, 0, NULL, 0 }"
+
 # Template that defines a description of the certificate, so that the header
 # file can be slightly more human readable
 # This takes in a few named parameters:
@@ -240,14 +295,22 @@ def decribe_cert_object(cert, cert_num, domain=None):
         out_str += "\n * Domain(s): " + domain
     return out_str
 
-def x509_to_header(x509Certs, cert_var, cert_length_var, output_file, keep_dupes, domains=None):
+def dn_hash(cert):
+    """SHA-256 of the subject DN of a certificate, as computed by BearSSL's
+    X.509 engine for the trust anchor DN.
+    """
+    return hashlib.sha256(cert.get_subject().der()).digest()
+
+def x509_to_header(x509Certs, cert_var, cert_length_var, output_file, keep_dupes, domains=None, index=False):
     """Combine a collection of PEM format certificates into a single C header with the
     combined cert data in BearSSL format.  x509Certs should be a list of pyOpenSSL x590 objects,
     domains should be a list of respective domain strings (in same order as x509Certs),
     cert_var controls the name of the cert data variable in the output header, cert_length_var 
     controls the name of the cert data length variable/define, output is the output file 
     (which must be open for writing). Keep_dupes is a boolean to indicate if duplicate 
-    certificates should be left intact (true) or removed (false).
+    certificates should be left intact (true) or removed (false). If index is true, the
+    certificates are sorted by DN hash and an index array is added (cert_var + "_INDEX"),
+    for EthernetSSLClient::setTrustAnchorIndex().
     """
     cert_description = ''
     certs = x509Certs
@@ -262,23 +325,29 @@ def x509_to_header(x509Certs, cert_var, cert_length_var, output_file, keep_dupes
     cert_desc = list()
     # track the serial numbers so we can find duplicates
     cert_ser = list()
+    # certificates to write, and the domains they were used for
+    unique_certs = list()
+    unique_domains = list()
     for i, cert in enumerate(certs):
-        # calculate the index shifted from duplicates (if any)
-        cert_index = len(CAs)
         # deduplicate certificates
         if not keep_dupes and cert.get_serial_number() in cert_ser:
             # append the domain we used it for into the cert description
             if domains is not None:
-                cert_desc[cert_ser.index(cert.get_serial_number())] += ", " + domains[i]
+                unique_domains[cert_ser.index(cert.get_serial_number())] += ", " + domains[i]
             # we don't need to generate stuff for this certificate
             continue
         # record the serial number for later
         cert_ser.append(cert.get_serial_number())
+        unique_certs.append(cert)
+        unique_domains.append(domains[i] if domains is not None else None)
+    # sort by DN hash, so that BearSSL can search the anchors with the index
+    if index:
+        order = sorted(range(len(unique_certs)), key=lambda k: dn_hash(unique_certs[k]))
+        unique_certs = [unique_certs[k] for k in order]
+        unique_domains = [unique_domains[k] for k in order]
+    for cert_index, cert in enumerate(unique_certs):
         # add a description of the certificate to the array
-        if domains is None:
-            cert_desc.append(decribe_cert_object(cert, cert_index))
-        else:
-            cert_desc.append(decribe_cert_object(cert, cert_index, domain=domains[i]))
+        cert_desc.append(decribe_cert_object(cert, cert_index, domain=unique_domains[cert_index]))
         # build static arrays containing all the keys of the certificate
         # start with distinguished name
         # get the distinguished name in bytes
@@ -336,6 +405,13 @@ def x509_to_header(x509Certs, cert_var, cert_length_var, output_file, keep_dupes
         ray_type="br_x509_trust_anchor", 
         ray_name=cert_var, 
         ray_data='\n'.join(CAs))
+    # index, first bytes of the DN hash of each anchor
+    if index:
+        index_bytes = b''.join([dn_hash(cert)[:INDEX_ENTRY_LEN] for cert in unique_certs])
+        cert_data_out += '\n\n/* Pass to EthernetSSLClient::setTrustAnchorIndex({0}, sizeof {0}) */\n'.format(cert_var + INDEX_SUF) + CRAY_TEMPLATE.format(
+            ray_type="unsigned char",
+            ray_name=cert_var + INDEX_SUF,
+            ray_data=bytes_to_c_data(index_bytes))
     # create final header file
     output_file.write(CFILE_TEMPLATE.format(
         guard_name=os.path.splitext(output_file.name)[0].upper(),
@@ -344,3 +420,68 @@ def x509_to_header(x509Certs, cert_var, cert_length_var, output_file, keep_dupes
         cert_length=str(len(CAs)),
         cert_data=cert_data_out,
     ))
+
+def int_to_bytes(value, length=None):
+    """Big-endian bytes of a positive integer, on length bytes or as few as possible."""
+    if length is None:
+        length = max(1, (value.bit_length() + 7) // 8)
+    return value.to_bytes(length, byteorder="big")
+
+def mtls_to_header(cert, key, blob_var, output_name):
+    """Write a client certificate and its private key as a C header defining a
+    SSLClientBlob, for SSLClientParameters::fromBlob(). cert should be a pyOpenSSL
+    x509 object, key a pyOpenSSL PKey object (RSA or EC), blob_var the name of
+    the SSLClientBlob variable, and output_name the name of the output file. The
+    certificate is written in DER format, and the key as the numbers BearSSL uses
+    for signing, so the firmware doesn't decode either. The file is only created
+    once the key is known to match the certificate.
+    """
+    # the key must match the certificate, or the server would reject the handshake
+    if cert.get_pubkey().to_cryptography_key().public_numbers() != key.to_cryptography_key().public_key().public_numbers():
+        raise Exception('The private key does not match the certificate')
+    cert_name = blob_var + "_CERT"
+    static_arrays = [CRAY_TEMPLATE.format(
+        ray_type="unsigned char",
+        ray_name=cert_name,
+        ray_data=bytes_to_c_data(crypto.dump_certificate(crypto.FILETYPE_ASN1, cert)))]
+    numbers = key.to_cryptography_key().private_numbers()
+    numbers_typename = type(numbers).__name__
+    ec_key = CEC_KEY_NONE
+    rsa_key = CRSA_KEY_NONE
+    if 'RSA' in numbers_typename:
+        key_type = "BR_KEYTYPE_RSA"
+        key_description = "RSA {0} bits".format(key.bits())
+        names = dict()
+        for field, value in (("p", numbers.p), ("q", numbers.q), ("dp", numbers.dmp1),
+                             ("dq", numbers.dmq1), ("iq", numbers.iqmp)):
+            names[field + "_name"] = blob_var + "_RSA_" + field.upper()
+            static_arrays.append(CRAY_TEMPLATE.format(
+                ray_type="unsigned char",
+                ray_name=names[field + "_name"],
+                ray_data=bytes_to_c_data(int_to_bytes(value))))
+        rsa_key = CRSA_KEY_TEMPLATE.format(n_bitlen=key.bits(), **names)
+    elif 'Elliptic' in numbers_typename:
+        key_type = "BR_KEYTYPE_EC"
+        curve = numbers.public_numbers.curve
+        key_description = "EC {0}".format(curve.name)
+        x_name = blob_var + "_EC_X"
+        static_arrays.append(CRAY_TEMPLATE.format(
+            ray_type="unsigned char",
+            ray_name=x_name,
+            ray_data=bytes_to_c_data(int_to_bytes(numbers.private_value, (curve.key_size + 7) // 8))))
+        ec_key = CEC_KEY_TEMPLATE.format(curve_name=EC_CURVE_NAME_PRE + curve.name, x_name=x_name)
+    else:
+        raise Exception(f'Unknown private key type {numbers_typename}')
+    header = CBLOB_TEMPLATE.format(
+        guard_name=os.path.splitext(os.path.basename(output_name))[0].upper(),
+        blob_var=blob_var,
+        cert_description=decribe_cert_object(cert, 0),
+        key_description=key_description,
+        blob_data='\n\n'.join(static_arrays),
+        cert_name=cert_name,
+        key_type=key_type,
+        ec_key=ec_key,
+        rsa_key=rsa_key,
+    )
+    with open(output_name, 'w') as output_file:
+        output_file.write(header)
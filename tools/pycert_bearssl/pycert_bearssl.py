@@ -24,6 +24,8 @@ from OpenSSL import crypto
 CERT_LENGTH_NAME = "TAs_NUM"
 # Default name for the cert array variable
 CERT_ARRAY_NAME = "TAs"
+# Default name for the client certificate and key variable
+BLOB_NAME = "CLIENT_BLOB"
 
 # Click setup and commands:
 @click.group()
@@ -47,8 +49,10 @@ def pycert_bearssl():
               help='the location of the .pem file containing a list of trusted root certificates (default: use certifi.where())')
 @click.option('--keep-dupes', '-d', is_flag=True, default=False,
               help='write all certs including any duplicates across domains (default: remove duplicates)')
+@click.option('--index', '-i', is_flag=True, default=False,
+              help='sort the certs by DN hash and write an index for EthernetSSLClient::setTrustAnchorIndex(), for large sets of certs (default: no index)')
 @click.argument('domain', nargs=-1)
-def download(port, cert_var, cert_length_var, output, use_store, keep_dupes, domain):
+def download(port, cert_var, cert_length_var, output, use_store, keep_dupes, index, domain):
     """Download the SSL certificates for specified domain(s) and save them as a C
     header file that can be imported into a sketch.
     Provide at least one argument that is the domain to query for its SSL
@@ -87,7 +91,7 @@ def download(port, cert_var, cert_length_var, output, use_store, keep_dupes, dom
         down_certs.append(cert)
     # Combine PEMs and write output header.
     try:
-      cert_util.x509_to_header(down_certs, cert_var, cert_length_var, output, keep_dupes, domains=domain)
+      cert_util.x509_to_header(down_certs, cert_var, cert_length_var, output, keep_dupes, domains=domain, index=index)
     except Exception as E:
       click.echo(f'Recieved error when converting certificate to header: {E}')
       exit(1)
@@ -106,8 +110,10 @@ def download(port, cert_var, cert_length_var, output, use_store, keep_dupes, dom
               help='write all certs including any duplicates (default: remove duplicates)')
 @click.option('--no-search', '-n', is_flag=True, default=False,
               help='Do not attempt to search for a root certificate to the provided PEM files, instead treat the PEM files as the root certificates')
+@click.option('--index', '-i', is_flag=True, default=False,
+              help='sort the certs by DN hash and write an index for EthernetSSLClient::setTrustAnchorIndex(), for large sets of certs (default: no index)')
 @click.argument('cert', type=click.File('r'), nargs=-1)
-def convert(cert_var, cert_length_var, output, use_store, keep_dupes, no_search, cert):
+def convert(cert_var, cert_length_var, output, use_store, keep_dupes, no_search, index, cert):
     """Convert PEM certificates into a C header that can be imported into a
     sketch.  Specify each certificate to encode as a separate argument (each
     must be in PEM format) and they will be merged into a single file.
@@ -149,10 +155,36 @@ def convert(cert_var, cert_length_var, output, use_store, keep_dupes, no_search,
           root_certs.append(cert_dict[cn_hash])
     # Combine PEMs and write output header.
     try:
-      cert_util.x509_to_header(root_certs, cert_var, cert_length_var, output, keep_dupes)
+      cert_util.x509_to_header(root_certs, cert_var, cert_length_var, output, keep_dupes, index=index)
     except Exception as E:
       click.echo(f'Recieved error when converting certificate to header: {E}')
       exit(1)
 
+@pycert_bearssl.command(short_help='Convert a client cert and key into a C header for mutual TLS.')
+@click.option('--blob-var', '-b', default=BLOB_NAME,
+              help='name of the SSLClientBlob variable in the header (default: {0})'.format(BLOB_NAME))
+@click.option('--output', '-o', type=click.Path(dir_okay=False), default='client_blob.h',
+              help='name of the output file (default: client_blob.h)')
+@click.argument('cert', type=click.File('r'))
+@click.argument('key', type=click.File('r'))
+def mtls(blob_var, output, cert, key):
+    """Convert a PEM client certificate and its PEM private key (RSA or EC,
+    PKCS#1, SEC1 or unencrypted PKCS#8) into a C header for
+    SSLClientParameters::fromBlob(). The certificate is stored in DER format
+    and the key already decoded, so the firmware doesn't parse or copy either
+    at boot, as SSLClientParameters::fromPEM() does.
+    If CERT contains a chain, only the first certificate is used.
+    Example of converting the certificate and key of an AWS IoT thing:
+      pycert mtls --output client_blob.h certificate.pem.crt private.pem.key
+    """
+    try:
+      cert_parsed = crypto.load_certificate(crypto.FILETYPE_PEM, cert.read())
+      key_parsed = crypto.load_privatekey(crypto.FILETYPE_PEM, key.read())
+      cert_util.mtls_to_header(cert_parsed, key_parsed, blob_var, output)
+    except Exception as E:
+      click.echo(f'Recieved error when converting certificate and key to header: {E}')
+      exit(1)
+    click.echo('Wrote {0} from {1} and {2}'.format(output, cert.name, key.name))
+
 if __name__ == '__main__':
     pycert_bearssl()